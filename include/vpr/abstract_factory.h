@@ -33,6 +33,13 @@ extern "C" {
 #include <vpr/disposable.h>
 
 #define VPR_ABSTRACT_FACTORY_REGISTRY_ELEMENT_DEFAULT_SIZE 50
+#define VPR_ABSTRACT_FACTORY_REGISTRY_GROWTH_FACTOR 2.0f
+
+/**
+ * \deprecated The registry now grows by
+ * VPR_ABSTRACT_FACTORY_REGISTRY_GROWTH_FACTOR, and no longer uses this value.
+ * It is kept so that code which refers to it still builds.
+ */
 #define VPR_ABSTRACT_FACTORY_REGISTRY_ELEMENT_GROW_SIZE 50
 
 /**
@@ -0,0 +1,537 @@
+/**
+ * \file binary_fuse_filter.h
+ *
+ * \brief Static binary fuse filter.
+ *
+ * A binary fuse filter is an immutable approximate set membership filter.  It
+ * is built once from the complete set of keys, and can then only be queried.
+ * In exchange, it uses about 1.13 times the space of its fingerprints, against
+ * the 1.44 times of a ::bloom_filter_t at the same false positive rate, and
+ * every query makes exactly three memory accesses.
+ *
+ * Each key is assigned three slots in an array of fingerprints, and the
+ * fingerprints are chosen by peeling, so that the exclusive or of the three
+ * slots of every key equals the fingerprint of that key.  A query for a key
+ * which was not in the set matches with probability 2^-8 for one byte
+ * fingerprints and 2^-16 for two byte fingerprints.
+ *
+ * A filter is built from a ::dynamic_array_t.  The elements of the array are
+ * either hashed with the hash function in the options, or, if the options
+ * have no hash function, are taken to be 64-bit key hashes computed by the
+ * caller.  Duplicate keys are allowed.  A build always produces the same filter
+ * for the same set of keys.
+ *
+ * Filters can be serialized to a buffer or saved to a file, and loaded back
+ * either from a buffer or by memory-mapping the file read-only.  The format
+ * consists of a fixed size header followed by the fingerprints.  All
+ * multi-byte fields, including two byte fingerprints, are little-endian.
+ *
+ * | Offset | Size | Field                                                  |
+ * | ------ | ---- | ------------------------------------------------------ |
+ * |      0 |    8 | magic, "VPRBFUSE"                                      |
+ * |      8 |    4 | format version, currently 1                            |
+ * |     12 |    4 | header size in bytes, currently 48                     |
+ * |     16 |    8 | seed                                                   |
+ * |     24 |    8 | number of distinct entries                             |
+ * |     32 |    4 | segment length, a power of two                         |
+ * |     36 |    4 | segment count                                          |
+ * |     40 |    4 | fingerprint size in bytes                              |
+ * |     44 |    4 | identifier of the hash function                        |
+ * |     48 |      | fingerprints, zero padded to a multiple of eight bytes |
+ *
+ * See Graf and Lemire, "Binary Fuse Filters: Fast and Smaller Than Xor
+ * Filters", ACM Journal of Experimental Algorithmics 27 (2022).
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_BINARY_FUSE_FILTER_HEADER_GUARD
+#define VPR_BINARY_FUSE_FILTER_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+#include <vpr/dynamic_array.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+#include <vpr/hash_func.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_BINARY_FUSE_FILTER_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_BINARY_FUSE_FILTER_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The largest number of entries a binary fuse filter can hold.
+ */
+#define BINARY_FUSE_FILTER_MAX_ENTRIES 0x7FFFFFFF
+
+/**
+ * \brief The number of seeds tried before a build is abandoned.
+ *
+ * Each seed fails with a probability well below one half, so in practice a
+ * build only fails if memory is corrupted.
+ */
+#define BINARY_FUSE_FILTER_MAX_ATTEMPTS 100
+
+/**
+ * \brief The magic number at the start of a serialized binary fuse filter.
+ */
+#define BINARY_FUSE_FILTER_SERIALIZED_MAGIC "VPRBFUSE"
+
+/**
+ * \brief The current version of the serialized binary fuse filter format.
+ */
+#define BINARY_FUSE_FILTER_SERIALIZED_VERSION 1
+
+/**
+ * \brief The size of the header of a serialized binary fuse filter.
+ */
+#define BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE 48
+
+/**
+ * \brief The serialized identifier of a filter built from key hashes.
+ */
+#define BINARY_FUSE_FILTER_HASH_ID_NONE 0
+
+/**
+ * \brief The serialized identifier of the sdbm() hash function.
+ */
+#define BINARY_FUSE_FILTER_HASH_ID_SDBM 1
+
+/**
+ * \brief The serialized identifier of the jenkins() hash function.
+ */
+#define BINARY_FUSE_FILTER_HASH_ID_JENKINS 2
+
+/**
+ * \brief This structure contains the options used by a binary fuse filter
+ * instance.
+ *
+ * User code will create an options structure using either the
+ * binary_fuse_filter_options_init() or the
+ * binary_fuse_filter_options_init_ex() method declared below.  When this set of
+ * options is no longer required, it should be disposed using dispose().
+ */
+typedef struct binary_fuse_filter_options
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options to use when building a binary fuse filter.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The size of each fingerprint in bytes; either 1 or 2.
+     */
+    size_t fingerprint_size;
+
+    /**
+     * \brief The hash function used to hash keys, or NULL if keys are 64-bit
+     * key hashes.
+     */
+    hash_func_t hash_function;
+
+} binary_fuse_filter_options_t;
+
+/**
+ * \brief The binary fuse filter structure.
+ */
+typedef struct binary_fuse_filter
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options used to build this binary fuse filter.
+     */
+    binary_fuse_filter_options_t* options;
+
+    /**
+     * \brief The seed mixed into every key hash.
+     */
+    uint64_t seed;
+
+    /**
+     * \brief The number of distinct entries in the filter.
+     */
+    size_t num_entries;
+
+    /**
+     * \brief The number of fingerprints in each segment, a power of two.
+     */
+    uint32_t segment_length;
+
+    /**
+     * \brief The segment length less one.
+     */
+    uint32_t segment_length_mask;
+
+    /**
+     * \brief The number of segments in which the first slot of a key may lie.
+     */
+    uint32_t segment_count;
+
+    /**
+     * \brief The segment count multiplied by the segment length.
+     */
+    uint32_t segment_count_length;
+
+    /**
+     * \brief The total number of fingerprints.
+     */
+    uint32_t array_length;
+
+    /**
+     * \brief The fingerprints, stored little-endian.
+     */
+    uint8_t* fingerprints;
+
+} binary_fuse_filter_t;
+
+/**
+ * \brief A binary fuse filter which is served from a read-only memory mapped
+ * file.
+ */
+typedef struct binary_fuse_filter_mapped
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options of the mapped filter, read from the file header.
+     */
+    binary_fuse_filter_options_t options;
+
+    /**
+     * \brief The mapped filter, whose fingerprints point into the mapping.
+     */
+    binary_fuse_filter_t filter;
+
+    /**
+     * \brief The start of the mapping.
+     */
+    void* map;
+
+    /**
+     * \brief The size of the mapping in bytes.
+     */
+    size_t map_size;
+
+} binary_fuse_filter_mapped_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * binary_fuse_filter_options_t structure.
+ */
+#define MODEL_PROP_VALID_BINARY_FUSE_FILTER_OPTIONS(options) \
+    (NULL != options && NULL != (options)->hdr.dispose && NULL != (options)->alloc_opts && ((options)->fingerprint_size == 1 || (options)->fingerprint_size == 2))
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * binary_fuse_filter_t structure.
+ */
+#define MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter) \
+    (NULL != filter && NULL != (filter)->hdr.dispose && NULL != (filter)->options && (filter)->segment_length > 0 && (filter)->segment_count > 0 && (filter)->array_length == ((filter)->segment_count + 2) * (filter)->segment_length && NULL != (filter)->fingerprints)
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * binary_fuse_filter_mapped_t structure.
+ */
+#define MODEL_PROP_VALID_BINARY_FUSE_FILTER_MAPPED(mapped) \
+    (NULL != mapped && NULL != (mapped)->hdr.dispose && NULL != (mapped)->map && (mapped)->map_size >= BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE && MODEL_PROP_VALID_BINARY_FUSE_FILTER(&(mapped)->filter))
+
+/**
+ * \brief Initialize binary fuse filter options using the default hash
+ * function.
+ *
+ * The default hash function is sdbm.
+ *
+ * \param options                  The binary fuse filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param target_error_rate        The desired error rate for false positives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK binary_fuse_filter_options_init(
+    binary_fuse_filter_options_t* options, allocator_options_t* alloc_opts,
+    float target_error_rate);
+
+/**
+ * \brief Initialize binary fuse filter options using a user supplied hash
+ * function.
+ *
+ * The target_error_rate is the desired rate of false positives, expressed as
+ * a percentage in the range (0,1).  It determines the fingerprint size: 1 byte
+ * for rates of about 0.4% and above, and 2 bytes below that.
+ *
+ * The supplied hash function should be capable of hashing an input value of
+ * arbitrary size and producing a 64 bit hashed value.  If it is NULL, then
+ * every key must be a uint64_t holding a well distributed hash of the key,
+ * which lets the caller hash keys in whatever way suits them.
+ *
+ * \param options                  The binary fuse filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param target_error_rate        The desired error rate for false positives.
+ * \param hash_function            A hash function, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK binary_fuse_filter_options_init_ex(
+    binary_fuse_filter_options_t* options, allocator_options_t* alloc_opts,
+    float target_error_rate, hash_func_t hash_function);
+
+/**
+ * \brief Build a binary fuse filter from an array of keys.
+ *
+ * Every element of the keys array is added to the filter.  If the options have
+ * a hash function, then each element is hashed over the element size of the
+ * array.  Otherwise, the element size must be that of a uint64_t, and each
+ * element is a key hash.
+ *
+ * The filter does not reference the array once built.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::binary_fuse_filter_t instance and must dispose of it by calling dispose()
+ * when it is no longer needed.
+ *
+ * \param options           The binary fuse filter options to use for this
+ *                          instance.
+ * \param filter            The binary fuse filter to build.
+ * \param keys              The array of keys to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_TOO_MANY_ENTRIES if the array has
+ *        more than BINARY_FUSE_FILTER_MAX_ENTRIES elements.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_ALLOCATION_FAILED if memory could
+ *        not be allocated for the filter or for building it.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_BUILD_FAILED if no seed could be
+ *        found for which the keys could be peeled.
+ */
+int VPR_DECL_MUST_CHECK binary_fuse_filter_init(
+    binary_fuse_filter_options_t* options, binary_fuse_filter_t* filter,
+    const dynamic_array_t* keys);
+
+/**
+ * \brief Query a binary fuse filter to determine if an item is in the set.
+ *
+ * If the filter was built from key hashes, then data must be a uint64_t key
+ * hash, and len must be the size of a uint64_t.
+ *
+ * \param filter            The binary fuse filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool binary_fuse_filter_contains_item(
+    const binary_fuse_filter_t* filter, const void* data, size_t len);
+
+/**
+ * \brief Query a binary fuse filter to determine if a key hash is in the set.
+ *
+ * The hash must be computed in the same way as the hashes used to build the
+ * filter; either by the hash function in the options, or by the caller if the
+ * filter was built from key hashes.
+ *
+ * \param filter            The binary fuse filter.
+ * \param hash              The key hash to query the filter for.
+ *
+ * \returns a boolean value indicating if the hash is present in the filter.
+ */
+_Bool binary_fuse_filter_contains_hash(
+    const binary_fuse_filter_t* filter, uint64_t hash);
+
+/**
+ * \brief Get the number of bytes needed to serialize a binary fuse filter.
+ *
+ * \param filter            The binary fuse filter.
+ *
+ * \returns the size of the serialized binary fuse filter in bytes.
+ */
+size_t binary_fuse_filter_serialized_size(const binary_fuse_filter_t* filter);
+
+/**
+ * \brief Serialize a binary fuse filter to a buffer.
+ *
+ * \param filter            The binary fuse filter to serialize.
+ * \param buffer            The buffer to which the filter is written.
+ * \param size              The size of the buffer, which must be at least
+ *                          binary_fuse_filter_serialized_size() bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_SERIALIZE_BUFFER_TOO_SMALL if the
+ *        buffer is too small.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the filter
+ *        uses a hash function which cannot be serialized.
+ */
+int VPR_DECL_MUST_CHECK binary_fuse_filter_serialize(
+    const binary_fuse_filter_t* filter, void* buffer, size_t size);
+
+/**
+ * \brief Initialize a binary fuse filter in place from a serialized buffer.
+ *
+ * The options are read from the buffer header, and the fingerprints of the
+ * filter point directly into the buffer; nothing is copied.  The buffer must be
+ * aligned to eight bytes, and must outlive both the filter and the options.
+ *
+ * When the function completes successfully, the caller owns the options and
+ * the filter, and must dispose of both when they are no longer needed.
+ * Disposing of them does not release the buffer.
+ *
+ * \param options           The binary fuse filter options to initialize.
+ * \param filter            The binary fuse filter to initialize.
+ * \param alloc_opts        The allocator options to record in the options.
+ * \param buffer            The serialized binary fuse filter.
+ * \param size              The size of the buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT if the buffer does
+ *        not hold a valid serialized filter.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the
+ *        serialized filter names an unknown hash function.
+ */
+int VPR_DECL_MUST_CHECK binary_fuse_filter_init_from_buffer(
+    binary_fuse_filter_options_t* options, binary_fuse_filter_t* filter,
+    allocator_options_t* alloc_opts, const void* buffer, size_t size);
+
+/**
+ * \brief Save a binary fuse filter to a file.
+ *
+ * The file is written in the same format as binary_fuse_filter_serialize(),
+ * without making an intermediate copy of the fingerprints.
+ *
+ * \param filter            The binary fuse filter to save.
+ * \param path              The path of the file to create or replace.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the filter
+ *        uses a hash function which cannot be serialized.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_FILE_IO if the file could not be
+ *        written.
+ */
+int VPR_DECL_MUST_CHECK binary_fuse_filter_save(
+    const binary_fuse_filter_t* filter, const char* path);
+
+/**
+ * \brief Load a binary fuse filter by memory-mapping a saved filter file
+ * read-only.
+ *
+ * The filter is served straight from the mapping, so processes which map the
+ * same file share its pages.
+ *
+ * This function is only available on POSIX platforms.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::binary_fuse_filter_mapped_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed, which unmaps the file.
+ *
+ * \param mapped            The mapped binary fuse filter to initialize.
+ * \param alloc_opts        The allocator options to record in the options.
+ * \param path              The path of a file written by
+ *                          binary_fuse_filter_save().
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_FILE_IO if the file could not be
+ *        opened or mapped.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT if the file does not
+ *        hold a valid serialized filter.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the
+ *        serialized filter names an unknown hash function.
+ */
+int VPR_DECL_MUST_CHECK binary_fuse_filter_mapped_init(
+    binary_fuse_filter_mapped_t* mapped, allocator_options_t* alloc_opts,
+    const char* path);
+
+/**
+ * \brief Get the disposable handle from a binary fuse filter options instance.
+ *
+ * \param options           The binary fuse filter options instance from which
+ *                          the disposable handle is read.
+ *
+ * \returns the disposable handle for this binary fuse filter options instance.
+ */
+VPR_INLINE disposable_t* binary_fuse_filter_options_disposable_handle(
+    binary_fuse_filter_options_t* options)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER_OPTIONS(options));
+
+        return &(options->hdr);
+    }
+)
+
+/**
+ * \brief Get the disposable handle from a binary fuse filter instance.
+ *
+ * \param filter            The binary fuse filter instance from which the
+ *                          disposable handle is read.
+ *
+ * \returns the disposable handle for this binary fuse filter instance.
+ */
+VPR_INLINE disposable_t* binary_fuse_filter_disposable_handle(
+    binary_fuse_filter_t* filter)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter));
+
+        return &(filter->hdr);
+    }
+)
+
+/**
+ * \brief Get the disposable handle from a mapped binary fuse filter instance.
+ *
+ * \param mapped            The mapped binary fuse filter instance from which
+ *                          the disposable handle is read.
+ *
+ * \returns the disposable handle for this mapped binary fuse filter instance.
+ */
+VPR_INLINE disposable_t* binary_fuse_filter_mapped_disposable_handle(
+    binary_fuse_filter_mapped_t* mapped)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER_MAPPED(mapped));
+
+        return &(mapped->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_BINARY_FUSE_FILTER_HEADER_GUARD
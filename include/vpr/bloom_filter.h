@@ -127,6 +127,10 @@ typedef struct bloom_filter
 
     /**
      * \brief Opaque pointer to the bitfield used to test membership in a set.
+     *
+     * The bitfield is allocated in whole 64-bit words, so that it can be
+     * updated a machine word at a time by bloom_filter_add_item_concurrent().
+     * Padding beyond size_in_bytes is never set.
      */
     void* bitmap;
 
@@ -274,6 +278,135 @@ int VPR_DECL_MUST_CHECK bloom_filter_add_item(
 _Bool bloom_filter_contains_item(bloom_filter_t* bloom, const void* data,
     size_t len);
 
+/**
+ * \brief Add an item to a bloom filter that is shared between threads.
+ *
+ * Each bit is set with an atomic fetch-or on the machine word that holds it,
+ * so any number of threads may add items to the same filter concurrently
+ * without losing bits, and without external locking.  Bits which are already
+ * set are not written again, which keeps contended cache lines shared.
+ *
+ * Concurrent adds may be freely mixed with calls to
+ * bloom_filter_contains_item_concurrent(), but not with calls to
+ * bloom_filter_add_item() or bloom_filter_contains_item().  Once all writers
+ * have been joined, the filter may be queried with the ordinary functions.
+ *
+ * \param bloom             The bloom filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK bloom_filter_add_item_concurrent(
+    bloom_filter_t* bloom, const void* data, size_t len);
+
+/**
+ * \brief Query a bloom filter that is shared between threads.
+ *
+ * This query is lock-free, and may run concurrently with
+ * bloom_filter_add_item_concurrent().  An item whose add has completed before
+ * this query begins is always found; an item which is being added at the same
+ * time may or may not be found.
+ *
+ * \param bloom             The bloom filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool bloom_filter_contains_item_concurrent(
+    bloom_filter_t* bloom, const void* data, size_t len);
+
+/**
+ * \brief Query a bloom filter for a batch of items.
+ *
+ * This is equivalent to calling bloom_filter_contains_item() for each item,
+ * but is much faster for filters which do not fit in cache.  Items are
+ * processed in small blocks: every item in a block is hashed and a prefetch is
+ * issued for each of its bit positions before any bit is tested, so that the
+ * cache misses of the whole block overlap instead of stalling one at a time.
+ *
+ * \param bloom             The bloom filter.
+ * \param items             An array of count pointers to the items to query.
+ * \param lens              An array of count item sizes.
+ * \param count             The number of items to query.
+ * \param results           An array of count booleans, which receives true for
+ *                          each item that may be in the filter and false for
+ *                          each item that definitely is not.
+ */
+void bloom_filter_contains_many(
+    bloom_filter_t* bloom, const void* const* items, const size_t* lens,
+    size_t count, _Bool* results);
+
+/**
+ * \brief Determine whether two bloom filters are compatible.
+ *
+ * Two bloom filters are compatible if they are the same size and use the same
+ * hash functions, so that any item maps to the same bits in both.  Only
+ * compatible filters can be combined with bloom_filter_union() or
+ * bloom_filter_intersect().
+ *
+ * \param lhs               The first bloom filter.
+ * \param rhs               The second bloom filter.
+ *
+ * \returns true if the filters are compatible, and false otherwise.
+ */
+_Bool bloom_filter_is_compatible(
+    const bloom_filter_t* lhs, const bloom_filter_t* rhs);
+
+/**
+ * \brief Merge the items of one bloom filter into another.
+ *
+ * After this call, dest reports every item that either filter reported
+ * before the call.  The bitmaps are combined with the widest vector operations
+ * available on the target.
+ *
+ * \param dest              The bloom filter to update.
+ * \param src               The bloom filter to merge into dest.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_INCOMPATIBLE_FILTERS if the filters are not
+ *        compatible.
+ */
+int VPR_DECL_MUST_CHECK bloom_filter_union(
+    bloom_filter_t* dest, const bloom_filter_t* src);
+
+/**
+ * \brief Intersect one bloom filter with another.
+ *
+ * After this call, dest reports every item that both filters reported before
+ * the call.  Note that the result may also report some items which were in
+ * only one of the filters, so its false positive rate can be higher than that
+ * of either filter.  The bitmaps are combined with the widest vector
+ * operations available on the target.
+ *
+ * \param dest              The bloom filter to update.
+ * \param src               The bloom filter to intersect with dest.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_INCOMPATIBLE_FILTERS if the filters are not
+ *        compatible.
+ */
+int VPR_DECL_MUST_CHECK bloom_filter_intersect(
+    bloom_filter_t* dest, const bloom_filter_t* src);
+
+/**
+ * \brief Estimate the number of distinct items added to a bloom filter.
+ *
+ * The estimate is derived from the number of bits set in the filter, X, using
+ * the Swamidass-Baldi estimator n = -(m / k) ln(1 - X / m), where m is the
+ * number of bits and k is the number of hash functions.  Once every bit is
+ * set, the estimate no longer grows.
+ *
+ * \param bloom             The bloom filter.
+ *
+ * \returns the estimated number of distinct items in the filter.
+ */
+size_t bloom_filter_estimate_cardinality(const bloom_filter_t* bloom);
+
 /**
  * \brief Helper function to calculate the size of a filter.
  *
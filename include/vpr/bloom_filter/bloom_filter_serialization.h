@@ -0,0 +1,256 @@
+/**
+ * \file bloom_filter_serialization.h
+ *
+ * \brief Serialized and memory-mapped bloom filters.
+ *
+ * A ::bloom_filter_t can be serialized to a buffer or saved to a file in a
+ * versioned, platform independent format, and loaded back either from a
+ * buffer or by memory-mapping the file read-only.  A mapped filter is queried
+ * in place with bloom_filter_contains_item(), so any number of processes which
+ * map the same file share a single copy of it in the page cache.
+ *
+ * The format consists of a fixed size header followed by the bitmap.  All
+ * multi-byte header fields are little-endian.
+ *
+ * | Offset | Size | Field                                            |
+ * | ------ | ---- | ------------------------------------------------ |
+ * |      0 |    8 | magic, "VPRBLOOM"                                |
+ * |      8 |    4 | format version, currently 1                      |
+ * |     12 |    4 | header size in bytes, currently 48               |
+ * |     16 |    8 | size of the bitmap in bytes                      |
+ * |     24 |    8 | number of expected entries                       |
+ * |     32 |    4 | number of hash functions                         |
+ * |     36 |    4 | identifier of the first hash function            |
+ * |     40 |    4 | identifier of the second hash function           |
+ * |     44 |    4 | reserved, zero                                   |
+ * |     48 |      | bitmap, zero padded to a multiple of eight bytes |
+ *
+ * Only the hash functions declared in hash_func.h have identifiers, since a
+ * function pointer cannot be serialized.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_BLOOM_FILTER_BLOOM_FILTER_SERIALIZATION_HEADER_GUARD
+#define VPR_BLOOM_FILTER_BLOOM_FILTER_SERIALIZATION_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/bloom_filter.h>
+#include <vpr/disposable.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_BLOOM_FILTER_SERIALIZATION_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_BLOOM_FILTER_SERIALIZATION_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The magic number at the start of a serialized bloom filter.
+ */
+#define BLOOM_FILTER_SERIALIZED_MAGIC "VPRBLOOM"
+
+/**
+ * \brief The current version of the serialized bloom filter format.
+ */
+#define BLOOM_FILTER_SERIALIZED_VERSION 1
+
+/**
+ * \brief The size of the header of a serialized bloom filter.
+ */
+#define BLOOM_FILTER_SERIALIZED_HEADER_SIZE 48
+
+/**
+ * \brief The serialized identifier of the sdbm() hash function.
+ */
+#define BLOOM_FILTER_HASH_ID_SDBM 1
+
+/**
+ * \brief The serialized identifier of the jenkins() hash function.
+ */
+#define BLOOM_FILTER_HASH_ID_JENKINS 2
+
+/**
+ * \brief A bloom filter which is served from a read-only memory mapped file.
+ */
+typedef struct bloom_filter_mapped
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options of the mapped filter, read from the file header.
+     */
+    bloom_filter_options_t options;
+
+    /**
+     * \brief The mapped filter, whose bitmap points into the mapping.
+     */
+    bloom_filter_t filter;
+
+    /**
+     * \brief The start of the mapping.
+     */
+    void* map;
+
+    /**
+     * \brief The size of the mapping in bytes.
+     */
+    size_t map_size;
+
+} bloom_filter_mapped_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * bloom_filter_mapped_t structure.
+ */
+#define MODEL_PROP_VALID_BLOOM_FILTER_MAPPED(mapped) \
+    (NULL != mapped && NULL != (mapped)->hdr.dispose && NULL != (mapped)->map && (mapped)->map_size >= BLOOM_FILTER_SERIALIZED_HEADER_SIZE && MODEL_PROP_VALID_BLOOM_FILTER(&(mapped)->filter))
+
+/**
+ * \brief Get the number of bytes needed to serialize a bloom filter.
+ *
+ * \param bloom             The bloom filter.
+ *
+ * \returns the size of the serialized bloom filter in bytes.
+ */
+size_t bloom_filter_serialized_size(const bloom_filter_t* bloom);
+
+/**
+ * \brief Serialize a bloom filter to a buffer.
+ *
+ * \param bloom             The bloom filter to serialize.
+ * \param buffer            The buffer to which the filter is written.
+ * \param size              The size of the buffer, which must be at least
+ *                          bloom_filter_serialized_size() bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_SERIALIZE_BUFFER_TOO_SMALL if the buffer is too
+ *        small.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the filter uses a hash
+ *        function which cannot be serialized.
+ */
+int VPR_DECL_MUST_CHECK bloom_filter_serialize(
+    const bloom_filter_t* bloom, void* buffer, size_t size);
+
+/**
+ * \brief Initialize a bloom filter in place from a serialized buffer.
+ *
+ * The options are read from the buffer header, and the bitmap of the filter
+ * points directly into the buffer; nothing is copied.  The buffer must be
+ * aligned to eight bytes, and must outlive both the filter and the options.
+ * If the buffer is read-only, then the filter must only be queried.
+ *
+ * When the function completes successfully, the caller owns the options and
+ * the filter, and must dispose of both when they are no longer needed.
+ * Disposing of them does not release the buffer.
+ *
+ * \param options           The bloom filter options to initialize.
+ * \param bloom             The bloom filter to initialize.
+ * \param alloc_opts        The allocator options to record in the options.
+ * \param buffer            The serialized bloom filter.
+ * \param size              The size of the buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_INVALID_FORMAT if the buffer does not hold a
+ *        valid serialized filter.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the serialized filter
+ *        names an unknown hash function.
+ */
+int VPR_DECL_MUST_CHECK bloom_filter_init_from_buffer(
+    bloom_filter_options_t* options, bloom_filter_t* bloom,
+    allocator_options_t* alloc_opts, const void* buffer, size_t size);
+
+/**
+ * \brief Save a bloom filter to a file.
+ *
+ * The file is written in the same format as bloom_filter_serialize(), without
+ * making an intermediate copy of the bitmap.
+ *
+ * \param bloom             The bloom filter to save.
+ * \param path              The path of the file to create or replace.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the filter uses a hash
+ *        function which cannot be serialized.
+ *      - \ref VPR_ERROR_BLOOM_FILE_IO if the file could not be written.
+ */
+int VPR_DECL_MUST_CHECK bloom_filter_save(
+    const bloom_filter_t* bloom, const char* path);
+
+/**
+ * \brief Load a bloom filter by memory-mapping a saved filter file read-only.
+ *
+ * The filter is served straight from the mapping, so mapped->filter may be
+ * passed to bloom_filter_contains_item() and
+ * bloom_filter_contains_item_concurrent(), but must never be added to.
+ * Processes which map the same file share its pages.
+ *
+ * This function is only available on POSIX platforms.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::bloom_filter_mapped_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed, which unmaps the file.
+ *
+ * \param mapped            The mapped bloom filter to initialize.
+ * \param alloc_opts        The allocator options to record in the options.
+ * \param path              The path of a file written by bloom_filter_save().
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_FILE_IO if the file could not be opened or
+ *        mapped.
+ *      - \ref VPR_ERROR_BLOOM_INVALID_FORMAT if the file does not hold a valid
+ *        serialized filter.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the serialized filter
+ *        names an unknown hash function.
+ */
+int VPR_DECL_MUST_CHECK bloom_filter_mapped_init(
+    bloom_filter_mapped_t* mapped, allocator_options_t* alloc_opts,
+    const char* path);
+
+/**
+ * \brief Get the disposable handle from a mapped bloom filter instance.
+ *
+ * \param mapped            The mapped bloom filter instance from which the
+ *                          disposable handle is read.
+ *
+ * \returns the disposable handle for this mapped bloom filter instance.
+ */
+VPR_INLINE disposable_t* bloom_filter_mapped_disposable_handle(
+    bloom_filter_mapped_t* mapped)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER_MAPPED(mapped));
+
+        return &(mapped->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_BLOOM_FILTER_BLOOM_FILTER_SERIALIZATION_HEADER_GUARD
@@ -0,0 +1,207 @@
+/**
+ * \file counting_bloom_filter.h
+ *
+ * \brief Counting bloom filter.
+ *
+ * A counting bloom filter replaces each bit of a ::bloom_filter_t with a small
+ * saturating counter, which allows items to be removed from the filter as well
+ * as added.  This implementation uses 4-bit counters, packed sixteen to a
+ * 64-bit word.  A counter that reaches its maximum value of 15 sticks there and
+ * is never decremented, so that removals can never introduce a false negative.
+ *
+ * A counting bloom filter is created from the same ::bloom_filter_options_t as
+ * a plain bloom filter, and uses the same hashing scheme.  As such, it can be
+ * compacted into a read-only ::bloom_filter_t with
+ * counting_bloom_filter_to_bloom_filter() for publication.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_BLOOM_FILTER_COUNTING_BLOOM_FILTER_HEADER_GUARD
+#define VPR_BLOOM_FILTER_COUNTING_BLOOM_FILTER_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/bloom_filter.h>
+#include <vpr/disposable.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_COUNTING_BLOOM_FILTER_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_COUNTING_BLOOM_FILTER_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The maximum value of a counting bloom filter counter.
+ *
+ * Once a counter reaches this value, it saturates and is no longer incremented
+ * or decremented.
+ */
+#define COUNTING_BLOOM_FILTER_COUNTER_MAX 15
+
+/**
+ * \brief The counting bloom filter structure.
+ */
+typedef struct counting_bloom_filter
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options used to create this counting bloom filter.
+     */
+    bloom_filter_options_t* options;
+
+    /**
+     * \brief The number of 64-bit words in the counter array.
+     */
+    size_t num_words;
+
+    /**
+     * \brief The packed 4-bit counters, one for each bit of the equivalent
+     * ::bloom_filter_t.
+     */
+    uint64_t* counters;
+
+} counting_bloom_filter_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * counting_bloom_filter_t structure.
+ */
+#define MODEL_PROP_VALID_COUNTING_BLOOM_FILTER(bloom) \
+    (NULL != bloom && NULL != (bloom)->hdr.dispose && NULL != (bloom)->options && (bloom)->num_words > 0 && NULL != (bloom)->counters)
+
+/**
+ * \brief Initialize a counting bloom filter.
+ *
+ * This method allows for the creation of a counting bloom filter.  Once
+ * initialized, the filter will be empty.  The options structure is shared with
+ * ::bloom_filter_t, and should be initialized with bloom_filter_options_init()
+ * or bloom_filter_options_init_ex().  Note that the counting filter uses four
+ * times the memory of the equivalent bloom filter.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::counting_bloom_filter_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed.
+ *
+ * \param options           The bloom filter options to use for this instance.
+ * \param bloom             The counting bloom filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_COUNTER_ALLOCATION_FAILED if memory could not
+ *        be allocated for the counters.
+ */
+int VPR_DECL_MUST_CHECK counting_bloom_filter_init(
+    bloom_filter_options_t* options, counting_bloom_filter_t* bloom);
+
+/**
+ * \brief Add an item to a counting bloom filter.
+ *
+ * \param bloom             The counting bloom filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK counting_bloom_filter_add_item(
+    counting_bloom_filter_t* bloom, const void* data, size_t len);
+
+/**
+ * \brief Remove an item from a counting bloom filter.
+ *
+ * Only items which were previously added should be removed.  Removing an item
+ * which was never added may cause false negatives for other items that share
+ * its counters.  If any of the counters for this item are zero, then the item
+ * is definitely not in the filter, and the filter is left unchanged.
+ *
+ * \param bloom             The counting bloom filter.
+ * \param data              The data to remove from the filter.
+ * \param len               The size of the data to remove from the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_REMOVE_ITEM_NOT_FOUND if the item is not in the
+ *        filter.
+ */
+int VPR_DECL_MUST_CHECK counting_bloom_filter_remove_item(
+    counting_bloom_filter_t* bloom, const void* data, size_t len);
+
+/**
+ * \brief Query a counting bloom filter to determine if an item has been added.
+ *
+ * \param bloom             The counting bloom filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool counting_bloom_filter_contains_item(
+    counting_bloom_filter_t* bloom, const void* data, size_t len);
+
+/**
+ * \brief Compact a counting bloom filter into a plain bloom filter.
+ *
+ * The resulting ::bloom_filter_t shares the options of the counting bloom
+ * filter, and has a bit set for every non-zero counter.  It answers
+ * bloom_filter_contains_item() queries exactly as the counting bloom filter
+ * answered counting_bloom_filter_contains_item() at the time of conversion.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::bloom_filter_t instance and must dispose of it by calling dispose() when it
+ * is no longer needed.  The options structure must outlive both filters.
+ *
+ * \param counting          The counting bloom filter to compact.
+ * \param bloom             The bloom filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bloom filter.
+ */
+int VPR_DECL_MUST_CHECK counting_bloom_filter_to_bloom_filter(
+    counting_bloom_filter_t* counting, bloom_filter_t* bloom);
+
+/**
+ * \brief Get the disposable handle from a counting bloom filter instance.
+ *
+ * \param bloom             The counting bloom filter instance from which the
+ *                          disposable handle is read.
+ *
+ * \returns the disposable handle for this counting bloom filter instance.
+ */
+VPR_INLINE disposable_t* counting_bloom_filter_disposable_handle(
+    counting_bloom_filter_t* bloom)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_COUNTING_BLOOM_FILTER(bloom));
+
+        return &(bloom->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_BLOOM_FILTER_COUNTING_BLOOM_FILTER_HEADER_GUARD
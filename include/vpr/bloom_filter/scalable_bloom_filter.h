@@ -0,0 +1,354 @@
+/**
+ * \file scalable_bloom_filter.h
+ *
+ * \brief Scalable bloom filter.
+ *
+ * A ::bloom_filter_t must be sized up front for the number of entries it will
+ * hold.  Once that number is exceeded, its false positive rate climbs without
+ * bound.  A scalable bloom filter instead starts with a small bloom filter
+ * stage, and chains on a larger stage each time the current stage fills up.
+ * Each new stage is larger than the previous one by a growth factor, and has a
+ * geometrically tighter error rate, so that the compound false positive rate
+ * of all stages never exceeds the target error rate.
+ *
+ * See Almeida, Baquero, Preguiça and Hutchison, "Scalable Bloom Filters",
+ * Information Processing Letters 101 (2007).
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_BLOOM_FILTER_SCALABLE_BLOOM_FILTER_HEADER_GUARD
+#define VPR_BLOOM_FILTER_SCALABLE_BLOOM_FILTER_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/bloom_filter.h>
+#include <vpr/disposable.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+#include <vpr/hash_func.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_SCALABLE_BLOOM_FILTER_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_SCALABLE_BLOOM_FILTER_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The default factor by which each stage grows over the previous one.
+ */
+#define SCALABLE_BLOOM_FILTER_DEFAULT_GROWTH_FACTOR 2
+
+/**
+ * \brief The default ratio by which each stage's error rate is tightened over
+ * the previous one.
+ */
+#define SCALABLE_BLOOM_FILTER_DEFAULT_TIGHTENING_RATIO 0.5f
+
+/**
+ * \brief This structure contains the options used by a scalable bloom filter
+ * instance.
+ *
+ * User code will create an options structure using either the
+ * scalable_bloom_filter_options_init() or the
+ * scalable_bloom_filter_options_init_ex() method declared below.  When this set
+ * of options is no longer required, it should be disposed using dispose().
+ */
+typedef struct scalable_bloom_filter_options
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options to use when creating a scalable bloom
+     * filter.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The number of entries held by the first stage of the filter.
+     */
+    size_t initial_capacity;
+
+    /**
+     * \brief The compound false positive rate of the filter, in the range
+     * (0,1).
+     */
+    float target_error_rate;
+
+    /**
+     * \brief The factor by which the capacity of each stage exceeds the
+     * capacity of the previous stage.
+     */
+    unsigned int growth_factor;
+
+    /**
+     * \brief The ratio, in the range (0,1), between the error rate of each
+     * stage and the error rate of the previous stage.
+     */
+    float tightening_ratio;
+
+    /**
+     * \brief The first of two hash functions, used to derive additional hash
+     * functions.
+     */
+    hash_func_t hash_function_1;
+
+    /**
+     * \brief The second of two hash functions, used to derive additional hash
+     * functions.
+     */
+    hash_func_t hash_function_2;
+
+} scalable_bloom_filter_options_t;
+
+/**
+ * \brief A single stage of a scalable bloom filter.
+ */
+typedef struct scalable_bloom_filter_stage
+{
+    /**
+     * \brief The options for this stage's bloom filter.
+     */
+    bloom_filter_options_t options;
+
+    /**
+     * \brief The bloom filter for this stage.
+     */
+    bloom_filter_t filter;
+
+    /**
+     * \brief The number of entries this stage can hold while meeting its
+     * error rate.
+     */
+    size_t capacity;
+
+    /**
+     * \brief The number of entries added to this stage.
+     */
+    size_t count;
+
+} scalable_bloom_filter_stage_t;
+
+/**
+ * \brief The scalable bloom filter structure.
+ */
+typedef struct scalable_bloom_filter
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options used to create this scalable bloom filter.
+     */
+    scalable_bloom_filter_options_t* options;
+
+    /**
+     * \brief The stages of this filter, from oldest to newest.  Only the
+     * newest stage receives new entries.
+     */
+    scalable_bloom_filter_stage_t** stages;
+
+    /**
+     * \brief The number of stages currently in use.
+     */
+    size_t num_stages;
+
+    /**
+     * \brief The number of stage pointers the stages array can hold.
+     */
+    size_t reserved_stages;
+
+} scalable_bloom_filter_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * scalable_bloom_filter_options_t structure.
+ */
+#define MODEL_PROP_VALID_SCALABLE_BLOOM_FILTER_OPTIONS(options) \
+    (NULL != options && NULL != (options)->hdr.dispose && NULL != (options)->alloc_opts && (options)->initial_capacity > 0 && (options)->target_error_rate > 0 && (options)->target_error_rate < 1.0 && (options)->growth_factor > 0 && (options)->tightening_ratio > 0 && (options)->tightening_ratio < 1.0 && NULL != (options)->hash_function_1 && NULL != (options)->hash_function_2)
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * scalable_bloom_filter_t structure.
+ */
+#define MODEL_PROP_VALID_SCALABLE_BLOOM_FILTER(bloom) \
+    (NULL != bloom && NULL != (bloom)->hdr.dispose && NULL != (bloom)->options && NULL != (bloom)->stages && (bloom)->num_stages > 0 && (bloom)->num_stages <= (bloom)->reserved_stages)
+
+/**
+ * \brief Initialize scalable bloom filter options using default hash functions
+ * and growth parameters.
+ *
+ * The default hash functions are sdbm and jenkins.  Each stage has twice the
+ * capacity of the previous stage, and half of its error rate.
+ *
+ * \param options                  The scalable bloom filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param initial_capacity         The number of items held by the first stage
+ *                                 of the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK scalable_bloom_filter_options_init(
+    scalable_bloom_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t initial_capacity, float target_error_rate);
+
+/**
+ * \brief Initialize scalable bloom filter options using user supplied hash
+ * functions and growth parameters.
+ *
+ * The first stage of the filter holds initial_capacity entries.  Each
+ * subsequent stage holds growth_factor times as many entries as the previous
+ * stage, and has tightening_ratio times its error rate.  A growth factor of 2
+ * or 4 and a tightening ratio between 0.5 and 0.9 are typical; a larger growth
+ * factor means fewer stages to query, and a larger tightening ratio means
+ * smaller stages with more hash functions.
+ *
+ * The supplied hash functions hash_function_1 and hash_function_2 should be
+ * capable of hashing an input value of arbitrary size and producing a 64 bit
+ * hashed value.  Every stage uses the same pair of hash functions.
+ *
+ * \param options                  The scalable bloom filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param initial_capacity         The number of items held by the first stage
+ *                                 of the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ * \param growth_factor            The capacity multiplier for each new stage.
+ * \param tightening_ratio         The error rate multiplier for each new stage,
+ *                                 in the range (0,1).
+ * \param hash_function_1          A hash function
+ * \param hash_function_2          A hash function
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK scalable_bloom_filter_options_init_ex(
+    scalable_bloom_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t initial_capacity, float target_error_rate,
+    unsigned int growth_factor, float tightening_ratio,
+    hash_func_t hash_function_1, hash_func_t hash_function_2);
+
+/**
+ * \brief Initialize a scalable bloom filter.
+ *
+ * Once initialized, the filter will be empty and will consist of a single
+ * stage.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::scalable_bloom_filter_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed.
+ *
+ * \param options           The scalable bloom filter options to use for this
+ *                          instance.
+ * \param bloom             The scalable bloom filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED if memory could not be
+ *        allocated for the first stage.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bitmap of the first stage.
+ */
+int VPR_DECL_MUST_CHECK scalable_bloom_filter_init(
+    scalable_bloom_filter_options_t* options, scalable_bloom_filter_t* bloom);
+
+/**
+ * \brief Add an item to a scalable bloom filter.
+ *
+ * Items which the filter already reports as present are not added again, so
+ * that duplicates do not consume capacity.  If the newest stage is full, then
+ * a new stage is added before the item is added.
+ *
+ * \param bloom             The scalable bloom filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED if memory could not be
+ *        allocated for a new stage.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bitmap of a new stage.
+ */
+int VPR_DECL_MUST_CHECK scalable_bloom_filter_add_item(
+    scalable_bloom_filter_t* bloom, const void* data, size_t len);
+
+/**
+ * \brief Query a scalable bloom filter to determine if an item has been added.
+ *
+ * \param bloom             The scalable bloom filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool scalable_bloom_filter_contains_item(
+    scalable_bloom_filter_t* bloom, const void* data, size_t len);
+
+/**
+ * \brief Get the disposable handle from a scalable bloom filter options
+ * instance.
+ *
+ * \param bloom_opts        The scalable bloom filter options instance from
+ *                          which the disposable handle is read.
+ *
+ * \returns the disposable handle for this scalable bloom filter options
+ * instance.
+ */
+VPR_INLINE disposable_t* scalable_bloom_filter_options_disposable_handle(
+    scalable_bloom_filter_options_t* bloom_opts)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(
+            MODEL_PROP_VALID_SCALABLE_BLOOM_FILTER_OPTIONS(bloom_opts));
+
+        return &(bloom_opts->hdr);
+    }
+)
+
+/**
+ * \brief Get the disposable handle from a scalable bloom filter instance.
+ *
+ * \param bloom             The scalable bloom filter instance from which the
+ *                          disposable handle is read.
+ *
+ * \returns the disposable handle for this scalable bloom filter instance.
+ */
+VPR_INLINE disposable_t* scalable_bloom_filter_disposable_handle(
+    scalable_bloom_filter_t* bloom)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_SCALABLE_BLOOM_FILTER(bloom));
+
+        return &(bloom->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_BLOOM_FILTER_SCALABLE_BLOOM_FILTER_HEADER_GUARD
@@ -0,0 +1,297 @@
+/**
+ * \file columnar_array.h
+ *
+ * \brief Columnar array, which stores each field of its rows contiguously.
+ *
+ * A columnar array holds a table of rows, with each field of the rows kept in
+ * its own column, so that a scan which reads one or two fields reads only
+ * those columns from memory instead of whole records.  Every column holds the
+ * same number of rows.  Each column starts on a \ref COLUMNAR_ARRAY_ALIGNMENT
+ * byte boundary and is padded to a multiple of that size, so that vector
+ * loops may load whole aligned vectors, including past the last row.
+ *
+ * The fields are plain data, which are copied with memcpy() and need no
+ * disposal.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_COLUMNAR_ARRAY_HEADER_GUARD
+#define VPR_COLUMNAR_ARRAY_HEADER_GUARD
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/compare.h>
+#include <vpr/disposable.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_COLUMNAR_ARRAY_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_COLUMNAR_ARRAY_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The alignment in bytes of each column, which suits the widest vector
+ * loads on the supported platforms.
+ */
+#define COLUMNAR_ARRAY_ALIGNMENT 64
+
+/**
+ * \brief A column of a columnar array.
+ */
+typedef struct columnar_array_column
+{
+    /**
+     * \brief The size of each field in the column.
+     */
+    size_t element_size;
+
+    /**
+     * \brief The fields of the column, one per row.
+     */
+    uint8_t* data;
+
+} columnar_array_column_t;
+
+/**
+ * \brief The columnar array structure.
+ */
+typedef struct columnar_array
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator used for the columns.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The number of columns.
+     */
+    size_t column_count;
+
+    /**
+     * \brief The number of rows.
+     */
+    size_t rows;
+
+    /**
+     * \brief The number of rows which fit in the columns.
+     */
+    size_t reserved_rows;
+
+    /**
+     * \brief The columns.
+     */
+    columnar_array_column_t* columns;
+
+    /**
+     * \brief The block holding every column, or NULL if no rows are reserved.
+     */
+    void* block;
+
+} columnar_array_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * columnar_array_t structure.
+ */
+#define MODEL_PROP_VALID_COLUMNAR_ARRAY(array) \
+    (NULL != array && NULL != (array)->hdr.dispose && NULL != (array)->alloc_opts && NULL != (array)->columns && (array)->column_count > 0 && (array)->rows <= (array)->reserved_rows && (NULL != (array)->block || 0 == (array)->reserved_rows))
+
+/**
+ * \brief Initialize a columnar array.
+ *
+ * The array starts out with no rows, and with room for the given number of
+ * rows.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::columnar_array_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.
+ *
+ * \param array             The columnar array to initialize.
+ * \param alloc_opts        The allocator to use for this array.
+ * \param element_sizes     The size of the field in each column.
+ * \param column_count      The number of columns.
+ * \param reserve           The number of rows to reserve, which may be 0.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT if there are no
+ *             columns, or a column has a field size of 0.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the array.
+ */
+int VPR_DECL_MUST_CHECK columnar_array_init(
+    columnar_array_t* array, allocator_options_t* alloc_opts,
+    const size_t* element_sizes, size_t column_count, size_t reserve);
+
+/**
+ * \brief Ensure that a columnar array has room for the given number of rows.
+ *
+ * If the array must grow, every column is moved to a new block, so that
+ * pointers to the columns are invalidated.
+ *
+ * \param array             The array.
+ * \param rows              The number of rows.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the larger array, in which case the array is
+ *             unchanged.
+ */
+int VPR_DECL_MUST_CHECK columnar_array_reserve(
+    columnar_array_t* array, size_t rows);
+
+/**
+ * \brief Append a row to the end of a columnar array.
+ *
+ * The array doubles its reserve size when it is full.
+ *
+ * \param array             The array.
+ * \param values            One pointer per column, to the field to copy into
+ *                          that column.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if the array was full
+ *             and could not grow, in which case the array is unchanged.
+ */
+int VPR_DECL_MUST_CHECK columnar_array_append_row(
+    columnar_array_t* array, const void* const* values);
+
+/**
+ * \brief Stable sort the rows of a columnar array by the fields of one column.
+ *
+ * The rows are ordered by the key column, and the same permutation is then
+ * applied to every other column, one column at a time.  Rows with equal keys
+ * keep their order, so that a table can be sorted by several columns in turn,
+ * from the least significant column to the most significant column.  A single
+ * scratch buffer is allocated, which holds the permutation and one column.
+ *
+ * \param array             The array to sort.
+ * \param column            The key column.
+ * \param compare           The method comparing fields of the key column.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT if the column does not
+ *             exist.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the scratch buffer, in which case the array is
+ *             unchanged.
+ */
+int VPR_DECL_MUST_CHECK columnar_array_sort_by_column(
+    columnar_array_t* array, size_t column, compare_method_t compare);
+
+/**
+ * \brief Get the number of rows in a columnar array.
+ *
+ * \param array             The array.
+ *
+ * \returns the number of rows.
+ */
+VPR_INLINE size_t columnar_array_rows(const columnar_array_t* array)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_COLUMNAR_ARRAY(array));
+
+        return array->rows;
+    }
+)
+
+/**
+ * \brief Get the fields of one column of a columnar array.
+ *
+ * The fields of the rows are contiguous, starting at a
+ * \ref COLUMNAR_ARRAY_ALIGNMENT byte boundary.  The pointer is invalidated
+ * when the array grows.
+ *
+ * \param array             The array.
+ * \param column            The number of the column.
+ *
+ * \returns a pointer to the field of the first row, or NULL if no rows are
+ *          reserved.
+ */
+VPR_INLINE void* columnar_array_column(
+    const columnar_array_t* array, size_t column)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_COLUMNAR_ARRAY(array));
+        MODEL_ASSERT(column < array->column_count);
+
+        return array->columns[column].data;
+    }
+)
+
+/**
+ * \brief Get one field of a columnar array.
+ *
+ * \param array             The array.
+ * \param column            The number of the column.
+ * \param row               The number of the row.
+ *
+ * \returns a pointer to the field, or NULL if the row is past the end of the
+ *          array.
+ */
+VPR_INLINE void* columnar_array_at(
+    const columnar_array_t* array, size_t column, size_t row)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_COLUMNAR_ARRAY(array));
+        MODEL_ASSERT(column < array->column_count);
+
+        if (row >= array->rows)
+        {
+            return NULL;
+        }
+
+        return
+            array->columns[column].data
+          + row * array->columns[column].element_size;
+    }
+)
+
+/**
+ * \brief Get the disposable handle from a columnar array.
+ *
+ * \param array             The columnar array from which the disposable
+ *                          handle is read.
+ *
+ * \returns the disposable handle for this columnar array.
+ */
+VPR_INLINE disposable_t* columnar_array_disposable_handle(
+    columnar_array_t* array)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_COLUMNAR_ARRAY(array));
+
+        return &(array->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_COLUMNAR_ARRAY_HEADER_GUARD
@@ -309,6 +309,21 @@ int compare_uint64(const void* x, const void* y, size_t size);
  */
 int compare_bool(const void* x, const void* y, size_t size);
 
+/**
+ * \brief Compare two values of any size as strings of bytes.
+ *
+ * Values are ordered as by memcmp(), so two values compare as equal only if
+ * their bytes are identical.  Searches that use this method compare several
+ * elements at once where the platform supports it.
+ *
+ * \param x             The left-hand element.
+ * \param y             The right-hand element.
+ * \param size          The size of each value.
+ *
+ * \returns (> 0 if x > y) (< 0 if x < y) (== 0 if x == y)
+ */
+int compare_bytes(const void* x, const void* y, size_t size);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -0,0 +1,366 @@
+/**
+ * \file cuckoo_filter.h
+ *
+ * \brief Cuckoo filter
+ *
+ * A cuckoo filter tests set membership like a bloom filter: false positives
+ * are possible, but false negatives are not.  Unlike a bloom filter, items can
+ * also be removed.  Each item is reduced to a short fingerprint, which is
+ * stored in one of two candidate buckets of four slots.  A query reads at most
+ * those two buckets, so it touches at most two cache lines regardless of the
+ * error rate.  For target error rates below about 3%, a cuckoo filter is
+ * smaller than the equivalent bloom filter, and a quarter the size of the
+ * equivalent counting bloom filter.
+ *
+ * See Fan, Andersen, Kaminsky and Mitzenmacher, "Cuckoo Filter: Practically
+ * Better Than Bloom", CoNEXT 2014.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_CUCKOO_FILTER_HEADER_GUARD
+#define VPR_CUCKOO_FILTER_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+#include <vpr/hash_func.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_CUCKOO_FILTER_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_CUCKOO_FILTER_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The number of fingerprint slots in each bucket.
+ */
+#define CUCKOO_FILTER_BUCKET_SIZE 4
+
+/**
+ * \brief The load factor for which the filter is sized.
+ */
+#define CUCKOO_FILTER_TARGET_LOAD_FACTOR 0.95
+
+/**
+ * \brief The default number of times an insert relocates an existing
+ * fingerprint before giving up.
+ */
+#define CUCKOO_FILTER_DEFAULT_MAX_KICKS 500
+
+/**
+ * \brief This structure contains the options used by a cuckoo filter instance.
+ *
+ * User code will create an options structure using either the
+ * cuckoo_filter_options_init() or the cuckoo_filter_options_init_ex() method
+ * declared below.  When this set of options is no longer required, it should
+ * be disposed using dispose().
+ */
+typedef struct cuckoo_filter_options
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options to use when creating a cuckoo filter.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The number of expected entries for the filter.
+     */
+    size_t num_expected_entries;
+
+    /**
+     * \brief The number of buckets in the filter, which is a power of two.
+     */
+    size_t num_buckets;
+
+    /**
+     * \brief The size of each fingerprint in bytes; one of 1, 2 or 4.
+     */
+    unsigned int fingerprint_size;
+
+    /**
+     * \brief The number of times an insert relocates an existing fingerprint
+     * before the filter is considered full.
+     */
+    unsigned int max_kicks;
+
+    /**
+     * \brief The hash function used to select the primary bucket of an item.
+     */
+    hash_func_t hash_function_1;
+
+    /**
+     * \brief The hash function used to derive the fingerprint of an item.
+     */
+    hash_func_t hash_function_2;
+
+} cuckoo_filter_options_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * cuckoo_filter_options_t structure.
+ */
+#define MODEL_PROP_VALID_CUCKOO_FILTER_OPTIONS(options) \
+    (NULL != options && NULL != (options)->hdr.dispose && NULL != (options)->alloc_opts && (options)->num_buckets > 0 && 0 == ((options)->num_buckets & ((options)->num_buckets - 1)) && (1 == (options)->fingerprint_size || 2 == (options)->fingerprint_size || 4 == (options)->fingerprint_size) && NULL != (options)->hash_function_1 && NULL != (options)->hash_function_2)
+
+/**
+ * \brief The cuckoo filter structure.
+ */
+typedef struct cuckoo_filter
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options used to create this cuckoo filter.
+     */
+    cuckoo_filter_options_t* options;
+
+    /**
+     * \brief The buckets of the filter.  Each bucket holds
+     * CUCKOO_FILTER_BUCKET_SIZE fingerprints, and an empty slot holds zero.
+     */
+    void* buckets;
+
+    /**
+     * \brief The number of fingerprints stored in the filter, including the
+     * victim.
+     */
+    size_t count;
+
+    /**
+     * \brief True if an insert ran out of kicks, leaving a fingerprint that
+     * has no slot.  Once set, the filter is full until an item is removed.
+     */
+    bool has_victim;
+
+    /**
+     * \brief The fingerprint which could not be placed.
+     */
+    uint32_t victim_fingerprint;
+
+    /**
+     * \brief One of the two candidate buckets of the victim.
+     */
+    size_t victim_index;
+
+    /**
+     * \brief The state of the generator used to choose which fingerprint to
+     * relocate.
+     */
+    uint32_t kick_state;
+
+} cuckoo_filter_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * cuckoo_filter_t structure.
+ */
+#define MODEL_PROP_VALID_CUCKOO_FILTER(filter) \
+    (NULL != filter && NULL != (filter)->hdr.dispose && NULL != (filter)->options && NULL != (filter)->buckets)
+
+/**
+ * \brief Initialize cuckoo filter options using default hash functions.
+ *
+ * Initialize the cuckoo filter options using default hash functions.  Those
+ * hash functions are sdbm and jenkins.  The num_expected_entries parameter
+ * should be an upper bound on the number of entries that will be in the
+ * filter at once.  Unlike a bloom filter, a cuckoo filter has a hard capacity;
+ * once it is full, further inserts fail.
+ *
+ * The target_error_rate is the desired rate of false positives, expressed as
+ * a percentage in the range (0,1).  It determines the fingerprint size: 1 byte
+ * for rates of about 3% and above, 2 bytes for rates down to about 0.01%, and 4
+ * bytes below that.
+ *
+ * \param options                  The cuckoo filter options to initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param num_expected_entries     The number of items that are expected to be
+ *                                 added to the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK cuckoo_filter_options_init(
+    cuckoo_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t num_expected_entries, float target_error_rate);
+
+/**
+ * \brief Initialize cuckoo filter options using user supplied hash functions.
+ *
+ * The num_expected_entries parameter should be an upper bound on the number of
+ * entries that will be in the filter at once.  The filter is sized so that
+ * this many entries fill it to CUCKOO_FILTER_TARGET_LOAD_FACTOR or less.
+ *
+ * The target_error_rate is the desired rate of false positives, expressed as
+ * a percentage in the range (0,1).  It determines the fingerprint size: 1 byte
+ * for rates of about 3% and above, 2 bytes for rates down to about 0.01%, and 4
+ * bytes below that.
+ *
+ * The supplied hash functions hash_function_1 and hash_function_2 should be
+ * capable of hashing an input value of arbitrary size and producing a 64 bit
+ * hashed value.  The first selects the primary bucket of an item, and the
+ * second derives its fingerprint, so they must be independent of each other.
+ *
+ * \param options                  The cuckoo filter options to initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param num_expected_entries     The number of items that are expected to be
+ *                                 added to the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ * \param hash_function_1          A hash function
+ * \param hash_function_2          A hash function
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int VPR_DECL_MUST_CHECK cuckoo_filter_options_init_ex(
+    cuckoo_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t num_expected_entries, float target_error_rate,
+    hash_func_t hash_function_1, hash_func_t hash_function_2);
+
+/**
+ * \brief Initialize a cuckoo filter.
+ *
+ * This method allows for the creation of a cuckoo filter.  Once initialized,
+ * the filter will be empty.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::cuckoo_filter_t instance and must dispose of it by calling dispose()
+ * when it is no longer needed.
+ *
+ * \param options           The cuckoo filter options to use for this instance.
+ * \param filter            The cuckoo filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_CUCKOO_FILTER_ALLOCATION_FAILED if memory could not
+ *        be allocated for the buckets.
+ */
+int VPR_DECL_MUST_CHECK cuckoo_filter_init(
+    cuckoo_filter_options_t* options, cuckoo_filter_t* filter);
+
+/**
+ * \brief Add an item to a cuckoo filter.
+ *
+ * An item may be added more than once, in which case it must be removed as
+ * many times before it is no longer reported.  At most
+ * 2 * CUCKOO_FILTER_BUCKET_SIZE copies of an item can be held.
+ *
+ * \param filter            The cuckoo filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_CUCKOO_FILTER_FULL if the filter is full.  The filter
+ *        is left unchanged.
+ */
+int VPR_DECL_MUST_CHECK cuckoo_filter_add_item(
+    cuckoo_filter_t* filter, const void* data, size_t len);
+
+/**
+ * \brief Query a cuckoo filter to determine if an item has been added.
+ *
+ * \param filter            The cuckoo filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool cuckoo_filter_contains_item(
+    cuckoo_filter_t* filter, const void* data, size_t len);
+
+/**
+ * \brief Remove an item from a cuckoo filter.
+ *
+ * Only items which were previously added should be removed.  Removing an item
+ * which was never added, but which shares a fingerprint and bucket with an
+ * item that was, removes that other item instead.
+ *
+ * \param filter            The cuckoo filter.
+ * \param data              The data to remove from the filter.
+ * \param len               The size of the data to remove from the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_CUCKOO_FILTER_ITEM_NOT_FOUND if the item is not in the
+ *        filter.
+ */
+int VPR_DECL_MUST_CHECK cuckoo_filter_remove_item(
+    cuckoo_filter_t* filter, const void* data, size_t len);
+
+/**
+ * \brief Get the load factor of a cuckoo filter.
+ *
+ * \param filter            The cuckoo filter.
+ *
+ * \returns the fraction of fingerprint slots which are in use.
+ */
+float cuckoo_filter_load_factor(const cuckoo_filter_t* filter);
+
+/**
+ * \brief Get the disposable handle from a cuckoo filter options instance.
+ *
+ * \param options           The cuckoo filter options instance from which the
+ *                          disposable handle is read.
+ *
+ * \returns the disposable handle for this cuckoo filter options instance.
+ */
+VPR_INLINE disposable_t* cuckoo_filter_options_disposable_handle(
+    cuckoo_filter_options_t* options)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER_OPTIONS(options));
+
+        return &(options->hdr);
+    }
+)
+
+/**
+ * \brief Get the disposable handle from a cuckoo filter instance.
+ *
+ * \param filter            The cuckoo filter instance from which the
+ *                          disposable handle is read.
+ *
+ * \returns the disposable handle for this cuckoo filter instance.
+ */
+VPR_INLINE disposable_t* cuckoo_filter_disposable_handle(
+    cuckoo_filter_t* filter)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER(filter));
+
+        return &(filter->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_CUCKOO_FILTER_HEADER_GUARD
@@ -14,6 +14,7 @@
 #define VPR_DYNAMIC_ARRAY_HEADER_GUARD
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <vpr/allocator.h>
 #include <vpr/compare.h>
@@ -61,6 +62,68 @@ typedef void (*dynamic_array_element_copy_t)(
 typedef void (*dynamic_array_element_dispose_t)(
     void* context, void* elem);
 
+/**
+ * \brief A task run by a parallel sort executor.
+ *
+ * \param context           The task context.
+ * \param index             The index of this task.
+ */
+typedef void (*dynamic_array_sort_task_t)(void* context, size_t index);
+
+/**
+ * \brief Run count tasks, possibly concurrently, and return once all of them
+ * have completed.
+ *
+ * Each task is run by calling task(task_context, i) for an index i from 0 to
+ * count - 1.
+ *
+ * \param context           The executor context.
+ * \param task              The task to run.
+ * \param task_context      The context passed to each task.
+ * \param count             The number of tasks to run.
+ */
+typedef void (*dynamic_array_sort_run_t)(
+    void* context, dynamic_array_sort_task_t task, void* task_context,
+    size_t count);
+
+/**
+ * \brief Compute the normalized key of an element for
+ * dynamic_array_radix_sort_normalized().
+ *
+ * \param context           User-defined context for the normalize method.
+ * \param element           The element.
+ * \param key               The buffer which receives the key, which must be
+ *                          ordered as by memcmp().
+ */
+typedef void (*dynamic_array_radix_normalize_t)(
+    void* context, const void* element, uint8_t* key);
+
+/**
+ * \brief An executor used by dynamic_array_sort_parallel() to run tasks.
+ *
+ * This library does not create threads itself; the executor adapts a caller's
+ * thread pool, or any other means of running tasks concurrently.
+ */
+typedef struct dynamic_array_sort_executor
+{
+    /**
+     * \brief The number of tasks to split each phase of a sort into, which is
+     * typically the number of threads available.
+     */
+    size_t concurrency;
+
+    /**
+     * \brief The method used to run the tasks of each phase.
+     */
+    dynamic_array_sort_run_t run;
+
+    /**
+     * \brief Context passed to the run method.
+     */
+    void* context;
+
+} dynamic_array_sort_executor_t;
+
 /**
  * \brief This structure contains the options used by a dynamic array instance.
  *
@@ -123,6 +186,26 @@ typedef struct dynamic_array_options
      */
     void* context;
 
+    /**
+     * \brief The factor by which dynamic_array_append() and
+     * dynamic_array_insert_at() grow a full array, or 0 if a full array should
+     * not be grown.
+     */
+    float growth_factor;
+
+    /**
+     * \brief True if elements can be copied with memcpy() and need no
+     * disposal.
+     *
+     * This is set by dynamic_array_options_init(), and cleared by
+     * dynamic_array_options_init_ex().  When it is set, the copy and dispose
+     * methods are bypassed in favor of bulk copies, and arrays are grown with
+     * reallocate().  A caller of dynamic_array_options_init_ex() may set it if
+     * its copy method is equivalent to memcpy() and its dispose method does
+     * nothing.
+     */
+    bool trivially_copyable;
+
 } dynamic_array_options_t;
 
 /**
@@ -165,8 +248,91 @@ typedef struct dynamic_array
      */
     void* array;
 
+    /**
+     * \brief The caller's inline storage, or NULL if the array has none.  The
+     * raw array points here until the array outgrows it.
+     */
+    void* inline_array;
+
+    /**
+     * \brief The number of elements which fit in the inline storage.
+     */
+    size_t inline_elements;
+
 } dynamic_array_t;
 
+/**
+ * \brief Declare a dynamic array together with inline storage for the given
+ * number of elements of the given type.
+ *
+ * A small array kept in such a declaration, on the stack or as a member of a
+ * larger structure, makes no allocation until it holds more than count
+ * elements:
+ *
+ * \code
+ * DYNAMIC_ARRAY_WITH_INLINE_STORAGE(uint32_t, 8) scratch;
+ * retval =
+ *     dynamic_array_init_inline(
+ *         &options, &scratch.array, scratch.storage, sizeof(scratch.storage));
+ * \endcode
+ */
+#define DYNAMIC_ARRAY_WITH_INLINE_STORAGE(type, count) \
+    struct { dynamic_array_t array; type storage[count]; }
+
+/**
+ * \brief A read-only search index over a sorted dynamic array.
+ *
+ * The index holds a copy of the array's elements in Eytzinger order, in which
+ * the children of the element in slot k are in slots 2k and 2k + 1.  A search
+ * descends this implicit tree without branching on the comparison result, and
+ * the first several levels share cache lines, so that far fewer cache misses
+ * occur than with a binary search of a large array.  Arrays compared by a
+ * built-in integer comparison method are indexed by integer keys, which are
+ * compared inline rather than through the comparison method.
+ *
+ * The index refers to the array, and must be rebuilt if the array changes.
+ */
+typedef struct dynamic_array_search_index
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The array which was indexed.
+     */
+    dynamic_array_t* array;
+
+    /**
+     * \brief The number of elements in the index.
+     */
+    size_t elements;
+
+    /**
+     * \brief The kind of integer key, or 0 if elements are compared with the
+     * comparison method.
+     */
+    int key_kind;
+
+    /**
+     * \brief The elements in Eytzinger order, starting at slot 1, or NULL if
+     * integer keys are used.
+     */
+    void* layout;
+
+    /**
+     * \brief The integer keys in Eytzinger order, starting at slot 1, or NULL.
+     */
+    uint64_t* keys;
+
+    /**
+     * \brief The position in the array of the element in each slot.
+     */
+    size_t* positions;
+
+} dynamic_array_search_index_t;
+
 /**
  * \brief Initialize dynamic array options for a POD data type.
  *
@@ -176,6 +342,9 @@ typedef struct dynamic_array
  * memcmp() will be used.  Please see vpr/compare.h for a set of pre-defined
  * comparison methods for most builtin C types. 0
  *
+ * The options are marked as trivially copyable, so that arrays are copied and
+ * grown in bulk rather than one element at a time.
+ *
  * When the function completes successfully, the caller owns this
  * ::dynamic_array_t instance and must dispose of it by calling dispose() when
  * it is no longer needed.
@@ -223,6 +392,28 @@ int VPR_DECL_MUST_CHECK dynamic_array_options_init_ex(
     dynamic_array_element_dispose_t dispose_method,
     compare_method_t compare_method);
 
+/**
+ * \brief Enable or disable automatic growth of arrays created with these
+ * options.
+ *
+ * By default, dynamic_array_append() fails when an array is full.  Once a
+ * growth factor is set, dynamic_array_append() instead grows a full array to
+ * growth_factor times its reserved size, so that a run of appends takes
+ * amortised constant time per element.  A factor of 2 minimises the number of
+ * copies; a factor of 1.5 wastes less reserve space.
+ *
+ * \param options           The dynamic array options to update.
+ * \param growth_factor     The growth factor, which must be greater than 1, or
+ *                          0 to disable automatic growth.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_INVALID_ARGUMENT if the growth
+ *             factor is neither 0 nor greater than 1.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_options_set_growth_factor(
+    dynamic_array_options_t* options, float growth_factor);
+
 /**
  * \brief Initialize a dynamic array.
  *
@@ -254,6 +445,38 @@ int VPR_DECL_MUST_CHECK dynamic_array_init(
     dynamic_array_options_t* options, dynamic_array_t* array,
     size_t reserve, size_t instance, void* copy);
 
+/**
+ * \brief Initialize an empty dynamic array which keeps its elements in
+ * caller-supplied inline storage until it outgrows it.
+ *
+ * No memory is allocated until an element is added to a full array, at which
+ * point the elements are moved to an allocated buffer as the array grows.
+ * dynamic_array_shrink_to_fit() moves them back if they fit again.  Adding
+ * elements beyond the inline storage requires a growth factor; see
+ * dynamic_array_options_set_growth_factor().
+ *
+ * The storage must be suitably aligned for the elements, and must outlive the
+ * array; see \ref DYNAMIC_ARRAY_WITH_INLINE_STORAGE.  Pointers to elements are
+ * invalidated when the elements move.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::dynamic_array_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.  Disposing the array does not release the storage.
+ *
+ * \param options           The dynamic array options to use for this instance.
+ * \param array             The array to initialize.
+ * \param storage           The inline storage.
+ * \param storage_size      The size of the inline storage in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INLINE_STORAGE_TOO_SMALL if the storage
+ *             cannot hold a single element.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_init_inline(
+    dynamic_array_options_t* options, dynamic_array_t* array, void* storage,
+    size_t storage_size);
+
 /**
  * \brief Request that the reserve size of the dynamic array be increased.
  *
@@ -279,10 +502,12 @@ int VPR_DECL_MUST_CHECK dynamic_array_grow(
 /**
  * \brief Append an element to the end of the dynamic array.
  *
- * If the reserved size is not large enough for this operation, then it will
- * fail.  Users should grow the array using dynamic_array_grow() to change the
- * size of this structure prior to calling this method if the reserved space has
- * been exhausted.
+ * If the reserved size is not large enough for this operation, and the array
+ * options have a growth factor set with
+ * dynamic_array_options_set_growth_factor(), then the array is grown by that
+ * factor first.  Otherwise, it will fail.  Users should grow the array using
+ * dynamic_array_grow() to change the size of this structure prior to calling
+ * this method if the reserved space has been exhausted.
  *
  * If successful, then a copy of this element will be placed at the end of this
  * array using the defined copy method.
@@ -293,33 +518,483 @@ int VPR_DECL_MUST_CHECK dynamic_array_grow(
  * \returns a status code indicating success or failure.
  *          - \ref VPR_STATUS_SUCCESS if successful.
  *          - \ref VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE if there is no
- *                 reserve room left for appending this element.
+ *                 reserve room left for appending this element, and automatic
+ *                 growth is disabled.
+ *          - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the array
+ *                 could not be grown.
  */
 int VPR_DECL_MUST_CHECK dynamic_array_append(
     dynamic_array_t* array, void* element);
 
+/**
+ * \brief Insert an element into the dynamic array at the given index.
+ *
+ * The elements from the index onward move up by one to make room.  The array
+ * grows as it does for dynamic_array_append().  Trivially copyable elements
+ * are moved with a single memmove(); otherwise each element that moves is
+ * copied with the copy method and then disposed.  The new element is copied
+ * into place, and must not be an element of this array.
+ *
+ * \param array             The array.
+ * \param index             The index of the new element, from 0 up to and
+ *                          including the number of elements in the array.
+ * \param element           The element to insert into this array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX if the index is past the
+ *             end of the array.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE if there is no reserve
+ *             room left for this element, and automatic growth is disabled.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the array
+ *             could not be grown.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_insert_at(
+    dynamic_array_t* array, size_t index, const void* element);
+
+/**
+ * \brief Erase a range of elements from the dynamic array.
+ *
+ * The elements from first up to but not including last are disposed, and the
+ * elements after them move down to close the gap, keeping their order.
+ * Trivially copyable elements are moved with a single memmove(); otherwise
+ * each element that moves is copied with the copy method and then disposed.
+ * Erasing a prefix of the array this way expires the oldest entries of a
+ * sliding window without rebuilding the array.
+ *
+ * \param array             The array.
+ * \param first             The index of the first element to erase.
+ * \param last              The index past the last element to erase.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX if first is greater than
+ *             last, or last is past the end of the array.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_erase_range(
+    dynamic_array_t* array, size_t first, size_t last);
+
+/**
+ * \brief Remove an element from the dynamic array in constant time, by moving
+ * the last element into its place.
+ *
+ * This does not keep the order of the elements, so a sorted array may need to
+ * be sorted again.
+ *
+ * \param array             The array.
+ * \param index             The index of the element to remove.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX if the index is not that
+ *             of an element in the array.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_swap_remove(
+    dynamic_array_t* array, size_t index);
+
+/**
+ * \brief Shorten the dynamic array to the given number of elements.
+ *
+ * The elements past the new end are disposed.  If the array has no more than
+ * the given number of elements, then it is unchanged.  The reserve size of the
+ * array is unchanged; see dynamic_array_shrink_to_fit().
+ *
+ * \param array             The array.
+ * \param elements          The number of elements to keep.
+ */
+void dynamic_array_truncate(dynamic_array_t* array, size_t elements);
+
+/**
+ * \brief Reduce the reserve size of the dynamic array to its number of
+ * elements.
+ *
+ * The reserve size never drops below one element.  Trivially copyable
+ * elements are moved by the allocator's reallocate() method; otherwise a new
+ * buffer is allocated and each element is copied with the copy method and then
+ * disposed, as when the array grows.  If the array has inline storage and
+ * the elements fit in it, they are moved back there, and the allocated buffer
+ * is released.
+ *
+ * \param array             The array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SHRINK_ALLOCATION_FAILED if memory could
+ *             not be allocated for the smaller array, in which case the array
+ *             is unchanged.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_shrink_to_fit(dynamic_array_t* array);
+
+/**
+ * \brief Sort modes for dynamic_array_sort_ex().
+ */
+#define DYNAMIC_ARRAY_SORT_UNSTABLE 0
+#define DYNAMIC_ARRAY_SORT_STABLE 1
+
+/**
+ * \brief Key kinds for dynamic_array_radix_sort().
+ */
+#define DYNAMIC_ARRAY_RADIX_KEY_UNSIGNED 0
+#define DYNAMIC_ARRAY_RADIX_KEY_SIGNED 1
+#define DYNAMIC_ARRAY_RADIX_KEY_FLOAT 2
+#define DYNAMIC_ARRAY_RADIX_KEY_BYTES 3
+
 /**
  * \brief Sort the given dynamic array.
  *
- * This method performs a simple merge sort using the comparison method defined
- * in the options structure.
+ * This method sorts the array in place using the comparison method defined in
+ * the options structure.  It is equivalent to dynamic_array_sort_ex() with
+ * \ref DYNAMIC_ARRAY_SORT_UNSTABLE, and only allocates memory for a temporary
+ * element when the elements are not trivially copyable.
  *
- * If successful, then the array will be sorted.  Note that this merge sort
- * implementation should not be considered a stable sort, so elements that
- * compare as equal may change relative positions as a result of this sort.
+ * If successful, then the array will be sorted.  Note that this sort is not
+ * stable, so elements that compare as equal may change relative positions as a
+ * result of this sort.
  *
  * \param array             The array to be sorted.
  *
  * \returns a status code indicating success or failure.
  *      - \ref VPR_STATUS_SUCCESS if successful.
- *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INIT_ALLOCATION_FAILED if memory
- *             allocation failed when creating a dynamic array for sorting.
  *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
- *             allocation failed during the merge sort.
+ *             allocation for the temporary element failed.
  */
 int VPR_DECL_MUST_CHECK dynamic_array_sort(
     dynamic_array_t* array);
 
+/**
+ * \brief Sort the given dynamic array using the given sort mode.
+ *
+ * With \ref DYNAMIC_ARRAY_SORT_UNSTABLE, the array is sorted in place with a
+ * pattern-defeating quicksort, which runs in O(n log n) time in the worst case
+ * and does not allocate memory for trivially copyable elements.  Elements that
+ * compare as equal may change relative positions.
+ *
+ * With \ref DYNAMIC_ARRAY_SORT_STABLE, the array is sorted with a merge sort,
+ * which preserves the relative positions of elements that compare as equal.
+ * This mode makes a single allocation of a scratch buffer holding half of the
+ * elements.
+ *
+ * In either mode, trivially copyable elements are moved by their bytes.  Other
+ * elements are moved by copying them with the copy method and then disposing
+ * of the originals, as when the array grows, and one more element is
+ * allocated to hold an element while others are moved.
+ *
+ * Trivially copyable arrays whose comparison method is one of the built-in
+ * integer or floating point comparison methods in vpr/compare.h are sorted
+ * with an in-place radix sort instead, which needs no scratch buffer.
+ * Floating point arrays are only radix sorted in unstable mode.
+ *
+ * \param array             The array to be sorted.
+ * \param mode              The sort mode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL if the sort mode is invalid.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer of a stable sort, or for the
+ *             temporary element, failed.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_sort_ex(
+    dynamic_array_t* array, int mode);
+
+/**
+ * \brief Sort the given dynamic array using several tasks at once.
+ *
+ * The array is split into executor->concurrency runs, which are sorted
+ * concurrently.  The runs are then merged pairwise, with each merge pass
+ * split evenly across executor->concurrency tasks.  Each task writes a fixed
+ * range of the output, so the result does not depend on how the executor
+ * schedules tasks.  In \ref DYNAMIC_ARRAY_SORT_STABLE mode the result is
+ * identical to that of dynamic_array_sort_ex(); in unstable mode, elements
+ * that compare as equal may be ordered differently.
+ *
+ * This method makes a single allocation of a scratch buffer the size of the
+ * array.  Elements are moved as with dynamic_array_sort_ex(); elements which
+ * are not trivially copyable are moved with the copy and dispose methods,
+ * which may then be called from several tasks at once, and the scratch buffer
+ * also holds one temporary element per task.  Since the tasks of a merge pass
+ * search runs which other tasks are merging, each pass copies its input, and
+ * only disposes it once every task of the pass has finished.  If the executor
+ * is NULL, its concurrency is less than two, or the array is small, then the
+ * array is sorted serially with dynamic_array_sort_ex().
+ *
+ * \param array             The array to be sorted.
+ * \param mode              The sort mode.
+ * \param executor          The executor used to run tasks, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL if the sort mode is invalid.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer failed.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_sort_parallel(
+    dynamic_array_t* array, int mode,
+    const dynamic_array_sort_executor_t* executor);
+
+/**
+ * \brief Stable sort the given dynamic array by a key within each element,
+ * using a radix sort.
+ *
+ * The key is width bytes at the given offset in each element.  Integer and
+ * floating point keys are in host byte order; byte string keys are ordered as
+ * by memcmp().  Floating point keys are ordered by value, except that -0.0
+ * sorts before 0.0, and NaNs sort before or after every other value according
+ * to their sign.
+ *
+ * The sort takes O(n * width) time, does not call the comparison method, and
+ * skips key bytes which every element shares.  It is stable, so that an array
+ * can be sorted by several keys in turn, from the least significant key to the
+ * most significant key.  It makes a single allocation of a scratch buffer the
+ * size of the array.  Elements which are not trivially copyable are sorted as
+ * records of their key and index, which the scratch buffer also holds, and
+ * are then moved through the scratch buffer into place with the copy and
+ * dispose methods.
+ *
+ * \param array             The array to be sorted.
+ * \param offset            The offset of the key in each element.
+ * \param width             The width of the key in bytes.
+ * \param kind              The kind of key; either
+ *                          \ref DYNAMIC_ARRAY_RADIX_KEY_UNSIGNED or
+ *                          \ref DYNAMIC_ARRAY_RADIX_KEY_SIGNED with a width of
+ *                          1, 2, 4, or 8, \ref DYNAMIC_ARRAY_RADIX_KEY_FLOAT
+ *                          with a width of 4 or 8, or
+ *                          \ref DYNAMIC_ARRAY_RADIX_KEY_BYTES with any width.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY if the key does
+ *             not fit in an element, or its width does not suit its kind.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer failed.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_radix_sort(
+    dynamic_array_t* array, size_t offset, size_t width, int kind);
+
+/**
+ * \brief Stable sort the given dynamic array by keys computed from each
+ * element, using a radix sort.
+ *
+ * The normalize method writes a key of width bytes for an element, such that
+ * the keys of two elements compare with memcmp() in the order that the
+ * elements should be sorted.  It is called once per element.
+ *
+ * The sort takes O(n * width) time, and is stable.  It makes a single
+ * allocation of a scratch buffer large enough to hold two copies of the array
+ * with a key beside each element.  Elements which are not trivially copyable
+ * are instead sorted as records of their key and index, and are then moved
+ * through the scratch buffer into place with the copy and dispose methods.
+ *
+ * \param array             The array to be sorted.
+ * \param width             The width of each normalized key in bytes.
+ * \param normalize         The method which computes the key of an element.
+ * \param context           The context passed to the normalize method.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY if the width is 0.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer failed.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_radix_sort_normalized(
+    dynamic_array_t* array, size_t width,
+    dynamic_array_radix_normalize_t normalize, void* context);
+
+/**
+ * \brief Partially order a dynamic array so that the element at the given
+ * index is the one which would be there if the array were sorted.
+ *
+ * No element before the given index is greater than that element, and no
+ * element after it is less than it; the elements on each side are otherwise
+ * in no particular order.  This is an introselect, which runs in O(n) time on
+ * average, and falls back to sorting the remaining range if its partitions
+ * are unbalanced too often, so that the worst case is O(n log n).
+ *
+ * Elements are moved as with dynamic_array_sort_ex(), so memory is only
+ * allocated for a temporary element when the elements are not trivially
+ * copyable.  If the index is past the end of the array, then the array is
+ * unchanged.
+ *
+ * \param array             The array.
+ * \param index             The index of the element to put in place.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the temporary element failed.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_nth_element(
+    dynamic_array_t* array, size_t index);
+
+/**
+ * \brief Sort the least elements of a dynamic array into its first positions.
+ *
+ * When this completes, the first count elements of the array are the least
+ * count elements, in sorted order, and the remaining elements follow in no
+ * particular order.  The least elements are first selected with
+ * dynamic_array_nth_element(), and then only they are sorted, so this runs in
+ * O(n + k log k) time on average, instead of the O(n log n) time of sorting
+ * the whole array.  The greatest elements are found with a comparison method
+ * which reverses the order.  This sort is not stable.
+ *
+ * Elements are moved as with dynamic_array_sort_ex(), so memory is only
+ * allocated for a temporary element when the elements are not trivially
+ * copyable.  If the count is not less than the number of elements, then the
+ * whole array is sorted.
+ *
+ * \param array             The array.
+ * \param count             The number of elements to sort into place.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the temporary element failed.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_partial_sort(
+    dynamic_array_t* array, size_t count);
+
+/**
+ * \brief Remove duplicate elements from a sorted dynamic array, in place.
+ *
+ * The array must be sorted by its comparison method.  Of each run of elements
+ * which compare as equal, the first is kept and the rest are disposed.  Runs
+ * of duplicates are skipped with a galloping search, and the kept elements
+ * are moved down in runs, with a single memmove() per run when the elements
+ * are trivially copyable.  The reserve size of the array is unchanged.
+ *
+ * \param array             The sorted array.
+ */
+void dynamic_array_unique(dynamic_array_t* array);
+
+/**
+ * \brief Append the elements of several sorted dynamic arrays to an output
+ * array, in sorted order.
+ *
+ * Each input array must be sorted by the comparison method of its options,
+ * which must be the same as those of the output array.  The merge is stable:
+ * elements which compare as equal keep their order within an input array, and
+ * come from earlier input arrays first.  The inputs are kept in a binary heap
+ * ordered by their next elements.  Once the least input is found, a galloping
+ * search finds the run of its elements which come before the next element of
+ * any other input, and that run is copied in bulk, so that inputs which
+ * overlap little are merged in far fewer than one comparison per element.
+ * Elements are copied into the output array with its copy method.
+ *
+ * A single buffer holding two indices per input array is allocated, and the
+ * output array is first grown to hold every element of the inputs, if it
+ * cannot already.
+ *
+ * \param output            The array to which the result is appended, which
+ *                          must not be any of the input arrays.
+ * \param inputs            The sorted input arrays.
+ * \param count             The number of input arrays.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MERGE_ALLOCATION_FAILED if memory could
+ *             not be allocated for the heap of inputs.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown.
+ *      On failure, the output array is unchanged.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_merge(
+    dynamic_array_t* output, const dynamic_array_t* const* inputs,
+    size_t count);
+
+/**
+ * \brief Append the union of two sorted dynamic arrays to an output array.
+ *
+ * The output holds each element of either array in sorted order.  An element
+ * which appears m times in the left array and n times in the right array
+ * appears max(m, n) times in the output, with the copies from the left array
+ * first.  The output array is first grown to hold every element of both
+ * arrays, if it cannot already.
+ *
+ * Both arrays must be sorted by the comparison method of their options, which
+ * must be the same as those of the output array.  Runs of elements found in
+ * only one array are measured with a galloping search, and copied in bulk
+ * when the elements are trivially copyable, so that a union of arrays of m
+ * and n elements, with m < n, takes O(m log(n / m)) comparisons.  Elements are
+ * copied into the output array with its copy method.
+ *
+ * \param output            The array to which the result is appended, which
+ *                          must not be either input array.
+ * \param left              The left-hand sorted array.
+ * \param right             The right-hand sorted array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown, in which case it is unchanged.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_set_union(
+    dynamic_array_t* output, const dynamic_array_t* left,
+    const dynamic_array_t* right);
+
+/**
+ * \brief Append the intersection of two sorted dynamic arrays to an output
+ * array.
+ *
+ * The output holds each element of the left array which is also in the right
+ * array, in sorted order.  An element which appears m times in the left array
+ * and n times in the right array appears min(m, n) times in the output.  The
+ * output array is first grown to hold every element of the smaller array, if
+ * it cannot already.
+ *
+ * Both arrays must be sorted by the comparison method of their options, which
+ * must be the same as those of the output array.  Each run of elements found
+ * in only one array is skipped with a galloping search, in O(log k)
+ * comparisons for a run of k elements, so that intersecting arrays of m and n
+ * elements, with m < n, takes O(m log(n / m)) comparisons; intersecting a
+ * small array with a large one touches only a few elements of the large one.
+ * Elements are copied into the output array with its copy method.
+ *
+ * \param output            The array to which the result is appended, which
+ *                          must not be either input array.
+ * \param left              The left-hand sorted array.
+ * \param right             The right-hand sorted array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown, in which case it is unchanged.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_set_intersection(
+    dynamic_array_t* output, const dynamic_array_t* left,
+    const dynamic_array_t* right);
+
+/**
+ * \brief Append the difference of two sorted dynamic arrays to an output
+ * array.
+ *
+ * The output holds each element of the left array which is not in the right
+ * array, in sorted order.  An element which appears m times in the left array
+ * and n times in the right array appears max(m - n, 0) times in the output.
+ * The output array is first grown to hold every element of the left array, if
+ * it cannot already.
+ *
+ * Both arrays must be sorted by the comparison method of their options, which
+ * must be the same as those of the output array.  Runs of left elements which
+ * are not in the right array are found with a galloping search, and copied in
+ * bulk when the elements are trivially copyable; runs of right elements are
+ * skipped the same way, so that removing a small array from a large one
+ * compares only a few elements of the large one.  Elements are copied into
+ * the output array with its copy method.
+ *
+ * \param output            The array to which the result is appended, which
+ *                          must not be either input array.
+ * \param left              The left-hand sorted array.
+ * \param right             The right-hand sorted array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown, in which case it is unchanged.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_set_difference(
+    dynamic_array_t* output, const dynamic_array_t* left,
+    const dynamic_array_t* right);
+
 /**
  * \brief Perform a linear search for an element matching the given key in this
  * array.
@@ -331,7 +1006,11 @@ int VPR_DECL_MUST_CHECK dynamic_array_sort(
  *
  * The search method uses the comparison method defined in the array options.
  * How the comparison occurs is up to the comparison method, so this search can
- * be used for key-value pairs.
+ * be used for key-value pairs.  If the comparison method is compare_bytes(),
+ * or a built-in integer comparison method matching the element size, then
+ * several elements are compared at once where the platform supports it.  This
+ * makes a linear search the fastest way to look up small tables of up to a few
+ * hundred elements.
  *
  * \param array             The array to be sorted.
  * \param compare_method    Optional comparison method override.
@@ -345,6 +1024,48 @@ int VPR_DECL_MUST_CHECK dynamic_array_sort(
 void* dynamic_array_linear_search(
     dynamic_array_t* array, compare_method_t compare_method, const void* elem);
 
+/**
+ * \brief Count the elements matching the given key in this array.
+ *
+ * As with dynamic_array_linear_search(), the array need not be sorted, and
+ * several elements are compared at once if the comparison method is
+ * compare_bytes() or a built-in integer comparison method matching the element
+ * size.
+ *
+ * \param array             The array to be searched.
+ * \param compare_method    Optional comparison method override.
+ * \param elem              The element to use for searching.
+ *
+ * \returns the number of matching elements.
+ */
+size_t dynamic_array_count(
+    const dynamic_array_t* array, compare_method_t compare_method,
+    const void* elem);
+
+/**
+ * \brief Find the indices of every element matching the given key in this
+ * array.
+ *
+ * As with dynamic_array_linear_search(), the array need not be sorted, and
+ * several elements are compared at once if the comparison method is
+ * compare_bytes() or a built-in integer comparison method matching the element
+ * size.  The indices of the first capacity matches are written in increasing
+ * order, and the total number of matches is returned, so a caller can size the
+ * indices array with a first call whose capacity is 0.
+ *
+ * \param array             The array to be searched.
+ * \param compare_method    Optional comparison method override.
+ * \param elem              The element to use for searching.
+ * \param indices           Set to the indices of the first matches; may be
+ *                          NULL if capacity is 0.
+ * \param capacity          The number of indices which may be written.
+ *
+ * \returns the number of matching elements.
+ */
+size_t dynamic_array_find_all(
+    const dynamic_array_t* array, compare_method_t compare_method,
+    const void* elem, size_t* indices, size_t capacity);
+
 /**
  * \brief Perform a binary search for an element matching the given key in this
  * array.
@@ -370,6 +1091,122 @@ void* dynamic_array_linear_search(
  */
 void* dynamic_array_binary_search(dynamic_array_t* array, const void* elem);
 
+/**
+ * \brief Find the index of the first element in this sorted array which is
+ * not less than the given key.
+ *
+ * The array must be sorted by its comparison method.  This search has a
+ * worst-case performance of O(log n).  Together with
+ * dynamic_array_upper_bound(), it bounds the range of elements matching a key,
+ * or the range of elements between two keys.
+ *
+ * \param array             The array to be searched.
+ * \param elem              The element to use for searching.
+ *
+ * \returns the index of the first element not less than the key, or
+ *          array->elements if there is none.
+ */
+size_t dynamic_array_lower_bound(
+    const dynamic_array_t* array, const void* elem);
+
+/**
+ * \brief Find the index of the first element in this sorted array which is
+ * greater than the given key.
+ *
+ * The array must be sorted by its comparison method.  This search has a
+ * worst-case performance of O(log n).  Together with
+ * dynamic_array_lower_bound(), it bounds the range of elements matching a key,
+ * or the range of elements between two keys.
+ *
+ * \param array             The array to be searched.
+ * \param elem              The element to use for searching.
+ *
+ * \returns the index of the first element greater than the key, or
+ *          array->elements if there is none.
+ */
+size_t dynamic_array_upper_bound(
+    const dynamic_array_t* array, const void* elem);
+
+/**
+ * \brief Find the range of elements in this sorted array which compare as
+ * equal to the given key.
+ *
+ * The array must be sorted by its comparison method.  On return, the matching
+ * elements are those with indices from *begin up to but not including *end.
+ * If no element matches, then *begin and *end are both the index at which the
+ * key would be inserted.  This search has a worst-case performance of
+ * O(log n); once the lower bound is found, the upper bound is only searched
+ * for among the remaining elements.
+ *
+ * \param array             The array to be searched.
+ * \param elem              The element to use for searching.
+ * \param begin             Set to the index of the first matching element.
+ * \param end               Set to the index past the last matching element.
+ */
+void dynamic_array_equal_range(
+    const dynamic_array_t* array, const void* elem, size_t* begin, size_t* end);
+
+/**
+ * \brief Find the lower bound of each of several sorted keys in this sorted
+ * array.
+ *
+ * The keys are count elements of the array's element size, sorted by the
+ * array's comparison method.  On return, indices[i] is the index of the first
+ * element in the array which is not less than keys[i], as returned by
+ * dynamic_array_lower_bound().
+ *
+ * The keys are walked through the array in a single pass.  Each search starts
+ * from the previous result and gallops forward in doubling steps before
+ * bisecting, so a batch of k keys over n elements costs O(k log(n / k))
+ * comparisons, and keys which fall close together cost O(1) each.  The
+ * endpoints of many time windows over a sorted array of events can be found
+ * this way in one call.
+ *
+ * \param array             The array to be searched.
+ * \param keys              The sorted keys.
+ * \param count             The number of keys.
+ * \param indices           An array of count indices, set to the lower bound
+ *                          of each key.
+ */
+void dynamic_array_lower_bound_batch(
+    const dynamic_array_t* array, const void* keys, size_t count,
+    size_t* indices);
+
+/**
+ * \brief Build a search index over a sorted dynamic array.
+ *
+ * The array must be sorted by its comparison method, and must not change while
+ * the index is in use.  The index is allocated with the array's allocator, and
+ * is owned by the caller, who must dispose of it by calling dispose().
+ *
+ * \param index             The search index to initialize.
+ * \param array             The sorted array to index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SEARCH_INDEX_ALLOCATION_FAILED if memory
+ *             could not be allocated for the index.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_search_index_init(
+    dynamic_array_search_index_t* index, dynamic_array_t* array);
+
+/**
+ * \brief Search an index for an element matching the given key.
+ *
+ * The search finds the first element in the array which compares as equal to
+ * the key, so it returns the same pointer as dynamic_array_binary_search().
+ *
+ * \param index             The search index.
+ * \param elem              The element to use for searching.
+ *
+ * \returns a pointer value.
+ *      - the first element in the array matching the provided element given
+ *        the compare method on success.
+ *      - NULL if no matching element found.
+ */
+void* dynamic_array_search_index_find(
+    const dynamic_array_search_index_t* index, const void* elem);
+
 /**
  * \brief Get the disposable handle from a dynamic array options instance.
  *
@@ -405,6 +1242,24 @@ VPR_INLINE_DEFINITION(
     }
 )
 
+/**
+ * \brief Get the disposable handle from a dynamic array search index.
+ *
+ * \param index             The search index from which the disposable handle
+ *                          is read.
+ *
+ * \returns the disposable handle for this search index.
+ */
+VPR_INLINE disposable_t* dynamic_array_search_index_disposable_handle(
+    dynamic_array_search_index_t* index)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(NULL != index);
+
+        return &(index->hdr);
+    }
+)
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
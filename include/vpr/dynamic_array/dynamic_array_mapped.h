@@ -0,0 +1,208 @@
+/**
+ * \file dynamic_array_mapped.h
+ *
+ * \brief Dynamic arrays stored in memory-mapped files.
+ *
+ * A mapped dynamic array keeps its elements in a file which is mapped into
+ * memory, so that the operating system's page cache, rather than the heap,
+ * holds them.  An array larger than memory can be appended to and searched,
+ * and a saved array is reopened without reading or copying its elements.
+ * Growing the array extends the file and remaps it; on Linux, mremap() can
+ * usually do so without moving the mapping.
+ *
+ * Only trivially copyable elements may be mapped, since they are moved and
+ * persisted by their bytes.  The file is tied to the host's byte order and
+ * element layout.
+ *
+ * The file holds a fixed size header, in host byte order, followed by the
+ * elements.
+ *
+ * | Offset | Size | Field                                            |
+ * | ------ | ---- | ------------------------------------------------ |
+ * |      0 |    8 | magic, "VPRDARR" followed by a zero byte         |
+ * |      8 |    4 | format version, currently 1                      |
+ * |     12 |    4 | header size in bytes, currently 64               |
+ * |     16 |    8 | size of each element in bytes                    |
+ * |     24 |    8 | number of elements                               |
+ * |     32 |   32 | reserved, zero                                   |
+ * |     64 |      | elements                                         |
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_DYNAMIC_ARRAY_DYNAMIC_ARRAY_MAPPED_HEADER_GUARD
+#define VPR_DYNAMIC_ARRAY_DYNAMIC_ARRAY_MAPPED_HEADER_GUARD
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+#include <vpr/dynamic_array.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_DYNAMIC_ARRAY_MAPPED_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_DYNAMIC_ARRAY_MAPPED_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The size of the header of a mapped dynamic array file.
+ */
+#define DYNAMIC_ARRAY_MAPPED_HEADER_SIZE 64
+
+/**
+ * \brief A dynamic array whose elements are stored in a memory-mapped file.
+ *
+ * The array member is an ordinary ::dynamic_array_t, which may be passed to
+ * the dynamic array functions, but not disposed on its own.  Its options are
+ * a copy of the caller's options, whose allocator is replaced with one which
+ * resizes the file, and which passes any other allocations, such as the
+ * scratch buffers used by the sorts, on to the caller's allocator.  Since the
+ * array refers to this structure, it must not be moved once initialized.
+ */
+typedef struct dynamic_array_mapped
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options of the array.
+     */
+    dynamic_array_options_t options;
+
+    /**
+     * \brief The allocator which resizes the mapped file.
+     */
+    allocator_options_t alloc_opts;
+
+    /**
+     * \brief The caller's allocator, used for any other allocations.
+     */
+    allocator_options_t* scratch_alloc_opts;
+
+    /**
+     * \brief The array, whose elements point into the mapping.
+     */
+    dynamic_array_t array;
+
+    /**
+     * \brief The descriptor of the mapped file.
+     */
+    int fd;
+
+    /**
+     * \brief The start of the mapping.
+     */
+    uint8_t* map;
+
+    /**
+     * \brief The size of the mapping in bytes.
+     */
+    size_t map_size;
+
+} dynamic_array_mapped_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * dynamic_array_mapped_t structure.
+ */
+#define MODEL_PROP_VALID_DYNAMIC_ARRAY_MAPPED(mapped) \
+    (NULL != mapped && NULL != (mapped)->hdr.dispose && NULL != (mapped)->scratch_alloc_opts && (mapped)->fd >= 0 && NULL != (mapped)->map && (mapped)->array.array == (mapped)->map + DYNAMIC_ARRAY_MAPPED_HEADER_SIZE && (mapped)->map_size == DYNAMIC_ARRAY_MAPPED_HEADER_SIZE + (mapped)->array.reserved_elements * (mapped)->options.element_size)
+
+/**
+ * \brief Open or create a dynamic array stored in a memory-mapped file.
+ *
+ * If the file is empty, as when newly created, a new empty array is written to
+ * it; otherwise, the file must hold an array with elements of the size given
+ * by the options, whose elements become the elements of the array.  The file
+ * is extended to hold at least the given reserve size.
+ *
+ * The number of elements is written to the file by
+ * dynamic_array_mapped_sync() and when the array is disposed.  Elements added
+ * since the last of these are lost if the process exits first.
+ *
+ * This function is only available on POSIX platforms.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::dynamic_array_mapped_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed, which trims the file to the size of
+ * its elements and unmaps it.
+ *
+ * \param mapped            The mapped dynamic array to initialize.
+ * \param options           The dynamic array options, which must be trivially
+ *                          copyable, and whose allocator is used for scratch
+ *                          buffers.
+ * \param path              The path of the file, which is created if it does
+ *                          not exist.
+ * \param reserve           The minimum reserve size for this array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_NOT_TRIVIALLY_COPYABLE if the
+ *             elements are not trivially copyable.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_INVALID_FORMAT if the file does
+ *             not hold an array of elements of the given size.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO if the file could not be
+ *             opened, extended, or mapped.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_mapped_init(
+    dynamic_array_mapped_t* mapped, dynamic_array_options_t* options,
+    const char* path, size_t reserve);
+
+/**
+ * \brief Write the elements and the number of elements of a mapped dynamic
+ * array to its file.
+ *
+ * The elements are flushed before the number of elements is recorded, so that
+ * the file never counts elements which have not been written.
+ *
+ * \param mapped            The mapped dynamic array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO if the mapping could not
+ *             be written to the file.
+ */
+int VPR_DECL_MUST_CHECK dynamic_array_mapped_sync(
+    dynamic_array_mapped_t* mapped);
+
+/**
+ * \brief Get the disposable handle from a mapped dynamic array instance.
+ *
+ * \param mapped            The mapped dynamic array instance from which the
+ *                          disposable handle is read.
+ *
+ * \returns the disposable handle for this mapped dynamic array instance.
+ */
+VPR_INLINE disposable_t* dynamic_array_mapped_disposable_handle(
+    dynamic_array_mapped_t* mapped)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_DYNAMIC_ARRAY_MAPPED(mapped));
+
+        return &(mapped->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_DYNAMIC_ARRAY_DYNAMIC_ARRAY_MAPPED_HEADER_GUARD
@@ -41,13 +41,13 @@ extern "C" {
 #define VPR_ERROR_DYNAMIC_ARRAY_INIT_ALLOCATION_FAILED 0x1101
 
 /**
- * \brief This error code is returned by dynamic_array_sort() when a general
+ * \brief This error code is returned by dynamic_array_sort_ex() when a general
  * error occurs.
  */
 #define VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL 0x1102
 
 /**
- * \brief This error code is returned by dynamic_array_sort() when memory
+ * \brief This error code is returned by dynamic_array_sort_ex() when memory
  * allocation fails.
  */
 #define VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED 0x1103
@@ -76,6 +76,62 @@ extern "C" {
  */
 #define VPR_ERROR_BUMP_ALLOCATOR_TINY_BUFFER 0x1107
 
+/**
+ * \brief This error code is returned by dynamic_array_radix_sort() when the key
+ * does not fit in an element, or its width does not suit its kind.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY 0x1108
+
+/**
+ * \brief This error code is returned by dynamic_array_search_index_init() when
+ * memory could not be allocated for the index.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_SEARCH_INDEX_ALLOCATION_FAILED 0x1109
+
+/**
+ * \brief This error code is returned by dynamic_array_insert_at(),
+ * dynamic_array_erase_range(), and dynamic_array_swap_remove() when an index
+ * is outside of the array.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX 0x110A
+
+/**
+ * \brief This error code is returned by dynamic_array_shrink_to_fit() when
+ * memory could not be allocated for the smaller array.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_SHRINK_ALLOCATION_FAILED 0x110B
+
+/**
+ * \brief This error code is returned by dynamic_array_init_inline() when the
+ * inline storage cannot hold a single element.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_INLINE_STORAGE_TOO_SMALL 0x110C
+
+/**
+ * \brief This error code is returned by dynamic_array_mapped_init() when the
+ * elements are not trivially copyable.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_MAPPED_NOT_TRIVIALLY_COPYABLE 0x110D
+
+/**
+ * \brief This error code is returned by dynamic_array_mapped_init() when the
+ * file does not hold an array of elements of the expected size.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_MAPPED_INVALID_FORMAT 0x110E
+
+/**
+ * \brief This error code is returned by dynamic_array_mapped_init() and
+ * dynamic_array_mapped_sync() when the file could not be opened, resized,
+ * mapped, or written.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO 0x110F
+
+/**
+ * \brief This error code is returned by dynamic_array_merge() when memory
+ * could not be allocated for the cursors over the input arrays.
+ */
+#define VPR_ERROR_DYNAMIC_ARRAY_MERGE_ALLOCATION_FAILED 0x1110
+
 /**
  * \brief This error code is returned by doubly_linked_list_insert_after()
  * when memory could not be allocated for a new element.
@@ -119,6 +175,59 @@ extern "C" {
  */
 #define VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED 0x1300
 
+/**
+ * \brief This error code is returned by counting_bloom_filter_init() when
+ * memory could not be allocated for the counters of the filter.
+ */
+#define VPR_ERROR_BLOOM_COUNTER_ALLOCATION_FAILED 0x1301
+
+/**
+ * \brief This error code is returned by counting_bloom_filter_remove_item()
+ * when the item to remove is not present in the filter.
+ */
+#define VPR_ERROR_BLOOM_REMOVE_ITEM_NOT_FOUND 0x1302
+
+/**
+ * \brief This error code is returned by scalable_bloom_filter_init() and
+ * scalable_bloom_filter_add_item() when memory could not be allocated for a
+ * new stage of the filter.
+ */
+#define VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED 0x1303
+
+/**
+ * \brief This error code is returned by bloom_filter_union() and
+ * bloom_filter_intersect() when the two filters differ in size or in hash
+ * functions.
+ */
+#define VPR_ERROR_BLOOM_INCOMPATIBLE_FILTERS 0x1304
+
+/**
+ * \brief This error code is returned by bloom_filter_serialize() when the
+ * output buffer is too small to hold the serialized filter.
+ */
+#define VPR_ERROR_BLOOM_SERIALIZE_BUFFER_TOO_SMALL 0x1305
+
+/**
+ * \brief This error code is returned when a bloom filter is serialized with a
+ * hash function that has no serialized identifier, or a serialized filter
+ * names a hash function that is unknown.
+ */
+#define VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION 0x1306
+
+/**
+ * \brief This error code is returned by bloom_filter_init_from_buffer() and
+ * bloom_filter_mapped_init() when the serialized filter is truncated, has a
+ * bad magic number or version, or is misaligned.
+ */
+#define VPR_ERROR_BLOOM_INVALID_FORMAT 0x1307
+
+/**
+ * \brief This error code is returned by bloom_filter_save() and
+ * bloom_filter_mapped_init() when the filter file could not be read, written,
+ * or mapped.
+ */
+#define VPR_ERROR_BLOOM_FILE_IO 0x1308
+
 
 /**
  * \brief This error code is returned by hashmap_init() when memory could not
@@ -195,6 +304,115 @@ extern "C" {
  */
 #define VPR_ERROR_UUID_CONVERSION_FAILED 0x1601
 
+/**
+ * \brief This error code is returned by cuckoo_filter_init() when memory could
+ * not be allocated for the buckets of the filter.
+ */
+#define VPR_ERROR_CUCKOO_FILTER_ALLOCATION_FAILED 0x1700
+
+/**
+ * \brief This error code is returned by cuckoo_filter_add_item() when the
+ * filter is full.
+ */
+#define VPR_ERROR_CUCKOO_FILTER_FULL 0x1701
+
+/**
+ * \brief This error code is returned by cuckoo_filter_remove_item() when the
+ * item to remove is not present in the filter.
+ */
+#define VPR_ERROR_CUCKOO_FILTER_ITEM_NOT_FOUND 0x1702
+
+/**
+ * \brief This error code is returned by binary_fuse_filter_init() when memory
+ * could not be allocated for the filter or for building it.
+ */
+#define VPR_ERROR_BINARY_FUSE_FILTER_ALLOCATION_FAILED 0x1800
+
+/**
+ * \brief This error code is returned by binary_fuse_filter_init() when the
+ * keys could not be peeled with any seed.
+ */
+#define VPR_ERROR_BINARY_FUSE_FILTER_BUILD_FAILED 0x1801
+
+/**
+ * \brief This error code is returned by binary_fuse_filter_init() when there
+ * are more keys than a filter can hold.
+ */
+#define VPR_ERROR_BINARY_FUSE_FILTER_TOO_MANY_ENTRIES 0x1802
+
+/**
+ * \brief This error code is returned by binary_fuse_filter_serialize() when
+ * the output buffer is too small to hold the serialized filter.
+ */
+#define VPR_ERROR_BINARY_FUSE_FILTER_SERIALIZE_BUFFER_TOO_SMALL 0x1803
+
+/**
+ * \brief This error code is returned when a binary fuse filter is serialized
+ * with a hash function that has no serialized identifier, or a serialized
+ * filter names a hash function that is unknown.
+ */
+#define VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION 0x1804
+
+/**
+ * \brief This error code is returned by binary_fuse_filter_init_from_buffer()
+ * and binary_fuse_filter_mapped_init() when the serialized filter is
+ * truncated, inconsistent, has a bad magic number or version, or is
+ * misaligned.
+ */
+#define VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT 0x1805
+
+/**
+ * \brief This error code is returned by binary_fuse_filter_save() and
+ * binary_fuse_filter_mapped_init() when the filter file could not be read,
+ * written, or mapped.
+ */
+#define VPR_ERROR_BINARY_FUSE_FILTER_FILE_IO 0x1806
+
+/**
+ * \brief This error code is returned by segmented_array_init() and
+ * segmented_array_append() when memory could not be allocated for the
+ * directory or for a segment.
+ */
+#define VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED 0x1900
+
+/**
+ * \brief This error code is returned by segmented_array_init() when the number
+ * of elements per segment is not a power of two.
+ */
+#define VPR_ERROR_SEGMENTED_ARRAY_INVALID_SEGMENT_SIZE 0x1901
+
+/**
+ * \brief This error code is returned by columnar_array_init(),
+ * columnar_array_reserve(), columnar_array_append_row(), and
+ * columnar_array_sort_by_column() when memory could not be allocated.
+ */
+#define VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED 0x1A00
+
+/**
+ * \brief This error code is returned by columnar_array_init() when there are
+ * no columns or a column has a field size of 0, and by
+ * columnar_array_sort_by_column() when the key column does not exist.
+ */
+#define VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT 0x1A01
+
+/**
+ * \brief This error code is returned by priority_queue_init() and
+ * priority_queue_init_from_array() when memory could not be allocated.
+ */
+#define VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED 0x1B00
+
+/**
+ * \brief This error code is returned by priority_queue_init() and
+ * priority_queue_init_from_array() when the arity is 1.
+ */
+#define VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY 0x1B01
+
+/**
+ * \brief This error code is returned by priority_queue_pop() and
+ * priority_queue_replace_top() when the queue is empty.
+ */
+#define VPR_ERROR_PRIORITY_QUEUE_EMPTY 0x1B02
+
 /**
  * @}
  */
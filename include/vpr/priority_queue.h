@@ -0,0 +1,278 @@
+/**
+ * \file priority_queue.h
+ *
+ * \brief Priority queue, kept as a d-ary heap in a dynamic array.
+ *
+ * A priority queue keeps its elements in a ::dynamic_array_t, arranged as an
+ * implicit heap in which each element has up to d children and is no greater
+ * than any of them, so that the least element is always first.  Pushing and
+ * popping an element take O(d log n / log d) comparisons, and an existing
+ * array is arranged into a heap in O(n) time.  A heap with more children per
+ * element is shallower, and the children of an element share cache lines, so
+ * that a 4-ary heap is often faster than a binary heap for large queues.
+ *
+ * Elements are ordered by the comparison method of the dynamic array options;
+ * a queue which pops its greatest element first is made with a comparison
+ * method which reverses the order.  Elements are copied into the queue with
+ * the copy method.  Within the queue, trivially copyable elements are moved by
+ * their bytes, and other elements are moved by copying them and disposing of
+ * the originals, as by dynamic_array_sort().
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_PRIORITY_QUEUE_HEADER_GUARD
+#define VPR_PRIORITY_QUEUE_HEADER_GUARD
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+#include <vpr/dynamic_array.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_PRIORITY_QUEUE_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_PRIORITY_QUEUE_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The number of children of each element, when it is not given.
+ */
+#define PRIORITY_QUEUE_DEFAULT_ARITY 4
+
+/**
+ * \brief The priority queue structure.
+ */
+typedef struct priority_queue
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The elements, in heap order.
+     */
+    dynamic_array_t array;
+
+    /**
+     * \brief The number of children of each element.
+     */
+    size_t arity;
+
+    /**
+     * \brief Room for one element, which holds the element being moved.
+     */
+    uint8_t* temp;
+
+} priority_queue_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * priority_queue_t structure.
+ */
+#define MODEL_PROP_VALID_PRIORITY_QUEUE(queue) \
+    (NULL != queue && NULL != (queue)->hdr.dispose && NULL != (queue)->array.options && NULL != (queue)->array.options->dynamic_array_element_compare && (queue)->arity >= 2 && NULL != (queue)->temp)
+
+/**
+ * \brief Initialize an empty priority queue.
+ *
+ * The queue can hold the given number of elements; beyond that, pushing an
+ * element grows the queue by the growth factor of the options, and fails if
+ * there is none.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::priority_queue_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.
+ *
+ * \param options           The dynamic array options to use for this queue.
+ * \param queue             The priority queue to initialize.
+ * \param arity             The number of children of each element, which must
+ *                          be at least 2, or 0 for
+ *                          \ref PRIORITY_QUEUE_DEFAULT_ARITY.
+ * \param reserve           The reserve size for this queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY if the arity is 1.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED if memory could not
+ *             be allocated for the queue.
+ */
+int VPR_DECL_MUST_CHECK priority_queue_init(
+    dynamic_array_options_t* options, priority_queue_t* queue, size_t arity,
+    size_t reserve);
+
+/**
+ * \brief Initialize a priority queue from the elements of a dynamic array.
+ *
+ * The elements are arranged into a heap in place, in O(n) time.  On success,
+ * the queue takes over the array, which must no longer be used or disposed by
+ * the caller; on failure, the array is unchanged and still owned by the
+ * caller.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::priority_queue_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.
+ *
+ * \param queue             The priority queue to initialize.
+ * \param array             The array whose elements fill the queue.
+ * \param arity             The number of children of each element, which must
+ *                          be at least 2, or 0 for
+ *                          \ref PRIORITY_QUEUE_DEFAULT_ARITY.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY if the arity is 1.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED if memory could not
+ *             be allocated for the queue.
+ */
+int VPR_DECL_MUST_CHECK priority_queue_init_from_array(
+    priority_queue_t* queue, dynamic_array_t* array, size_t arity);
+
+/**
+ * \brief Push a copy of an element onto a priority queue.
+ *
+ * \param queue             The priority queue.
+ * \param element           The element to copy into the queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - a non-zero error code from dynamic_array_append() if the queue is
+ *        full and could not grow, in which case the queue is unchanged.
+ */
+int VPR_DECL_MUST_CHECK priority_queue_push(
+    priority_queue_t* queue, const void* element);
+
+/**
+ * \brief Push a copy of an element onto a priority queue which keeps only the
+ * greatest elements pushed onto it.
+ *
+ * While the queue holds fewer than limit elements, the element is pushed as by
+ * priority_queue_push().  Once the queue is full, the element replaces the
+ * least element of the queue if it is greater, and is otherwise ignored.  The
+ * queue then holds the greatest limit elements of a stream of n elements,
+ * found in O(n log limit) time and O(limit) space, and popping them returns
+ * them in ascending order.  The least elements of a stream are kept with a
+ * comparison method which reverses the order.
+ *
+ * \param queue             The priority queue.
+ * \param element           The element to copy into the queue.
+ * \param limit             The greatest number of elements to keep, which must
+ *                          be at least 1.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful, whether or not the element was
+ *             kept.
+ *      - a non-zero error code from dynamic_array_append() if the queue is
+ *        not yet full but could not grow, in which case the queue is
+ *        unchanged.
+ */
+int VPR_DECL_MUST_CHECK priority_queue_push_bounded(
+    priority_queue_t* queue, const void* element, size_t limit);
+
+/**
+ * \brief Remove the least element of a priority queue.
+ *
+ * If an output element is given, the removed element is moved there, as
+ * elements are moved within the queue, and the caller takes ownership of it;
+ * otherwise, it is disposed.
+ *
+ * \param queue             The priority queue.
+ * \param element           Set to the removed element, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_EMPTY if the queue is empty.
+ */
+int VPR_DECL_MUST_CHECK priority_queue_pop(
+    priority_queue_t* queue, void* element);
+
+/**
+ * \brief Replace the least element of a priority queue with a copy of another
+ * element.
+ *
+ * This is equivalent to popping and then pushing, but restores the heap only
+ * once, which suits keeping the greatest k of a stream of elements in a queue
+ * of size k.  The replaced element is disposed.
+ *
+ * \param queue             The priority queue.
+ * \param element           The element to copy into the queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_EMPTY if the queue is empty.
+ */
+int VPR_DECL_MUST_CHECK priority_queue_replace_top(
+    priority_queue_t* queue, const void* element);
+
+/**
+ * \brief Get the number of elements in a priority queue.
+ *
+ * \param queue             The priority queue.
+ *
+ * \returns the number of elements.
+ */
+VPR_INLINE size_t priority_queue_size(const priority_queue_t* queue)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+
+        return queue->array.elements;
+    }
+)
+
+/**
+ * \brief Get the least element of a priority queue, without removing it.
+ *
+ * \param queue             The priority queue.
+ *
+ * \returns a pointer to the least element, or NULL if the queue is empty.
+ */
+VPR_INLINE void* priority_queue_top(const priority_queue_t* queue)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+
+        return 0 == queue->array.elements ? NULL : queue->array.array;
+    }
+)
+
+/**
+ * \brief Get the disposable handle from a priority queue.
+ *
+ * \param queue             The priority queue from which the disposable
+ *                          handle is read.
+ *
+ * \returns the disposable handle for this priority queue.
+ */
+VPR_INLINE disposable_t* priority_queue_disposable_handle(
+    priority_queue_t* queue)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+
+        return &(queue->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_PRIORITY_QUEUE_HEADER_GUARD
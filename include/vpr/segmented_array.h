@@ -0,0 +1,266 @@
+/**
+ * \file segmented_array.h
+ *
+ * \brief Segmented array with stable element addresses.
+ *
+ * A segmented array stores its elements in fixed-size segments, found through
+ * a directory of segment pointers.  Appending to a full array allocates one
+ * more segment, and never moves the existing elements, so growth takes the
+ * same time at any size and a pointer to an element stays valid until the
+ * array is disposed.  Only the directory, which holds one pointer per segment,
+ * is ever reallocated.  Since each segment holds a power of two elements,
+ * indexing costs one shift, one mask, and two loads.
+ *
+ * Element size, copy, dispose, and comparison methods are taken from a
+ * ::dynamic_array_options_t instance.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_SEGMENTED_ARRAY_HEADER_GUARD
+#define VPR_SEGMENTED_ARRAY_HEADER_GUARD
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+#include <vpr/dynamic_array.h>
+#include <vpr/error_codes.h>
+#include <vpr/function_decl.h>
+
+/* define the following macro only if we are extracting concrete implementations
+ * for inline functions.
+ */
+#if defined(VPR_SEGMENTED_ARRAY_CONCRETE_IMPLEMENTATION)
+# define VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+#include <vpr/inline_support.h>
+
+#if defined(VPR_SEGMENTED_ARRAY_CONCRETE_IMPLEMENTATION)
+# undef VPR_CONCRETE_IMPLEMENTATION
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The size in bytes of each segment, when the number of elements per
+ * segment is not given.
+ */
+#define SEGMENTED_ARRAY_DEFAULT_SEGMENT_SIZE 4096
+
+/**
+ * \brief The segmented array structure.
+ */
+typedef struct segmented_array
+{
+    /**
+     * \brief This structure is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options used to create this array.
+     */
+    dynamic_array_options_t* options;
+
+    /**
+     * \brief The base two logarithm of the number of elements per segment.
+     */
+    unsigned int segment_shift;
+
+    /**
+     * \brief The number of elements in the array.
+     */
+    size_t elements;
+
+    /**
+     * \brief The number of segments allocated.
+     */
+    size_t segments;
+
+    /**
+     * \brief The number of segment pointers the directory can hold.
+     */
+    size_t directory_size;
+
+    /**
+     * \brief The directory of segments.
+     */
+    uint8_t** directory;
+
+} segmented_array_t;
+
+/**
+ * \brief This macro defines the model check property for a valid
+ * segmented_array_t structure.
+ */
+#define MODEL_PROP_VALID_SEGMENTED_ARRAY(array) \
+    (NULL != array && NULL != (array)->hdr.dispose && NULL != (array)->options && NULL != (array)->directory && (array)->segments <= (array)->directory_size && (array)->elements <= ((size_t)(array)->segments << (array)->segment_shift))
+
+/**
+ * \brief Initialize a segmented array.
+ *
+ * The array starts out empty.  The number of elements per segment must be a
+ * power of two; if it is 0, then each segment holds as many elements as fit
+ * in \ref SEGMENTED_ARRAY_DEFAULT_SEGMENT_SIZE bytes, rounded down to a power
+ * of two, and at least one.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::segmented_array_t instance and must dispose of it by calling dispose()
+ * when it is no longer needed.
+ *
+ * \param options           The dynamic array options to use for this array.
+ * \param array             The segmented array to initialize.
+ * \param segment_elements  The number of elements per segment, or 0.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_SEGMENTED_ARRAY_INVALID_SEGMENT_SIZE if the number of
+ *             elements per segment is not a power of two.
+ *      - \ref VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the directory.
+ */
+int VPR_DECL_MUST_CHECK segmented_array_init(
+    dynamic_array_options_t* options, segmented_array_t* array,
+    size_t segment_elements);
+
+/**
+ * \brief Append an element to the end of the segmented array.
+ *
+ * The element is copied into place with the copy method of the options, or
+ * with memcpy() if the elements are trivially copyable.  If the last segment
+ * is full, a new segment is allocated first; no existing element is moved.
+ *
+ * \param array             The array.
+ * \param element           The element to append to this array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for a new segment, or for a larger directory.
+ */
+int VPR_DECL_MUST_CHECK segmented_array_append(
+    segmented_array_t* array, const void* element);
+
+/**
+ * \brief Get the number of elements in each segment of a segmented array.
+ *
+ * \param array             The array.
+ *
+ * \returns the number of elements per segment.
+ */
+VPR_INLINE size_t segmented_array_segment_elements(
+    const segmented_array_t* array)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_SEGMENTED_ARRAY(array));
+
+        return (size_t)1 << array->segment_shift;
+    }
+)
+
+/**
+ * \brief Get the element at the given index of a segmented array.
+ *
+ * The returned pointer remains valid until the array is disposed.
+ *
+ * \param array             The array.
+ * \param index             The index of the element.
+ *
+ * \returns a pointer to the element, or NULL if the index is past the end of
+ *          the array.
+ */
+VPR_INLINE void* segmented_array_at(
+    const segmented_array_t* array, size_t index)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_SEGMENTED_ARRAY(array));
+
+        if (index >= array->elements)
+        {
+            return NULL;
+        }
+
+        size_t mask = ((size_t)1 << array->segment_shift) - 1;
+
+        return
+            array->directory[index >> array->segment_shift]
+          + (index & mask) * array->options->element_size;
+    }
+)
+
+/**
+ * \brief Get the elements of one segment of a segmented array.
+ *
+ * The segments are numbered from 0, and each one holds a contiguous run of
+ * elements, so the whole array can be visited one run at a time:
+ *
+ * \code
+ * void* elems;
+ * size_t count;
+ * for (size_t s = 0; NULL != (elems = segmented_array_segment(a, s, &count));
+ *      ++s)
+ * {
+ *     ... visit count elements starting at elems ...
+ * }
+ * \endcode
+ *
+ * \param array             The array.
+ * \param segment           The number of the segment.
+ * \param count             Set to the number of elements in the segment.
+ *
+ * \returns a pointer to the first element of the segment, or NULL if the
+ *          segment holds no elements.
+ */
+VPR_INLINE void* segmented_array_segment(
+    const segmented_array_t* array, size_t segment, size_t* count)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_SEGMENTED_ARRAY(array));
+        MODEL_ASSERT(NULL != count);
+
+        size_t first = segment << array->segment_shift;
+        if (
+            segment >= array->segments
+         || first >= array->elements)
+        {
+            *count = 0;
+            return NULL;
+        }
+
+        size_t remaining = array->elements - first;
+        size_t per_segment = (size_t)1 << array->segment_shift;
+        *count = remaining < per_segment ? remaining : per_segment;
+
+        return array->directory[segment];
+    }
+)
+
+/**
+ * \brief Get the disposable handle from a segmented array.
+ *
+ * \param array             The segmented array from which the disposable
+ *                          handle is read.
+ *
+ * \returns the disposable handle for this segmented array.
+ */
+VPR_INLINE disposable_t* segmented_array_disposable_handle(
+    segmented_array_t* array)
+VPR_INLINE_DEFINITION(
+    {
+        MODEL_ASSERT(MODEL_PROP_VALID_SEGMENTED_ARRAY(array));
+
+        return &(array->hdr);
+    }
+)
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VPR_SEGMENTED_ARRAY_HEADER_GUARD
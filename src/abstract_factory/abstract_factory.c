@@ -95,26 +95,7 @@ void abstract_factory_register(abstract_factory_registration_t* impl)
     if (!abstract_factory_instantiated || abstract_factory_failure)
         return;
 
-    /* grow the registry if we need more space */
-    if (abstract_factory_registry.elements ==
-        abstract_factory_registry.reserved_elements)
-    {
-/* CBMC can't currently handle dynamic array growing. */
-#ifndef CBMC
-        /* if we can't grow the abstract factory, then registration fails. */
-        if (VPR_STATUS_SUCCESS !=
-            dynamic_array_grow(
-                &abstract_factory_registry,
-                abstract_factory_registry.reserved_elements + VPR_ABSTRACT_FACTORY_REGISTRY_ELEMENT_GROW_SIZE))
-        {
-            return;
-        }
-#else /* !CBMC */
-        return;
-#endif
-    }
-
-    /* register this instance */
+    /* register this instance, growing the registry if it is full. */
     int retval = dynamic_array_append(&abstract_factory_registry, &impl);
     if (VPR_STATUS_SUCCESS != retval)
     {
@@ -147,6 +128,16 @@ static void abstract_factory_init_one_shot()
                 &interface_impl_feature_compare))
             return;
 
+/* CBMC can't currently handle dynamic array growing. */
+#ifndef CBMC
+        /* grow the registry geometrically as implementations register. */
+        if (VPR_STATUS_SUCCESS !=
+            dynamic_array_options_set_growth_factor(
+                &abstract_factory_array_options,
+                VPR_ABSTRACT_FACTORY_REGISTRY_GROWTH_FACTOR))
+            return;
+#endif /* !CBMC */
+
         /* initialize the array */
         if (VPR_STATUS_SUCCESS !=
             dynamic_array_init(
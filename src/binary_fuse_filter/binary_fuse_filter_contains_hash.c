@@ -0,0 +1,43 @@
+/**
+ * \file binary_fuse_filter_contains_hash.c
+ *
+ * Implementation of binary_fuse_filter_contains_hash.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "binary_fuse_filter_internal.h"
+
+/**
+ * \brief Query a binary fuse filter to determine if a key hash is in the set.
+ *
+ * The hash must be computed in the same way as the hashes used to build the
+ * filter; either by the hash function in the options, or by the caller if the
+ * filter was built from key hashes.
+ *
+ * \param filter            The binary fuse filter.
+ * \param hash              The key hash to query the filter for.
+ *
+ * \returns a boolean value indicating if the hash is present in the filter.
+ */
+_Bool binary_fuse_filter_contains_hash(
+    const binary_fuse_filter_t* filter, uint64_t hash)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter));
+
+    uint64_t mixed = binary_fuse_filter_mix(hash, filter->seed);
+
+    /* the three slots of a member xor to its fingerprint. */
+    uint32_t fp =
+        binary_fuse_filter_fingerprint(filter, mixed)
+            ^ binary_fuse_filter_get(
+                filter, binary_fuse_filter_slot(filter, mixed, 0))
+            ^ binary_fuse_filter_get(
+                filter, binary_fuse_filter_slot(filter, mixed, 1))
+            ^ binary_fuse_filter_get(
+                filter, binary_fuse_filter_slot(filter, mixed, 2));
+
+    return 0 == fp;
+}
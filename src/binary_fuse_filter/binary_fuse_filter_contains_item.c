@@ -0,0 +1,44 @@
+/**
+ * \file binary_fuse_filter_contains_item.c
+ *
+ * Implementation of binary_fuse_filter_contains_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/binary_fuse_filter.h>
+
+/**
+ * \brief Query a binary fuse filter to determine if an item is in the set.
+ *
+ * If the filter was built from key hashes, then data must be a uint64_t key
+ * hash, and len must be the size of a uint64_t.
+ *
+ * \param filter            The binary fuse filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool binary_fuse_filter_contains_item(
+    const binary_fuse_filter_t* filter, const void* data, size_t len)
+{
+    uint64_t hash;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter));
+    MODEL_ASSERT(NULL != data);
+
+    if (NULL != filter->options->hash_function)
+    {
+        hash = filter->options->hash_function(data, len);
+    }
+    else
+    {
+        MODEL_ASSERT(sizeof(uint64_t) == len);
+        memcpy(&hash, data, sizeof(uint64_t));
+    }
+
+    return binary_fuse_filter_contains_hash(filter, hash);
+}
@@ -0,0 +1,85 @@
+/**
+ * \file binary_fuse_filter_encode_header.c
+ *
+ * Implementation of binary_fuse_filter_encode_header.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+
+#include "binary_fuse_filter_internal.h"
+
+/* forward decls for internal methods */
+static void encode_le(uint8_t* out, uint64_t val, size_t size);
+
+/**
+ * \brief Encode the serialized header for a binary fuse filter.
+ *
+ * \param filter            The binary fuse filter.
+ * \param header            A buffer of
+ *                          BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE bytes to
+ *                          receive the header.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the filter
+ *        uses a hash function which cannot be serialized.
+ */
+int binary_fuse_filter_encode_header(
+    const binary_fuse_filter_t* filter, uint8_t* header)
+{
+    uint32_t id;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter));
+    MODEL_ASSERT(NULL != header);
+
+    const binary_fuse_filter_options_t* options = filter->options;
+
+    /* map the hash function to its serialized identifier. */
+    if (NULL == options->hash_function)
+    {
+        id = BINARY_FUSE_FILTER_HASH_ID_NONE;
+    }
+    else if (&sdbm == options->hash_function)
+    {
+        id = BINARY_FUSE_FILTER_HASH_ID_SDBM;
+    }
+    else if (&jenkins == options->hash_function)
+    {
+        id = BINARY_FUSE_FILTER_HASH_ID_JENKINS;
+    }
+    else
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION;
+    }
+
+    memset(header, 0, BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE);
+    memcpy(header, BINARY_FUSE_FILTER_SERIALIZED_MAGIC, 8);
+    encode_le(header + 8, BINARY_FUSE_FILTER_SERIALIZED_VERSION, 4);
+    encode_le(header + 12, BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE, 4);
+    encode_le(header + 16, filter->seed, 8);
+    encode_le(header + 24, filter->num_entries, 8);
+    encode_le(header + 32, filter->segment_length, 4);
+    encode_le(header + 36, filter->segment_count, 4);
+    encode_le(header + 40, options->fingerprint_size, 4);
+    encode_le(header + 44, id, 4);
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Encode an unsigned value in little-endian byte order.
+ *
+ * \param out               The buffer to receive the value.
+ * \param val               The value to encode.
+ * \param size              The number of bytes to write.
+ */
+static void encode_le(uint8_t* out, uint64_t val, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        out[i] = (uint8_t)(val >> (8 * i));
+    }
+}
@@ -0,0 +1,440 @@
+/**
+ * \file binary_fuse_filter_init.c
+ *
+ * Implementation of binary_fuse_filter_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <cbmc/model_assert.h>
+
+#include "binary_fuse_filter_internal.h"
+
+/* forward decls for internal methods */
+static void binary_fuse_filter_layout(
+    binary_fuse_filter_t* filter, uint32_t size);
+static int binary_fuse_filter_populate(
+    binary_fuse_filter_t* filter, const uint64_t* keys, uint32_t size,
+    void* scratch);
+static int compare_key(const void* x, const void* y);
+static uint64_t next_seed(uint64_t* state);
+static void binary_fuse_filter_dispose(void*);
+
+/**
+ * \brief Build a binary fuse filter from an array of keys.
+ *
+ * Every element of the keys array is added to the filter.  If the options have
+ * a hash function, then each element is hashed over the element size of the
+ * array.  Otherwise, the element size must be that of a uint64_t, and each
+ * element is a key hash.
+ *
+ * The filter does not reference the array once built.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::binary_fuse_filter_t instance and must dispose of it by calling dispose()
+ * when it is no longer needed.
+ *
+ * \param options           The binary fuse filter options to use for this
+ *                          instance.
+ * \param filter            The binary fuse filter to build.
+ * \param keys              The array of keys to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_TOO_MANY_ENTRIES if the array has
+ *        more than BINARY_FUSE_FILTER_MAX_ENTRIES elements.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_ALLOCATION_FAILED if memory could
+ *        not be allocated for the filter or for building it.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_BUILD_FAILED if no seed could be
+ *        found for which the keys could be peeled.
+ */
+int binary_fuse_filter_init(
+    binary_fuse_filter_options_t* options, binary_fuse_filter_t* filter,
+    const dynamic_array_t* keys)
+{
+    int retval;
+
+    MODEL_ASSERT(NULL != filter);
+    MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER_OPTIONS(options));
+    MODEL_ASSERT(NULL != keys);
+    MODEL_ASSERT(
+        NULL != options->hash_function
+     || sizeof(uint64_t) == keys->options->element_size);
+
+    if (keys->elements > BINARY_FUSE_FILTER_MAX_ENTRIES)
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_TOO_MANY_ENTRIES;
+    }
+
+    uint32_t size = (uint32_t)keys->elements;
+    filter->options = options;
+    binary_fuse_filter_layout(filter, size);
+
+    size_t fingerprints_size =
+        binary_fuse_filter_fingerprints_size(
+            options->fingerprint_size, filter->array_length);
+    filter->fingerprints = allocate(options->alloc_opts, fingerprints_size);
+    if (NULL == filter->fingerprints)
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_ALLOCATION_FAILED;
+    }
+
+    /* slots which no key is peeled into stay zero, as does the padding. */
+    MODEL_EXEMPT(memset(filter->fingerprints, 0, fingerprints_size));
+
+    /* a single scratch block holds the key hashes followed by the working
+     * arrays of binary_fuse_filter_populate(), widest elements first. */
+    uint32_t block = 2;
+    while (block < filter->segment_count)
+    {
+        block *= 2;
+    }
+
+    size_t scratch_size =
+        sizeof(uint64_t) * ((size_t)size + size + 1 + filter->array_length)
+      + sizeof(uint32_t) * ((size_t)filter->array_length + block)
+      + filter->array_length + size;
+    uint64_t* hashes = (uint64_t*)allocate(options->alloc_opts, scratch_size);
+    if (NULL == hashes)
+    {
+        retval = VPR_ERROR_BINARY_FUSE_FILTER_ALLOCATION_FAILED;
+        goto release_fingerprints;
+    }
+
+    /* hash every key. */
+    const uint8_t* elements = (const uint8_t*)keys->array;
+    size_t element_size = keys->options->element_size;
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        if (NULL != options->hash_function)
+        {
+            hashes[i] =
+                options->hash_function(elements + i * element_size,
+                    element_size);
+        }
+        else
+        {
+            memcpy(&hashes[i], elements + i * element_size, sizeof(uint64_t));
+        }
+    }
+
+    /* peeling fails for keys which share a hash, so drop duplicates. */
+    uint32_t distinct = 0;
+    if (size > 0)
+    {
+        qsort(hashes, size, sizeof(uint64_t), &compare_key);
+
+        distinct = 1;
+        for (uint32_t i = 1; i < size; ++i)
+        {
+            if (hashes[i] != hashes[distinct - 1])
+            {
+                hashes[distinct++] = hashes[i];
+            }
+        }
+    }
+
+    retval =
+        binary_fuse_filter_populate(filter, hashes, distinct, hashes + size);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        goto release_scratch;
+    }
+
+    filter->hdr.dispose = &binary_fuse_filter_dispose;
+    filter->num_entries = distinct;
+
+    release(options->alloc_opts, hashes);
+
+    return VPR_STATUS_SUCCESS;
+
+release_scratch:
+    release(options->alloc_opts, hashes);
+
+release_fingerprints:
+    release(options->alloc_opts, filter->fingerprints);
+
+    return retval;
+}
+
+/**
+ * \brief Size the segments and the fingerprint array of a filter.
+ *
+ * The segment length and the number of slots per key are those recommended
+ * for three-wise binary fuse filters by Graf and Lemire.
+ *
+ * \param filter            The binary fuse filter.
+ * \param size              The number of keys in the filter.
+ */
+static void binary_fuse_filter_layout(
+    binary_fuse_filter_t* filter, uint32_t size)
+{
+    const uint32_t max_segment_length = 262144;
+    uint32_t segment_length = 4;
+    uint32_t capacity = 0;
+
+    if (size > 0)
+    {
+        segment_length =
+            (uint32_t)1 << (int)floor(log((double)size) / log(3.33) + 2.25);
+        if (segment_length > max_segment_length)
+        {
+            segment_length = max_segment_length;
+        }
+    }
+
+    if (size > 1)
+    {
+        double size_factor =
+            fmax(1.125, 0.875 + 0.25 * log(1000000.0) / log((double)size));
+        capacity = (uint32_t)round((double)size * size_factor);
+    }
+
+    /* the first slot of a key lies in one of segment_count segments, and the
+     * other two slots in the two segments following it. */
+    uint32_t segments = (capacity + segment_length - 1) / segment_length;
+
+    filter->segment_length = segment_length;
+    filter->segment_length_mask = segment_length - 1;
+    filter->segment_count = segments > 2 ? segments - 2 : 1;
+    filter->segment_count_length = filter->segment_count * segment_length;
+    filter->array_length = (filter->segment_count + 2) * segment_length;
+}
+
+/**
+ * \brief Assign the fingerprints of a filter by peeling its keys.
+ *
+ * Each key is added to the counts of its three slots.  A slot which is used by
+ * exactly one key determines the fingerprint of that key, so that key can be
+ * removed from its other slots and pushed on a stack.  If every key is peeled
+ * this way, then the fingerprints are assigned in the reverse order of
+ * peeling.  Otherwise, a new seed is tried.
+ *
+ * \param filter            The binary fuse filter.
+ * \param keys              The distinct key hashes.
+ * \param size              The number of key hashes.
+ * \param scratch           Working memory sized by binary_fuse_filter_init().
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_BUILD_FAILED if no seed could be
+ *        found for which the keys could be peeled.
+ */
+static int binary_fuse_filter_populate(
+    binary_fuse_filter_t* filter, const uint64_t* keys, uint32_t size,
+    void* scratch)
+{
+    uint32_t capacity = filter->array_length;
+    uint32_t block_bits = 1;
+    while (((uint32_t)1 << block_bits) < filter->segment_count)
+    {
+        ++block_bits;
+    }
+    uint32_t block = (uint32_t)1 << block_bits;
+
+    /* reverse_order first holds the mixed hashes, sorted by segment so that
+     * the counts are updated in nearly sequential order, and then the stack
+     * of peeled hashes.  Each count holds the number of keys using its slot
+     * above the xor of the positions of this slot in those keys. */
+    uint64_t* reverse_order = (uint64_t*)scratch;
+    uint64_t* t2hash = reverse_order + size + 1;
+    uint32_t* alone = (uint32_t*)(t2hash + capacity);
+    uint32_t* start_pos = alone + capacity;
+    uint8_t* t2count = (uint8_t*)(start_pos + block);
+    uint8_t* reverse_h = t2count + capacity;
+
+    uint64_t seed_state = UINT64_C(0x726b2b9d438b9d4d);
+    uint32_t h012[5];
+
+    for (int attempt = 0; ; ++attempt)
+    {
+        if (attempt >= BINARY_FUSE_FILTER_MAX_ATTEMPTS)
+        {
+            return VPR_ERROR_BINARY_FUSE_FILTER_BUILD_FAILED;
+        }
+
+        filter->seed = next_seed(&seed_state);
+        MODEL_EXEMPT(memset(reverse_order, 0, sizeof(uint64_t) * size));
+        MODEL_EXEMPT(memset(t2hash, 0, sizeof(uint64_t) * capacity));
+        MODEL_EXEMPT(memset(t2count, 0, capacity));
+
+        /* the sentinel stops the search for a free position below. */
+        reverse_order[size] = 1;
+        for (uint32_t i = 0; i < block; ++i)
+        {
+            start_pos[i] = (uint32_t)(((uint64_t)i * size) >> block_bits);
+        }
+
+        bool error = false;
+        for (uint32_t i = 0; i < size && !error; ++i)
+        {
+            uint64_t hash = binary_fuse_filter_mix(keys[i], filter->seed);
+
+            /* zero marks a free position, so it cannot be a hash. */
+            if (0 == hash)
+            {
+                error = true;
+                continue;
+            }
+
+            uint64_t segment = hash >> (64 - block_bits);
+            while (0 != reverse_order[start_pos[segment]])
+            {
+                segment = (segment + 1) & (block - 1);
+            }
+
+            reverse_order[start_pos[segment]] = hash;
+            ++start_pos[segment];
+        }
+
+        for (uint32_t i = 0; i < size && !error; ++i)
+        {
+            uint64_t hash = reverse_order[i];
+
+            for (unsigned int which = 0; which < 3; ++which)
+            {
+                uint32_t slot = binary_fuse_filter_slot(filter, hash, which);
+
+                t2count[slot] += 4;
+                t2count[slot] ^= (uint8_t)which;
+                t2hash[slot] ^= hash;
+
+                /* the count is six bits wide; stop if it wrapped. */
+                error = error || t2count[slot] < 4;
+            }
+        }
+
+        if (error)
+        {
+            continue;
+        }
+
+        /* queue every slot which is used by exactly one key. */
+        uint32_t queue_size = 0;
+        for (uint32_t i = 0; i < capacity; ++i)
+        {
+            alone[queue_size] = i;
+            queue_size += (t2count[i] >> 2) == 1 ? 1 : 0;
+        }
+
+        uint32_t stack_size = 0;
+        while (queue_size > 0)
+        {
+            uint32_t index = alone[--queue_size];
+            if ((t2count[index] >> 2) != 1)
+            {
+                continue;
+            }
+
+            /* the only key in this slot is its hash, and its position in
+             * this slot is the xor of positions. */
+            uint64_t hash = t2hash[index];
+            uint8_t found = t2count[index] & 3;
+            h012[0] = binary_fuse_filter_slot(filter, hash, 0);
+            h012[1] = binary_fuse_filter_slot(filter, hash, 1);
+            h012[2] = binary_fuse_filter_slot(filter, hash, 2);
+            h012[3] = h012[0];
+            h012[4] = h012[1];
+
+            reverse_h[stack_size] = found;
+            reverse_order[stack_size] = hash;
+            ++stack_size;
+
+            /* remove the key from its two other slots. */
+            for (uint8_t k = 1; k < 3; ++k)
+            {
+                uint32_t other = h012[found + k];
+                uint8_t position = (uint8_t)((found + k) % 3);
+
+                alone[queue_size] = other;
+                queue_size += (t2count[other] >> 2) == 2 ? 1 : 0;
+
+                t2count[other] -= 4;
+                t2count[other] ^= position;
+                t2hash[other] ^= hash;
+            }
+        }
+
+        if (stack_size == size)
+        {
+            break;
+        }
+    }
+
+    /* each key is assigned the fingerprint of its peeled slot after every key
+     * peeled later, which shares its other slots, has been assigned. */
+    for (uint32_t i = size; i-- > 0; )
+    {
+        uint64_t hash = reverse_order[i];
+        uint8_t found = reverse_h[i];
+        h012[0] = binary_fuse_filter_slot(filter, hash, 0);
+        h012[1] = binary_fuse_filter_slot(filter, hash, 1);
+        h012[2] = binary_fuse_filter_slot(filter, hash, 2);
+        h012[3] = h012[0];
+        h012[4] = h012[1];
+
+        binary_fuse_filter_set(
+            filter, h012[found],
+            binary_fuse_filter_fingerprint(filter, hash)
+                ^ binary_fuse_filter_get(filter, h012[found + 1])
+                ^ binary_fuse_filter_get(filter, h012[found + 2]));
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Compare two key hashes for sorting.
+ *
+ * \param x                 The first key hash.
+ * \param y                 The second key hash.
+ *
+ * \returns less than, equal to, or greater than zero as x is less than, equal
+ * to, or greater than y.
+ */
+static int compare_key(const void* x, const void* y)
+{
+    uint64_t left = *(const uint64_t*)x;
+    uint64_t right = *(const uint64_t*)y;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * \brief Generate the next seed to try.
+ *
+ * Seeds come from a splitmix64 sequence with a fixed start, so that a build
+ * always produces the same filter for the same set of keys.
+ *
+ * \param state             The state of the sequence.
+ *
+ * \returns the next seed.
+ */
+static uint64_t next_seed(uint64_t* state)
+{
+    uint64_t z = (*state += UINT64_C(0x9e3779b97f4a7c15));
+
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+
+    return z ^ (z >> 31);
+}
+
+/**
+ * Dispose of a binary fuse filter.
+ *
+ * \param pfilter       An opaque pointer to the binary fuse filter.
+ */
+static void binary_fuse_filter_dispose(void* pfilter)
+{
+    MODEL_ASSERT(NULL != pfilter);
+
+    binary_fuse_filter_t* filter = (binary_fuse_filter_t*)pfilter;
+
+    MODEL_ASSERT(NULL != filter->options);
+    MODEL_ASSERT(NULL != filter->fingerprints);
+
+    release(filter->options->alloc_opts, filter->fingerprints);
+}
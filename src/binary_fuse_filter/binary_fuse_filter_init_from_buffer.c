@@ -0,0 +1,160 @@
+/**
+ * \file binary_fuse_filter_init_from_buffer.c
+ *
+ * Implementation of binary_fuse_filter_init_from_buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "binary_fuse_filter_internal.h"
+
+/* forward decls for internal methods */
+static uint64_t decode_le(const uint8_t* in, size_t size);
+static void binary_fuse_filter_borrowed_dispose(void*);
+
+/**
+ * \brief Initialize a binary fuse filter in place from a serialized buffer.
+ *
+ * The options are read from the buffer header, and the fingerprints of the
+ * filter point directly into the buffer; nothing is copied.  The buffer must be
+ * aligned to eight bytes, and must outlive both the filter and the options.
+ *
+ * When the function completes successfully, the caller owns the options and
+ * the filter, and must dispose of both when they are no longer needed.
+ * Disposing of them does not release the buffer.
+ *
+ * \param options           The binary fuse filter options to initialize.
+ * \param filter            The binary fuse filter to initialize.
+ * \param alloc_opts        The allocator options to record in the options.
+ * \param buffer            The serialized binary fuse filter.
+ * \param size              The size of the buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT if the buffer does
+ *        not hold a valid serialized filter.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the
+ *        serialized filter names an unknown hash function.
+ */
+int binary_fuse_filter_init_from_buffer(
+    binary_fuse_filter_options_t* options, binary_fuse_filter_t* filter,
+    allocator_options_t* alloc_opts, const void* buffer, size_t size)
+{
+    hash_func_t hash_function;
+
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != filter);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != buffer);
+
+    const uint8_t* in = (const uint8_t*)buffer;
+
+    if (size < BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE
+     || 0 != ((uintptr_t)buffer % sizeof(uint64_t)))
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT;
+    }
+
+    /* verify the magic number, version, and header size. */
+    if (0 != memcmp(in, BINARY_FUSE_FILTER_SERIALIZED_MAGIC, 8)
+     || BINARY_FUSE_FILTER_SERIALIZED_VERSION != decode_le(in + 8, 4)
+     || BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE != decode_le(in + 12, 4))
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT;
+    }
+
+    uint64_t seed = decode_le(in + 16, 8);
+    uint64_t num_entries = decode_le(in + 24, 8);
+    uint64_t segment_length = decode_le(in + 32, 4);
+    uint64_t segment_count = decode_le(in + 36, 4);
+    uint64_t fingerprint_size = decode_le(in + 40, 4);
+
+    /* the segment length must be a power of two no larger than 2^18, so that
+     * every slot lies within the fingerprints that follow the header. */
+    uint64_t array_length = (segment_count + 2) * segment_length;
+    if (0 == segment_length || segment_length > 262144
+     || 0 != (segment_length & (segment_length - 1))
+     || 0 == segment_count || array_length > UINT32_MAX
+     || num_entries > BINARY_FUSE_FILTER_MAX_ENTRIES
+     || (1 != fingerprint_size && 2 != fingerprint_size)
+     || binary_fuse_filter_fingerprints_size(
+            fingerprint_size, (uint32_t)array_length)
+                > size - BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE)
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT;
+    }
+
+    switch (decode_le(in + 44, 4))
+    {
+        case BINARY_FUSE_FILTER_HASH_ID_NONE:
+            hash_function = NULL;
+            break;
+
+        case BINARY_FUSE_FILTER_HASH_ID_SDBM:
+            hash_function = &sdbm;
+            break;
+
+        case BINARY_FUSE_FILTER_HASH_ID_JENKINS:
+            hash_function = &jenkins;
+            break;
+
+        default:
+            return VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION;
+    }
+
+    options->hdr.dispose = &binary_fuse_filter_borrowed_dispose;
+    options->alloc_opts = alloc_opts;
+    options->fingerprint_size = fingerprint_size;
+    options->hash_function = hash_function;
+
+    /* the filter borrows the fingerprints from the buffer. */
+    filter->hdr.dispose = &binary_fuse_filter_borrowed_dispose;
+    filter->options = options;
+    filter->seed = seed;
+    filter->num_entries = num_entries;
+    filter->segment_length = (uint32_t)segment_length;
+    filter->segment_length_mask = (uint32_t)segment_length - 1;
+    filter->segment_count = (uint32_t)segment_count;
+    filter->segment_count_length =
+        (uint32_t)segment_count * (uint32_t)segment_length;
+    filter->array_length = (uint32_t)array_length;
+    filter->fingerprints =
+        (uint8_t*)(in + BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE);
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Decode an unsigned little-endian value.
+ *
+ * \param in                The buffer holding the value.
+ * \param size              The number of bytes to read.
+ *
+ * \returns the decoded value.
+ */
+static uint64_t decode_le(const uint8_t* in, size_t size)
+{
+    uint64_t val = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        val |= (uint64_t)in[i] << (8 * i);
+    }
+
+    return val;
+}
+
+/**
+ * Dispose of options or a filter which borrow their storage from a buffer.
+ * Nothing special needs to be done.
+ *
+ * \param pdisp             Opaque pointer to the structure.
+ */
+static void binary_fuse_filter_borrowed_dispose(void* UNUSED(pdisp))
+{
+    MODEL_ASSERT(NULL != pdisp);
+}
@@ -0,0 +1,162 @@
+/**
+ * \file binary_fuse_filter_internal.h
+ *
+ * \brief Internal helpers shared by the binary fuse filter implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_BINARY_FUSE_FILTER_INTERNAL_HEADER_GUARD
+#define VPR_BINARY_FUSE_FILTER_INTERNAL_HEADER_GUARD
+
+#include <vpr/binary_fuse_filter.h>
+
+/**
+ * \brief Mix a key hash with the seed of a filter.
+ *
+ * This is the finalizer of murmur3, which spreads every input bit over every
+ * output bit.
+ *
+ * \param key               The key hash.
+ * \param seed              The seed of the filter.
+ *
+ * \returns the mixed hash.
+ */
+static inline uint64_t binary_fuse_filter_mix(uint64_t key, uint64_t seed)
+{
+    uint64_t h = key + seed;
+
+    h ^= h >> 33;
+    h *= UINT64_C(0xff51afd7ed558ccd);
+    h ^= h >> 33;
+    h *= UINT64_C(0xc4ceb9fe1a85ec53);
+    h ^= h >> 33;
+
+    return h;
+}
+
+/**
+ * \brief Get the fingerprint of a mixed hash.
+ *
+ * \param filter            The binary fuse filter.
+ * \param hash              The mixed hash.
+ *
+ * \returns the fingerprint.
+ */
+static inline uint32_t binary_fuse_filter_fingerprint(
+    const binary_fuse_filter_t* filter, uint64_t hash)
+{
+    uint32_t fp = (uint32_t)(hash ^ (hash >> 32));
+
+    return 1 == filter->options->fingerprint_size ? fp & 0xFF : fp & 0xFFFF;
+}
+
+/**
+ * \brief Get one of the three slots of a mixed hash.
+ *
+ * The first slot lies in one of the first segment_count segments, chosen from
+ * the high bits of the hash.  The second and third slots lie in the next two
+ * segments, at offsets chosen from the low bits of the hash.
+ *
+ * \param filter            The binary fuse filter.
+ * \param hash              The mixed hash.
+ * \param which             The slot to get; 0, 1, or 2.
+ *
+ * \returns the index of the slot.
+ */
+static inline uint32_t binary_fuse_filter_slot(
+    const binary_fuse_filter_t* filter, uint64_t hash, unsigned int which)
+{
+    /* the high 64 bits of hash * segment_count_length, computed without a
+     * 128-bit type so that this works on 32-bit targets. */
+    uint64_t scl = filter->segment_count_length;
+    uint64_t h =
+        ((hash >> 32) * scl + (((hash & UINT32_C(0xFFFFFFFF)) * scl) >> 32))
+            >> 32;
+
+    /* the segment length is at most 2^18, so three 18-bit offsets fit in the
+     * low 36 bits; the first slot uses none of them. */
+    uint64_t low = hash & ((UINT64_C(1) << 36) - 1);
+    h += which * filter->segment_length;
+    h ^= (low >> (36 - 18 * which)) & filter->segment_length_mask;
+
+    return (uint32_t)h;
+}
+
+/**
+ * \brief Read a fingerprint from the fingerprint array.
+ *
+ * \param filter            The binary fuse filter.
+ * \param index             The slot to read.
+ *
+ * \returns the fingerprint in this slot.
+ */
+static inline uint32_t binary_fuse_filter_get(
+    const binary_fuse_filter_t* filter, uint32_t index)
+{
+    const uint8_t* fp = filter->fingerprints;
+
+    if (1 == filter->options->fingerprint_size)
+    {
+        return fp[index];
+    }
+
+    return (uint32_t)fp[2 * index] | ((uint32_t)fp[2 * index + 1] << 8);
+}
+
+/**
+ * \brief Write a fingerprint to the fingerprint array.
+ *
+ * \param filter            The binary fuse filter.
+ * \param index             The slot to write.
+ * \param val               The fingerprint to write.
+ */
+static inline void binary_fuse_filter_set(
+    binary_fuse_filter_t* filter, uint32_t index, uint32_t val)
+{
+    uint8_t* fp = filter->fingerprints;
+
+    if (1 == filter->options->fingerprint_size)
+    {
+        fp[index] = (uint8_t)val;
+    }
+    else
+    {
+        fp[2 * index] = (uint8_t)val;
+        fp[2 * index + 1] = (uint8_t)(val >> 8);
+    }
+}
+
+/**
+ * \brief Get the size of the fingerprint array, padded to eight bytes.
+ *
+ * \param fingerprint_size  The size of each fingerprint.
+ * \param array_length      The number of fingerprints.
+ *
+ * \returns the padded size of the fingerprint array in bytes.
+ */
+static inline size_t binary_fuse_filter_fingerprints_size(
+    size_t fingerprint_size, uint32_t array_length)
+{
+    return
+        (fingerprint_size * array_length + sizeof(uint64_t) - 1)
+            & ~(sizeof(uint64_t) - 1);
+}
+
+/**
+ * \brief Encode the serialized header for a binary fuse filter.
+ *
+ * \param filter            The binary fuse filter.
+ * \param header            A buffer of
+ *                          BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE bytes to
+ *                          receive the header.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the filter
+ *        uses a hash function which cannot be serialized.
+ */
+int binary_fuse_filter_encode_header(
+    const binary_fuse_filter_t* filter, uint8_t* header);
+
+#endif  //VPR_BINARY_FUSE_FILTER_INTERNAL_HEADER_GUARD
@@ -0,0 +1,36 @@
+/**
+ * \file binary_fuse_filter_options_init.c
+ *
+ * Implementation of binary_fuse_filter_options_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/binary_fuse_filter.h>
+
+/**
+ * \brief Initialize binary fuse filter options using the default hash
+ * function.
+ *
+ * The default hash function is sdbm.
+ *
+ * \param options                  The binary fuse filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param target_error_rate        The desired error rate for false positives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int binary_fuse_filter_options_init(
+    binary_fuse_filter_options_t* options, allocator_options_t* alloc_opts,
+    float target_error_rate)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(target_error_rate > 0 && target_error_rate < 1.0);
+
+    return binary_fuse_filter_options_init_ex(
+        options, alloc_opts, target_error_rate, &sdbm);
+}
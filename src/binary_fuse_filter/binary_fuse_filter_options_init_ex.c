@@ -0,0 +1,64 @@
+/**
+ * \file binary_fuse_filter_options_init_ex.c
+ *
+ * Implementation of binary_fuse_filter_options_init_ex.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/binary_fuse_filter.h>
+#include <vpr/parameters.h>
+
+/* forward decls for internal methods */
+static void binary_fuse_filter_simple_dispose(void*);
+
+/**
+ * \brief Initialize binary fuse filter options using a user supplied hash
+ * function.
+ *
+ * The target_error_rate is the desired rate of false positives, expressed as
+ * a percentage in the range (0,1).  It determines the fingerprint size: 1 byte
+ * for rates of about 0.4% and above, and 2 bytes below that.
+ *
+ * The supplied hash function should be capable of hashing an input value of
+ * arbitrary size and producing a 64 bit hashed value.  If it is NULL, then
+ * every key must be a uint64_t holding a well distributed hash of the key,
+ * which lets the caller hash keys in whatever way suits them.
+ *
+ * \param options                  The binary fuse filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param target_error_rate        The desired error rate for false positives.
+ * \param hash_function            A hash function, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int binary_fuse_filter_options_init_ex(
+    binary_fuse_filter_options_t* options, allocator_options_t* alloc_opts,
+    float target_error_rate, hash_func_t hash_function)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(target_error_rate > 0 && target_error_rate < 1.0);
+
+    options->hdr.dispose = &binary_fuse_filter_simple_dispose;
+    options->alloc_opts = alloc_opts;
+    options->hash_function = hash_function;
+
+    /* a non-member matches with probability 2^-f for f fingerprint bits. */
+    options->fingerprint_size = target_error_rate >= 1.0 / 256 ? 1 : 2;
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of the options structure.  Nothing special needs to be done.
+ *
+ * \param poptions          Opaque pointer to the options structure.
+ */
+static void binary_fuse_filter_simple_dispose(void* UNUSED(poptions))
+{
+    MODEL_ASSERT(poptions != NULL);
+}
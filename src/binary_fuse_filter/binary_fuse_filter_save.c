@@ -0,0 +1,67 @@
+/**
+ * \file binary_fuse_filter_save.c
+ *
+ * Implementation of binary_fuse_filter_save.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <stdio.h>
+#include <cbmc/model_assert.h>
+
+#include "binary_fuse_filter_internal.h"
+
+/**
+ * \brief Save a binary fuse filter to a file.
+ *
+ * The file is written in the same format as binary_fuse_filter_serialize(),
+ * without making an intermediate copy of the fingerprints.
+ *
+ * \param filter            The binary fuse filter to save.
+ * \param path              The path of the file to create or replace.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the filter
+ *        uses a hash function which cannot be serialized.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_FILE_IO if the file could not be
+ *        written.
+ */
+int binary_fuse_filter_save(
+    const binary_fuse_filter_t* filter, const char* path)
+{
+    int retval;
+    uint8_t header[BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE];
+
+    MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter));
+    MODEL_ASSERT(NULL != path);
+
+    retval = binary_fuse_filter_encode_header(filter, header);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    FILE* fp = fopen(path, "wb");
+    if (NULL == fp)
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_FILE_IO;
+    }
+
+    /* the padded fingerprints follow the header directly. */
+    size_t fingerprints_size =
+        binary_fuse_filter_fingerprints_size(
+            filter->options->fingerprint_size, filter->array_length);
+    if (1 != fwrite(header, sizeof(header), 1, fp)
+     || 1 != fwrite(filter->fingerprints, fingerprints_size, 1, fp))
+    {
+        retval = VPR_ERROR_BINARY_FUSE_FILTER_FILE_IO;
+    }
+
+    if (0 != fclose(fp))
+    {
+        retval = VPR_ERROR_BINARY_FUSE_FILTER_FILE_IO;
+    }
+
+    return retval;
+}
@@ -0,0 +1,58 @@
+/**
+ * \file binary_fuse_filter_serialize.c
+ *
+ * Implementation of binary_fuse_filter_serialize.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+
+#include "binary_fuse_filter_internal.h"
+
+/**
+ * \brief Serialize a binary fuse filter to a buffer.
+ *
+ * \param filter            The binary fuse filter to serialize.
+ * \param buffer            The buffer to which the filter is written.
+ * \param size              The size of the buffer, which must be at least
+ *                          binary_fuse_filter_serialized_size() bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_SERIALIZE_BUFFER_TOO_SMALL if the
+ *        buffer is too small.
+ *      - \ref VPR_ERROR_BINARY_FUSE_FILTER_UNKNOWN_HASH_FUNCTION if the filter
+ *        uses a hash function which cannot be serialized.
+ */
+int binary_fuse_filter_serialize(
+    const binary_fuse_filter_t* filter, void* buffer, size_t size)
+{
+    int retval;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter));
+    MODEL_ASSERT(NULL != buffer);
+
+    if (size < binary_fuse_filter_serialized_size(filter))
+    {
+        return VPR_ERROR_BINARY_FUSE_FILTER_SERIALIZE_BUFFER_TOO_SMALL;
+    }
+
+    uint8_t* out = (uint8_t*)buffer;
+    retval = binary_fuse_filter_encode_header(filter, out);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the fingerprints are always stored little-endian, so they are copied
+     * as-is along with their zero padding. */
+    MODEL_EXEMPT(
+        memcpy(out + BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE,
+            filter->fingerprints,
+            binary_fuse_filter_fingerprints_size(
+                filter->options->fingerprint_size, filter->array_length)));
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file binary_fuse_filter_serialized_size.c
+ *
+ * Implementation of binary_fuse_filter_serialized_size.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "binary_fuse_filter_internal.h"
+
+/**
+ * \brief Get the number of bytes needed to serialize a binary fuse filter.
+ *
+ * \param filter            The binary fuse filter.
+ *
+ * \returns the size of the serialized binary fuse filter in bytes.
+ */
+size_t binary_fuse_filter_serialized_size(const binary_fuse_filter_t* filter)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BINARY_FUSE_FILTER(filter));
+
+    return
+        BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE
+      + binary_fuse_filter_fingerprints_size(
+            filter->options->fingerprint_size, filter->array_length);
+}
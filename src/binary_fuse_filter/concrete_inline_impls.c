@@ -0,0 +1,12 @@
+/**
+ * \file binary_fuse_filter/concrete_inline_impls.c
+ *
+ * \brief Provide concrete implementations for inline functions for debug-time
+ * linkage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#define VPR_BINARY_FUSE_FILTER_CONCRETE_IMPLEMENTATION
+
+#include <vpr/binary_fuse_filter.h>
@@ -0,0 +1,66 @@
+/**
+ * \file bloom_filter_add_item_concurrent.c
+ *
+ * Implementation of bloom_filter_add_item_concurrent.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter.h>
+
+/**
+ * \brief Add an item to a bloom filter that is shared between threads.
+ *
+ * Each bit is set with an atomic fetch-or on the machine word that holds it,
+ * so any number of threads may add items to the same filter concurrently
+ * without losing bits, and without external locking.  Bits which are already
+ * set are not written again, which keeps contended cache lines shared.
+ *
+ * Concurrent adds may be freely mixed with calls to
+ * bloom_filter_contains_item_concurrent(), but not with calls to
+ * bloom_filter_add_item() or bloom_filter_contains_item().  Once all writers
+ * have been joined, the filter may be queried with the ordinary functions.
+ *
+ * \param bloom             The bloom filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int bloom_filter_add_item_concurrent(
+    bloom_filter_t* bloom, const void* data, size_t len)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != data);
+    MODEL_ASSERT(len > 0);
+
+    uintptr_t* words = (uintptr_t*)bloom->bitmap;
+
+    for (unsigned int n = 0; n < bloom->options->num_hash_functions; n++)
+    {
+        unsigned int hash_val = bloom_filter_hash(
+            bloom->options, data, len, n);
+
+        /* build a mask for this bit in the word that holds its byte.  Going
+         * through a byte array keeps the bitmap layout the same as
+         * bloom_filter_add_item() regardless of endianness. */
+        size_t byte_offset = hash_val / 8;
+        uint8_t mask_bytes[sizeof(uintptr_t)] = { 0 };
+        uintptr_t mask;
+        mask_bytes[byte_offset % sizeof(uintptr_t)] = 1 << (hash_val % 8);
+        memcpy(&mask, mask_bytes, sizeof(mask));
+
+        uintptr_t* word = words + byte_offset / sizeof(uintptr_t);
+
+        /* avoid dirtying the cache line if the bit is already set. */
+        if (!(__atomic_load_n(word, __ATOMIC_RELAXED) & mask))
+        {
+            __atomic_fetch_or(word, mask, __ATOMIC_RELAXED);
+        }
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
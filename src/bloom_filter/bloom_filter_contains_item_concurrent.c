@@ -0,0 +1,56 @@
+/**
+ * \file bloom_filter_contains_item_concurrent.c
+ *
+ * Implementation of bloom_filter_contains_item_concurrent.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter.h>
+
+/**
+ * \brief Query a bloom filter that is shared between threads.
+ *
+ * This query is lock-free, and may run concurrently with
+ * bloom_filter_add_item_concurrent().  An item whose add has completed before
+ * this query begins is always found; an item which is being added at the same
+ * time may or may not be found.
+ *
+ * \param bloom             The bloom filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool bloom_filter_contains_item_concurrent(
+    bloom_filter_t* bloom, const void* data, size_t len)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != data);
+
+    uintptr_t* words = (uintptr_t*)bloom->bitmap;
+
+    for (unsigned int n = 0; n < bloom->options->num_hash_functions; n++)
+    {
+        unsigned int hash_val = bloom_filter_hash(
+            bloom->options, data, len, n);
+
+        /* build a mask for this bit in the word that holds its byte. */
+        size_t byte_offset = hash_val / 8;
+        uint8_t mask_bytes[sizeof(uintptr_t)] = { 0 };
+        uintptr_t mask;
+        mask_bytes[byte_offset % sizeof(uintptr_t)] = 1 << (hash_val % 8);
+        memcpy(&mask, mask_bytes, sizeof(mask));
+
+        uintptr_t* word = words + byte_offset / sizeof(uintptr_t);
+
+        if (!(__atomic_load_n(word, __ATOMIC_RELAXED) & mask))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
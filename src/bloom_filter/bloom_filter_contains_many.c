@@ -0,0 +1,93 @@
+/**
+ * \file bloom_filter_contains_many.c
+ *
+ * Implementation of bloom_filter_contains_many.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter.h>
+
+/**
+ * \brief The number of items whose probes are in flight at once.
+ */
+#define BLOOM_FILTER_CONTAINS_MANY_BLOCK 16
+
+/**
+ * \brief Query a bloom filter for a batch of items.
+ *
+ * This is equivalent to calling bloom_filter_contains_item() for each item,
+ * but is much faster for filters which do not fit in cache.  Items are
+ * processed in small blocks: every item in a block is hashed and a prefetch is
+ * issued for each of its bit positions before any bit is tested, so that the
+ * cache misses of the whole block overlap instead of stalling one at a time.
+ *
+ * \param bloom             The bloom filter.
+ * \param items             An array of count pointers to the items to query.
+ * \param lens              An array of count item sizes.
+ * \param count             The number of items to query.
+ * \param results           An array of count booleans, which receives true for
+ *                          each item that may be in the filter and false for
+ *                          each item that definitely is not.
+ */
+void bloom_filter_contains_many(
+    bloom_filter_t* bloom, const void* const* items, const size_t* lens,
+    size_t count, _Bool* results)
+{
+    uint64_t hv1[BLOOM_FILTER_CONTAINS_MANY_BLOCK];
+    uint64_t hv2[BLOOM_FILTER_CONTAINS_MANY_BLOCK];
+
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != items);
+    MODEL_ASSERT(NULL != lens);
+    MODEL_ASSERT(NULL != results);
+
+    const bloom_filter_options_t* options = bloom->options;
+    const uint8_t* bitmap = (const uint8_t*)bloom->bitmap;
+    unsigned int m = options->size_in_bytes * 8;
+
+    for (size_t start = 0; start < count;
+         start += BLOOM_FILTER_CONTAINS_MANY_BLOCK)
+    {
+        size_t block = count - start;
+        if (block > BLOOM_FILTER_CONTAINS_MANY_BLOCK)
+        {
+            block = BLOOM_FILTER_CONTAINS_MANY_BLOCK;
+        }
+
+        /* hash each item once, and start loading every byte it probes.  The
+         * positions are derived exactly as in bloom_filter_hash(). */
+        for (size_t i = 0; i < block; ++i)
+        {
+            const void* item = items[start + i];
+            hv1[i] = options->hash_function_1(item, lens[start + i]);
+            hv2[i] = options->hash_function_2(item, lens[start + i]);
+
+#ifdef __GNUC__
+            for (unsigned int n = 0; n < options->num_hash_functions; ++n)
+            {
+                unsigned int hash_val = (hv1[i] + n * hv2[i]) % m;
+                __builtin_prefetch(bitmap + hash_val / 8, 0, 1);
+            }
+#endif  //__GNUC__
+        }
+
+        /* by now, most of the probed bytes are in cache. */
+        for (size_t i = 0; i < block; ++i)
+        {
+            _Bool found = true;
+            for (unsigned int n = 0; n < options->num_hash_functions; ++n)
+            {
+                unsigned int hash_val = (hv1[i] + n * hv2[i]) % m;
+                if (!(bitmap[hash_val / 8] & (1 << (hash_val % 8))))
+                {
+                    found = false;
+                    break;
+                }
+            }
+
+            results[start + i] = found;
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * \file bloom_filter_encode_header.c
+ *
+ * Implementation of bloom_filter_encode_header.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+
+#include "bloom_filter_internal.h"
+
+/* forward decls for internal methods */
+static void encode_le(uint8_t* out, uint64_t val, size_t size);
+
+/**
+ * \brief Encode the serialized header for a bloom filter.
+ *
+ * \param bloom             The bloom filter.
+ * \param header            A buffer of BLOOM_FILTER_SERIALIZED_HEADER_SIZE
+ *                          bytes to receive the header.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the filter uses a hash
+ *        function which cannot be serialized.
+ */
+int bloom_filter_encode_header(const bloom_filter_t* bloom, uint8_t* header)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != header);
+
+    const bloom_filter_options_t* options = bloom->options;
+    hash_func_t funcs[2] =
+        { options->hash_function_1, options->hash_function_2 };
+    uint32_t ids[2];
+
+    /* map each hash function to its serialized identifier. */
+    for (int i = 0; i < 2; ++i)
+    {
+        if (&sdbm == funcs[i])
+        {
+            ids[i] = BLOOM_FILTER_HASH_ID_SDBM;
+        }
+        else if (&jenkins == funcs[i])
+        {
+            ids[i] = BLOOM_FILTER_HASH_ID_JENKINS;
+        }
+        else
+        {
+            return VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION;
+        }
+    }
+
+    memset(header, 0, BLOOM_FILTER_SERIALIZED_HEADER_SIZE);
+    memcpy(header, BLOOM_FILTER_SERIALIZED_MAGIC, 8);
+    encode_le(header + 8, BLOOM_FILTER_SERIALIZED_VERSION, 4);
+    encode_le(header + 12, BLOOM_FILTER_SERIALIZED_HEADER_SIZE, 4);
+    encode_le(header + 16, options->size_in_bytes, 8);
+    encode_le(header + 24, options->num_expected_entries, 8);
+    encode_le(header + 32, options->num_hash_functions, 4);
+    encode_le(header + 36, ids[0], 4);
+    encode_le(header + 40, ids[1], 4);
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Encode an unsigned value in little-endian byte order.
+ *
+ * \param out               The buffer to receive the value.
+ * \param val               The value to encode.
+ * \param size              The number of bytes to write.
+ */
+static void encode_le(uint8_t* out, uint64_t val, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        out[i] = (uint8_t)(val >> (8 * i));
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * \file bloom_filter_estimate_cardinality.c
+ *
+ * Implementation of bloom_filter_estimate_cardinality.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter.h>
+
+#include "bloom_filter_internal.h"
+
+/* forward decls for internal methods */
+static uint64_t popcount64(uint64_t);
+
+/**
+ * \brief Estimate the number of distinct items added to a bloom filter.
+ *
+ * The estimate is derived from the number of bits set in the filter, X, using
+ * the Swamidass-Baldi estimator n = -(m / k) ln(1 - X / m), where m is the
+ * number of bits and k is the number of hash functions.  Once every bit is
+ * set, the estimate no longer grows.
+ *
+ * \param bloom             The bloom filter.
+ *
+ * \returns the estimated number of distinct items in the filter.
+ */
+size_t bloom_filter_estimate_cardinality(const bloom_filter_t* bloom)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+
+    /* the bitmap is padded to whole words, and the padding is zero. */
+    size_t num_words =
+        (bloom->options->size_in_bytes + sizeof(uint64_t) - 1)
+            / sizeof(uint64_t);
+    const uint64_t* words = (const uint64_t*)bloom->bitmap;
+    uint64_t total = 0;
+    size_t i = 0;
+
+#ifdef __GNUC__
+    /* count the bits in each lane of a vector at once, using the same
+     * shift-and-add reduction as popcount64(), and sum the lanes at the end.
+     */
+    const size_t vec_words = sizeof(bloom_filter_vec_t) / sizeof(uint64_t);
+    bloom_filter_vec_t sums = { 0 };
+    for (; i + vec_words <= num_words; i += vec_words)
+    {
+        bloom_filter_vec_t v;
+        memcpy(&v, words + i, sizeof(v));
+
+        v = v - ((v >> 1) & 0x5555555555555555ULL);
+        v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+        v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        v = v + (v >> 8);
+        v = v + (v >> 16);
+        v = v + (v >> 32);
+
+        sums += v & 0x7F;
+    }
+
+    for (size_t lane = 0; lane < vec_words; ++lane)
+    {
+        total += sums[lane];
+    }
+#endif  //__GNUC__
+
+    for (; i < num_words; ++i)
+    {
+        total += popcount64(words[i]);
+    }
+
+    double bits_set = (double)total;
+    double m = (double)bloom->options->size_in_bytes * 8;
+    double k = (double)bloom->options->num_hash_functions;
+
+    /* a full filter is indistinguishable from one with a single bit clear. */
+    if (bits_set >= m)
+    {
+        bits_set = m - 1;
+    }
+
+    return (size_t)llround(-(m / k) * log1p(-bits_set / m));
+}
+
+/**
+ * \brief Count the bits set in a 64-bit word.
+ *
+ * \param word              The word to count.
+ *
+ * \returns the number of bits set in word.
+ */
+static uint64_t popcount64(uint64_t word)
+{
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL)
+         + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    word = word + (word >> 8);
+    word = word + (word >> 16);
+    word = word + (word >> 32);
+
+    return word & 0x7F;
+}
@@ -45,16 +45,19 @@ int bloom_filter_init(bloom_filter_options_t* options, bloom_filter_t* bloom)
     bloom->hdr.dispose = &bloom_filter_dispose;
     bloom->options = options;
 
-    // allocate the bitmap
-    bloom->bitmap = (void*)allocate(bloom->options->alloc_opts,
-        bloom->options->size_in_bytes);
+    // allocate the bitmap, rounded up to a whole number of 64-bit words so
+    // that it can be accessed a word at a time
+    size_t alloc_size =
+        (bloom->options->size_in_bytes + sizeof(uint64_t) - 1)
+            & ~(sizeof(uint64_t) - 1);
+    bloom->bitmap = (void*)allocate(bloom->options->alloc_opts, alloc_size);
     if (NULL == bloom->bitmap)
     {
         return VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED;
     }
 
     // clear the bitmap
-    MODEL_EXEMPT(memset(bloom->bitmap, 0, bloom->options->size_in_bytes));
+    MODEL_EXEMPT(memset(bloom->bitmap, 0, alloc_size));
 
 
     return VPR_STATUS_SUCCESS;
@@ -0,0 +1,162 @@
+/**
+ * \file bloom_filter_init_from_buffer.c
+ *
+ * Implementation of bloom_filter_init_from_buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <limits.h>
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+#include <vpr/parameters.h>
+
+/* forward decls for internal methods */
+static uint64_t decode_le(const uint8_t* in, size_t size);
+static hash_func_t hash_function_from_id(uint64_t id);
+static void bloom_filter_borrowed_dispose(void*);
+
+/**
+ * \brief Initialize a bloom filter in place from a serialized buffer.
+ *
+ * The options are read from the buffer header, and the bitmap of the filter
+ * points directly into the buffer; nothing is copied.  The buffer must be
+ * aligned to eight bytes, and must outlive both the filter and the options.
+ * If the buffer is read-only, then the filter must only be queried.
+ *
+ * When the function completes successfully, the caller owns the options and
+ * the filter, and must dispose of both when they are no longer needed.
+ * Disposing of them does not release the buffer.
+ *
+ * \param options           The bloom filter options to initialize.
+ * \param bloom             The bloom filter to initialize.
+ * \param alloc_opts        The allocator options to record in the options.
+ * \param buffer            The serialized bloom filter.
+ * \param size              The size of the buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_INVALID_FORMAT if the buffer does not hold a
+ *        valid serialized filter.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the serialized filter
+ *        names an unknown hash function.
+ */
+int bloom_filter_init_from_buffer(
+    bloom_filter_options_t* options, bloom_filter_t* bloom,
+    allocator_options_t* alloc_opts, const void* buffer, size_t size)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != bloom);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != buffer);
+
+    const uint8_t* in = (const uint8_t*)buffer;
+
+    /* the bitmap is read a word at a time, so it must be aligned. */
+    if (size < BLOOM_FILTER_SERIALIZED_HEADER_SIZE
+     || 0 != ((uintptr_t)buffer % sizeof(uint64_t)))
+    {
+        return VPR_ERROR_BLOOM_INVALID_FORMAT;
+    }
+
+    /* verify the magic number, version, and header size. */
+    if (0 != memcmp(in, BLOOM_FILTER_SERIALIZED_MAGIC, 8)
+     || BLOOM_FILTER_SERIALIZED_VERSION != decode_le(in + 8, 4)
+     || BLOOM_FILTER_SERIALIZED_HEADER_SIZE != decode_le(in + 12, 4))
+    {
+        return VPR_ERROR_BLOOM_INVALID_FORMAT;
+    }
+
+    uint64_t size_in_bytes = decode_le(in + 16, 8);
+    uint64_t num_expected_entries = decode_le(in + 24, 8);
+    uint64_t num_hash_functions = decode_le(in + 32, 4);
+
+    /* verify that the bitmap is present and that every bit of it can be
+     * addressed by bloom_filter_hash(). */
+    uint64_t max_size = (uint64_t)UINT_MAX / 8;
+    uint64_t padded_size =
+        (size_in_bytes + sizeof(uint64_t) - 1)
+            & ~(uint64_t)(sizeof(uint64_t) - 1);
+    if (0 == size_in_bytes || size_in_bytes > max_size
+     || 0 == num_hash_functions
+     || padded_size > size - BLOOM_FILTER_SERIALIZED_HEADER_SIZE)
+    {
+        return VPR_ERROR_BLOOM_INVALID_FORMAT;
+    }
+
+    hash_func_t hash_function_1 = hash_function_from_id(decode_le(in + 36, 4));
+    hash_func_t hash_function_2 = hash_function_from_id(decode_le(in + 40, 4));
+    if (NULL == hash_function_1 || NULL == hash_function_2)
+    {
+        return VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION;
+    }
+
+    options->hdr.dispose = &bloom_filter_borrowed_dispose;
+    options->alloc_opts = alloc_opts;
+    options->num_expected_entries = num_expected_entries;
+    options->size_in_bytes = size_in_bytes;
+    options->num_hash_functions = num_hash_functions;
+    options->hash_function_1 = hash_function_1;
+    options->hash_function_2 = hash_function_2;
+
+    /* the filter borrows the bitmap from the buffer. */
+    bloom->hdr.dispose = &bloom_filter_borrowed_dispose;
+    bloom->options = options;
+    bloom->bitmap = (void*)(in + BLOOM_FILTER_SERIALIZED_HEADER_SIZE);
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Decode an unsigned little-endian value.
+ *
+ * \param in                The buffer holding the value.
+ * \param size              The number of bytes to read.
+ *
+ * \returns the decoded value.
+ */
+static uint64_t decode_le(const uint8_t* in, size_t size)
+{
+    uint64_t val = 0;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        val |= (uint64_t)in[i] << (8 * i);
+    }
+
+    return val;
+}
+
+/**
+ * \brief Map a serialized hash function identifier to its hash function.
+ *
+ * \param id                The serialized identifier.
+ *
+ * \returns the hash function, or NULL if the identifier is unknown.
+ */
+static hash_func_t hash_function_from_id(uint64_t id)
+{
+    switch (id)
+    {
+        case BLOOM_FILTER_HASH_ID_SDBM:
+            return &sdbm;
+
+        case BLOOM_FILTER_HASH_ID_JENKINS:
+            return &jenkins;
+
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * Dispose of options or a filter which borrow their storage from a buffer.
+ * Nothing special needs to be done.
+ *
+ * \param pdisp             Opaque pointer to the structure.
+ */
+static void bloom_filter_borrowed_dispose(void* UNUSED(pdisp))
+{
+    MODEL_ASSERT(NULL != pdisp);
+}
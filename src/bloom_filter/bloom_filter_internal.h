@@ -0,0 +1,59 @@
+/**
+ * \file bloom_filter_internal.h
+ *
+ * \brief Internal helpers shared by the bloom filter implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_BLOOM_FILTER_INTERNAL_HEADER_GUARD
+#define VPR_BLOOM_FILTER_INTERNAL_HEADER_GUARD
+
+#include <string.h>
+#include <vpr/bloom_filter.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+
+#ifdef __GNUC__
+/**
+ * \brief A 256-bit vector of words, which the compiler lowers to the widest
+ * vector unit available on the target.
+ *
+ * Bitmaps are processed a vector at a time, with the words past the last
+ * whole vector handled one at a time.
+ */
+typedef uint64_t bloom_filter_vec_t __attribute__((vector_size(32)));
+#endif  //__GNUC__
+
+/**
+ * \brief Add a new, empty stage to a scalable bloom filter.
+ *
+ * Stage i holds initial_capacity * growth_factor^i entries, and has an error
+ * rate of P * (1 - r) * r^i, where P is the target error rate and r is the
+ * tightening ratio.  The sum of the error rates of all stages is bounded by P.
+ *
+ * \param bloom             The scalable bloom filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED if memory could not be
+ *        allocated for the new stage.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bitmap of the new stage.
+ */
+int scalable_bloom_filter_add_stage(scalable_bloom_filter_t* bloom);
+
+/**
+ * \brief Encode the serialized header for a bloom filter.
+ *
+ * \param bloom             The bloom filter.
+ * \param header            A buffer of BLOOM_FILTER_SERIALIZED_HEADER_SIZE
+ *                          bytes to receive the header.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the filter uses a hash
+ *        function which cannot be serialized.
+ */
+int bloom_filter_encode_header(const bloom_filter_t* bloom, uint8_t* header);
+
+#endif  //VPR_BLOOM_FILTER_INTERNAL_HEADER_GUARD
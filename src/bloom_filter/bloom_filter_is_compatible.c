@@ -0,0 +1,39 @@
+/**
+ * \file bloom_filter_is_compatible.c
+ *
+ * Implementation of bloom_filter_is_compatible.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter.h>
+
+/**
+ * \brief Determine whether two bloom filters are compatible.
+ *
+ * Two bloom filters are compatible if they are the same size and use the same
+ * hash functions, so that any item maps to the same bits in both.  Only
+ * compatible filters can be combined with bloom_filter_union() or
+ * bloom_filter_intersect().
+ *
+ * \param lhs               The first bloom filter.
+ * \param rhs               The second bloom filter.
+ *
+ * \returns true if the filters are compatible, and false otherwise.
+ */
+_Bool bloom_filter_is_compatible(
+    const bloom_filter_t* lhs, const bloom_filter_t* rhs)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(lhs));
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(rhs));
+
+    const bloom_filter_options_t* lopts = lhs->options;
+    const bloom_filter_options_t* ropts = rhs->options;
+
+    return
+        lopts->size_in_bytes == ropts->size_in_bytes
+     && lopts->num_hash_functions == ropts->num_hash_functions
+     && lopts->hash_function_1 == ropts->hash_function_1
+     && lopts->hash_function_2 == ropts->hash_function_2;
+}
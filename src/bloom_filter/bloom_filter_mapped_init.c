@@ -0,0 +1,128 @@
+/**
+ * \file bloom_filter_mapped_init.c
+ *
+ * Implementation of bloom_filter_mapped_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+/* memory mapping is only available on POSIX platforms. */
+#if defined(__unix__) || defined(__APPLE__)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+
+/* forward decls for internal methods */
+static void bloom_filter_mapped_dispose(void*);
+
+/**
+ * \brief Load a bloom filter by memory-mapping a saved filter file read-only.
+ *
+ * The filter is served straight from the mapping, so mapped->filter may be
+ * passed to bloom_filter_contains_item() and
+ * bloom_filter_contains_item_concurrent(), but must never be added to.
+ * Processes which map the same file share its pages.
+ *
+ * This function is only available on POSIX platforms.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::bloom_filter_mapped_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed, which unmaps the file.
+ *
+ * \param mapped            The mapped bloom filter to initialize.
+ * \param alloc_opts        The allocator options to record in the options.
+ * \param path              The path of a file written by bloom_filter_save().
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_FILE_IO if the file could not be opened or
+ *        mapped.
+ *      - \ref VPR_ERROR_BLOOM_INVALID_FORMAT if the file does not hold a valid
+ *        serialized filter.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the serialized filter
+ *        names an unknown hash function.
+ */
+int bloom_filter_mapped_init(
+    bloom_filter_mapped_t* mapped, allocator_options_t* alloc_opts,
+    const char* path)
+{
+    int retval;
+    struct stat st;
+
+    MODEL_ASSERT(NULL != mapped);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != path);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return VPR_ERROR_BLOOM_FILE_IO;
+    }
+
+    if (0 != fstat(fd, &st))
+    {
+        retval = VPR_ERROR_BLOOM_FILE_IO;
+        goto close_fd;
+    }
+
+    if ((size_t)st.st_size < BLOOM_FILTER_SERIALIZED_HEADER_SIZE)
+    {
+        retval = VPR_ERROR_BLOOM_INVALID_FORMAT;
+        goto close_fd;
+    }
+
+    /* map the whole file read-only and shared, so that every process which
+     * maps it uses the same page cache pages. */
+    mapped->map_size = (size_t)st.st_size;
+    mapped->map = mmap(NULL, mapped->map_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == mapped->map)
+    {
+        retval = VPR_ERROR_BLOOM_FILE_IO;
+        goto close_fd;
+    }
+
+    /* filter probes are scattered, so readahead is wasted. */
+    (void)posix_madvise(mapped->map, mapped->map_size, POSIX_MADV_RANDOM);
+
+    retval = bloom_filter_init_from_buffer(
+        &mapped->options, &mapped->filter, alloc_opts, mapped->map,
+        mapped->map_size);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        munmap(mapped->map, mapped->map_size);
+        goto close_fd;
+    }
+
+    mapped->hdr.dispose = &bloom_filter_mapped_dispose;
+    retval = VPR_STATUS_SUCCESS;
+
+close_fd:
+    /* the mapping remains valid after the descriptor is closed. */
+    close(fd);
+
+    return retval;
+}
+
+/**
+ * Dispose of a mapped bloom filter.
+ *
+ * \param pmapped       An opaque pointer to the mapped bloom filter.
+ */
+static void bloom_filter_mapped_dispose(void* pmapped)
+{
+    MODEL_ASSERT(NULL != pmapped);
+
+    bloom_filter_mapped_t* mapped = (bloom_filter_mapped_t*)pmapped;
+
+    dispose(bloom_filter_disposable_handle(&mapped->filter));
+    dispose(bloom_filter_options_disposable_handle(&mapped->options));
+    munmap(mapped->map, mapped->map_size);
+}
+
+#endif /*defined(__unix__) || defined(__APPLE__)*/
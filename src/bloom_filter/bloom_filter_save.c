@@ -0,0 +1,66 @@
+/**
+ * \file bloom_filter_save.c
+ *
+ * Implementation of bloom_filter_save.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <stdio.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+
+#include "bloom_filter_internal.h"
+
+/**
+ * \brief Save a bloom filter to a file.
+ *
+ * The file is written in the same format as bloom_filter_serialize(), without
+ * making an intermediate copy of the bitmap.
+ *
+ * \param bloom             The bloom filter to save.
+ * \param path              The path of the file to create or replace.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the filter uses a hash
+ *        function which cannot be serialized.
+ *      - \ref VPR_ERROR_BLOOM_FILE_IO if the file could not be written.
+ */
+int bloom_filter_save(const bloom_filter_t* bloom, const char* path)
+{
+    int retval;
+    uint8_t header[BLOOM_FILTER_SERIALIZED_HEADER_SIZE];
+
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != path);
+
+    retval = bloom_filter_encode_header(bloom, header);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    FILE* fp = fopen(path, "wb");
+    if (NULL == fp)
+    {
+        return VPR_ERROR_BLOOM_FILE_IO;
+    }
+
+    /* the padded bitmap follows the header directly. */
+    size_t bitmap_size =
+        bloom_filter_serialized_size(bloom)
+            - BLOOM_FILTER_SERIALIZED_HEADER_SIZE;
+    if (1 != fwrite(header, sizeof(header), 1, fp)
+     || 1 != fwrite(bloom->bitmap, bitmap_size, 1, fp))
+    {
+        retval = VPR_ERROR_BLOOM_FILE_IO;
+    }
+
+    if (0 != fclose(fp))
+    {
+        retval = VPR_ERROR_BLOOM_FILE_IO;
+    }
+
+    return retval;
+}
@@ -0,0 +1,58 @@
+/**
+ * \file bloom_filter_serialize.c
+ *
+ * Implementation of bloom_filter_serialize.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+
+#include "bloom_filter_internal.h"
+
+/**
+ * \brief Serialize a bloom filter to a buffer.
+ *
+ * \param bloom             The bloom filter to serialize.
+ * \param buffer            The buffer to which the filter is written.
+ * \param size              The size of the buffer, which must be at least
+ *                          bloom_filter_serialized_size() bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_SERIALIZE_BUFFER_TOO_SMALL if the buffer is too
+ *        small.
+ *      - \ref VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION if the filter uses a hash
+ *        function which cannot be serialized.
+ */
+int bloom_filter_serialize(
+    const bloom_filter_t* bloom, void* buffer, size_t size)
+{
+    int retval;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != buffer);
+
+    if (size < bloom_filter_serialized_size(bloom))
+    {
+        return VPR_ERROR_BLOOM_SERIALIZE_BUFFER_TOO_SMALL;
+    }
+
+    uint8_t* out = (uint8_t*)buffer;
+    retval = bloom_filter_encode_header(bloom, out);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the bitmap, including its zero padding, is copied as-is, since its bit
+     * order does not depend on the platform. */
+    MODEL_EXEMPT(
+        memcpy(out + BLOOM_FILTER_SERIALIZED_HEADER_SIZE, bloom->bitmap,
+            bloom_filter_serialized_size(bloom)
+                - BLOOM_FILTER_SERIALIZED_HEADER_SIZE));
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,29 @@
+/**
+ * \file bloom_filter_serialized_size.c
+ *
+ * Implementation of bloom_filter_serialized_size.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+
+/**
+ * \brief Get the number of bytes needed to serialize a bloom filter.
+ *
+ * \param bloom             The bloom filter.
+ *
+ * \returns the size of the serialized bloom filter in bytes.
+ */
+size_t bloom_filter_serialized_size(const bloom_filter_t* bloom)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(bloom));
+
+    /* the bitmap is padded to whole 64-bit words. */
+    size_t bitmap_size =
+        (bloom->options->size_in_bytes + sizeof(uint64_t) - 1)
+            & ~(sizeof(uint64_t) - 1);
+
+    return BLOOM_FILTER_SERIALIZED_HEADER_SIZE + bitmap_size;
+}
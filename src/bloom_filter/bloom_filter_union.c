@@ -0,0 +1,73 @@
+/**
+ * \file bloom_filter_union.c
+ *
+ * Implementation of bloom_filter_union.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter.h>
+
+#include "bloom_filter_internal.h"
+
+/**
+ * \brief Merge the items of one bloom filter into another.
+ *
+ * After this call, dest reports every item that either filter reported
+ * before the call.  The bitmaps are combined with the widest vector operations
+ * available on the target.
+ *
+ * \param dest              The bloom filter to update.
+ * \param src               The bloom filter to merge into dest.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_INCOMPATIBLE_FILTERS if the filters are not
+ *        compatible.
+ */
+int bloom_filter_union(bloom_filter_t* dest, const bloom_filter_t* src)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(dest));
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER(src));
+
+    if (!bloom_filter_is_compatible(dest, src))
+    {
+        return VPR_ERROR_BLOOM_INCOMPATIBLE_FILTERS;
+    }
+
+    /* the bitmaps are padded to whole words, and the padding is zero. */
+    size_t num_words =
+        (dest->options->size_in_bytes + sizeof(uint64_t) - 1)
+            / sizeof(uint64_t);
+    uint64_t* out = (uint64_t*)dest->bitmap;
+    const uint64_t* in = (const uint64_t*)src->bitmap;
+
+    /* a filter unioned with itself is unchanged. */
+    if (out == in)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    size_t i = 0;
+
+#ifdef __GNUC__
+    const size_t vec_words = sizeof(bloom_filter_vec_t) / sizeof(uint64_t);
+    for (; i + vec_words <= num_words; i += vec_words)
+    {
+        bloom_filter_vec_t lhs, rhs;
+        memcpy(&lhs, out + i, sizeof(lhs));
+        memcpy(&rhs, in + i, sizeof(rhs));
+        lhs |= rhs;
+        memcpy(out + i, &lhs, sizeof(lhs));
+    }
+#endif  //__GNUC__
+
+    for (; i < num_words; ++i)
+    {
+        out[i] |= in[i];
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
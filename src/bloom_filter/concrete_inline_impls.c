@@ -4,9 +4,15 @@
  * \brief Provide concrete implementations for inline functions for debug-time
  * linkage.
  *
- * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ * \copyright 2021-2026 Velo Payments, Inc.  All rights reserved.
  */
 
 #define VPR_BLOOM_FILTER_CONCRETE_IMPLEMENTATION
+#define VPR_COUNTING_BLOOM_FILTER_CONCRETE_IMPLEMENTATION
+#define VPR_SCALABLE_BLOOM_FILTER_CONCRETE_IMPLEMENTATION
+#define VPR_BLOOM_FILTER_SERIALIZATION_CONCRETE_IMPLEMENTATION
 
 #include <vpr/bloom_filter.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+#include <vpr/bloom_filter/counting_bloom_filter.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
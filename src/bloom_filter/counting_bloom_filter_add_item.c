@@ -0,0 +1,47 @@
+/**
+ * \file counting_bloom_filter_add_item.c
+ *
+ * Implementation of counting_bloom_filter_add_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/counting_bloom_filter.h>
+
+/**
+ * \brief Add an item to a counting bloom filter.
+ *
+ * \param bloom             The counting bloom filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int counting_bloom_filter_add_item(
+    counting_bloom_filter_t* bloom, const void* data, size_t len)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_COUNTING_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != data);
+    MODEL_ASSERT(len > 0);
+
+    /* increment the counter for each hash function. */
+    for (unsigned int n = 0; n < bloom->options->num_hash_functions; n++)
+    {
+        unsigned int hash_val = bloom_filter_hash(
+            bloom->options, data, len, n);
+
+        uint64_t* word = bloom->counters + hash_val / 16;
+        unsigned int shift = (hash_val % 16) * 4;
+        uint64_t counter = (*word >> shift) & 0x0F;
+
+        /* saturated counters stay saturated. */
+        if (counter < COUNTING_BLOOM_FILTER_COUNTER_MAX)
+        {
+            *word += ((uint64_t)1) << shift;
+        }
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/**
+ * \file counting_bloom_filter_contains_item.c
+ *
+ * Implementation of counting_bloom_filter_contains_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/counting_bloom_filter.h>
+
+/**
+ * \brief Query a counting bloom filter to determine if an item has been added.
+ *
+ * \param bloom             The counting bloom filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool counting_bloom_filter_contains_item(
+    counting_bloom_filter_t* bloom, const void* data, size_t len)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_COUNTING_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != data);
+
+    for (unsigned int n = 0; n < bloom->options->num_hash_functions; n++)
+    {
+        unsigned int hash_val = bloom_filter_hash(
+            bloom->options, data, len, n);
+
+        /* if this counter is zero, the item is definitely not in the set. */
+        uint64_t word = bloom->counters[hash_val / 16];
+        if (0 == ((word >> ((hash_val % 16) * 4)) & 0x0F))
+        {
+            return false;
+        }
+    }
+
+    /* every counter is set, so the item is probably in the set. */
+    return true;
+}
@@ -0,0 +1,86 @@
+/**
+ * \file counting_bloom_filter_init.c
+ *
+ * Implementation of counting_bloom_filter_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/counting_bloom_filter.h>
+#include <vpr/parameters.h>
+
+//forward decls
+static void counting_bloom_filter_dispose(void*);
+
+/**
+ * \brief Initialize a counting bloom filter.
+ *
+ * This method allows for the creation of a counting bloom filter.  Once
+ * initialized, the filter will be empty.  The options structure is shared with
+ * ::bloom_filter_t, and should be initialized with bloom_filter_options_init()
+ * or bloom_filter_options_init_ex().  Note that the counting filter uses four
+ * times the memory of the equivalent bloom filter.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::counting_bloom_filter_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed.
+ *
+ * \param options           The bloom filter options to use for this instance.
+ * \param bloom             The counting bloom filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_COUNTER_ALLOCATION_FAILED if memory could not
+ *        be allocated for the counters.
+ */
+int counting_bloom_filter_init(
+    bloom_filter_options_t* options, counting_bloom_filter_t* bloom)
+{
+    /* the counting bloom filter structure must be non-null. */
+    MODEL_ASSERT(NULL != bloom);
+
+    /* sanity checks on options. */
+    MODEL_ASSERT(MODEL_PROP_VALID_BLOOM_FILTER_OPTIONS(options));
+
+    bloom->hdr.dispose = &counting_bloom_filter_dispose;
+    bloom->options = options;
+
+    /* there is one 4-bit counter per bit in the equivalent bloom filter, and
+     * sixteen counters fit in a 64-bit word. */
+    size_t num_counters = options->size_in_bytes * 8;
+    bloom->num_words = (num_counters + 15) / 16;
+
+    /* allocate the counters. */
+    bloom->counters = (uint64_t*)allocate(
+        options->alloc_opts, bloom->num_words * sizeof(uint64_t));
+    if (NULL == bloom->counters)
+    {
+        return VPR_ERROR_BLOOM_COUNTER_ALLOCATION_FAILED;
+    }
+
+    /* clear the counters. */
+    MODEL_EXEMPT(
+        memset(bloom->counters, 0, bloom->num_words * sizeof(uint64_t)));
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a counting bloom filter.
+ *
+ * \param pbloom        An opaque pointer to the counting bloom filter.
+ */
+static void counting_bloom_filter_dispose(void* pbloom)
+{
+    MODEL_ASSERT(NULL != pbloom);
+
+    counting_bloom_filter_t* bloom = (counting_bloom_filter_t*)pbloom;
+
+    MODEL_ASSERT(NULL != bloom->options);
+    MODEL_ASSERT(NULL != bloom->options->alloc_opts);
+    MODEL_ASSERT(NULL != bloom->counters);
+
+    release(bloom->options->alloc_opts, bloom->counters);
+}
@@ -0,0 +1,62 @@
+/**
+ * \file counting_bloom_filter_remove_item.c
+ *
+ * Implementation of counting_bloom_filter_remove_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/counting_bloom_filter.h>
+
+/**
+ * \brief Remove an item from a counting bloom filter.
+ *
+ * Only items which were previously added should be removed.  Removing an item
+ * which was never added may cause false negatives for other items that share
+ * its counters.  If any of the counters for this item are zero, then the item
+ * is definitely not in the filter, and the filter is left unchanged.
+ *
+ * \param bloom             The counting bloom filter.
+ * \param data              The data to remove from the filter.
+ * \param len               The size of the data to remove from the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_REMOVE_ITEM_NOT_FOUND if the item is not in the
+ *        filter.
+ */
+int counting_bloom_filter_remove_item(
+    counting_bloom_filter_t* bloom, const void* data, size_t len)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_COUNTING_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != data);
+    MODEL_ASSERT(len > 0);
+
+    /* don't touch the counters unless the item is present, so that removing
+     * an absent item can't corrupt the counters of other items. */
+    if (!counting_bloom_filter_contains_item(bloom, data, len))
+    {
+        return VPR_ERROR_BLOOM_REMOVE_ITEM_NOT_FOUND;
+    }
+
+    /* decrement the counter for each hash function. */
+    for (unsigned int n = 0; n < bloom->options->num_hash_functions; n++)
+    {
+        unsigned int hash_val = bloom_filter_hash(
+            bloom->options, data, len, n);
+
+        uint64_t* word = bloom->counters + hash_val / 16;
+        unsigned int shift = (hash_val % 16) * 4;
+        uint64_t counter = (*word >> shift) & 0x0F;
+
+        /* a saturated counter has lost track of its true count, so it must
+         * never be decremented.  The zero check guards against underflow. */
+        if (counter > 0 && counter < COUNTING_BLOOM_FILTER_COUNTER_MAX)
+        {
+            *word -= ((uint64_t)1) << shift;
+        }
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file counting_bloom_filter_to_bloom_filter.c
+ *
+ * Implementation of counting_bloom_filter_to_bloom_filter.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/counting_bloom_filter.h>
+
+/**
+ * \brief Compact a counting bloom filter into a plain bloom filter.
+ *
+ * The resulting ::bloom_filter_t shares the options of the counting bloom
+ * filter, and has a bit set for every non-zero counter.  It answers
+ * bloom_filter_contains_item() queries exactly as the counting bloom filter
+ * answered counting_bloom_filter_contains_item() at the time of conversion.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::bloom_filter_t instance and must dispose of it by calling dispose() when it
+ * is no longer needed.  The options structure must outlive both filters.
+ *
+ * \param counting          The counting bloom filter to compact.
+ * \param bloom             The bloom filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bloom filter.
+ */
+int counting_bloom_filter_to_bloom_filter(
+    counting_bloom_filter_t* counting, bloom_filter_t* bloom)
+{
+    int retval;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_COUNTING_BLOOM_FILTER(counting));
+    MODEL_ASSERT(NULL != bloom);
+
+    /* create an empty bloom filter with the same options. */
+    retval = bloom_filter_init(counting->options, bloom);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    uint8_t* bitmap = (uint8_t*)bloom->bitmap;
+    size_t size_in_bytes = counting->options->size_in_bytes;
+
+    /* each 64-bit word of counters maps to two bytes of the bitmap. */
+    for (size_t i = 0; i < counting->num_words; ++i)
+    {
+        uint64_t word = counting->counters[i];
+
+        /* fold each counter down to its low bit, which is set if any bit of
+         * the counter is set. */
+        word = (word | (word >> 1) | (word >> 2) | (word >> 3))
+             & 0x1111111111111111ULL;
+
+        /* gather the sixteen low bits, which are four bits apart, into the
+         * bottom sixteen bits of the word. */
+        word = (word | (word >> 3)) & 0x0303030303030303ULL;
+        word = (word | (word >> 6)) & 0x000F000F000F000FULL;
+        word = (word | (word >> 12)) & 0x000000FF000000FFULL;
+        word = (word | (word >> 24)) & 0x000000000000FFFFULL;
+
+        bitmap[2 * i] = (uint8_t)word;
+        if (2 * i + 1 < size_in_bytes)
+        {
+            bitmap[2 * i + 1] = (uint8_t)(word >> 8);
+        }
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,71 @@
+/**
+ * \file scalable_bloom_filter_add_item.c
+ *
+ * Implementation of scalable_bloom_filter_add_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+
+#include "bloom_filter_internal.h"
+
+/**
+ * \brief Add an item to a scalable bloom filter.
+ *
+ * Items which the filter already reports as present are not added again, so
+ * that duplicates do not consume capacity.  If the newest stage is full, then
+ * a new stage is added before the item is added.
+ *
+ * \param bloom             The scalable bloom filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED if memory could not be
+ *        allocated for a new stage.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bitmap of a new stage.
+ */
+int scalable_bloom_filter_add_item(
+    scalable_bloom_filter_t* bloom, const void* data, size_t len)
+{
+    int retval;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_SCALABLE_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != data);
+    MODEL_ASSERT(len > 0);
+
+    /* don't spend capacity on items which are already present. */
+    if (scalable_bloom_filter_contains_item(bloom, data, len))
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /* if the newest stage is full, chain on a new stage. */
+    scalable_bloom_filter_stage_t* stage =
+        bloom->stages[bloom->num_stages - 1];
+    if (stage->count >= stage->capacity)
+    {
+        retval = scalable_bloom_filter_add_stage(bloom);
+        if (VPR_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        stage = bloom->stages[bloom->num_stages - 1];
+    }
+
+    /* add the item to the newest stage. */
+    retval = bloom_filter_add_item(&stage->filter, data, len);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    ++stage->count;
+
+    return VPR_STATUS_SUCCESS;
+}
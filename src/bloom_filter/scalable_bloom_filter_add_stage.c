@@ -0,0 +1,120 @@
+/**
+ * \file scalable_bloom_filter_add_stage.c
+ *
+ * Implementation of scalable_bloom_filter_add_stage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <math.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+
+#include "bloom_filter_internal.h"
+
+/**
+ * \brief Add a new, empty stage to a scalable bloom filter.
+ *
+ * Stage i holds initial_capacity * growth_factor^i entries, and has an error
+ * rate of P * (1 - r) * r^i, where P is the target error rate and r is the
+ * tightening ratio.  The sum of the error rates of all stages is bounded by P.
+ *
+ * \param bloom             The scalable bloom filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED if memory could not be
+ *        allocated for the new stage.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bitmap of the new stage.
+ */
+int scalable_bloom_filter_add_stage(scalable_bloom_filter_t* bloom)
+{
+    int retval;
+    scalable_bloom_filter_options_t* options = bloom->options;
+    size_t capacity;
+    double error_rate;
+
+    /* make room in the stage array if needed. */
+    if (bloom->num_stages == bloom->reserved_stages)
+    {
+        size_t old_size =
+            bloom->reserved_stages * sizeof(scalable_bloom_filter_stage_t*);
+
+        scalable_bloom_filter_stage_t** stages =
+            (scalable_bloom_filter_stage_t**)reallocate(
+                options->alloc_opts, bloom->stages, old_size, 2 * old_size);
+        if (NULL == stages)
+        {
+            return VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED;
+        }
+
+        bloom->stages = stages;
+        bloom->reserved_stages *= 2;
+    }
+
+    /* compute the capacity and error rate of this stage. */
+    if (0 == bloom->num_stages)
+    {
+        capacity = options->initial_capacity;
+        error_rate =
+            options->target_error_rate * (1.0 - options->tightening_ratio);
+    }
+    else
+    {
+        scalable_bloom_filter_stage_t* prev =
+            bloom->stages[bloom->num_stages - 1];
+
+        capacity = prev->capacity * options->growth_factor;
+        error_rate = options->target_error_rate
+                   * (1.0 - options->tightening_ratio)
+                   * pow(options->tightening_ratio, bloom->num_stages);
+    }
+
+    /* allocate the stage. */
+    scalable_bloom_filter_stage_t* stage =
+        (scalable_bloom_filter_stage_t*)allocate(
+            options->alloc_opts, sizeof(scalable_bloom_filter_stage_t));
+    if (NULL == stage)
+    {
+        return VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED;
+    }
+
+    /* size the stage's bloom filter to meet its error rate exactly. */
+    retval = bloom_filter_options_init_ex(
+        &stage->options, options->alloc_opts, capacity, error_rate,
+        bloom_filter_calculate_size(capacity, error_rate),
+        options->hash_function_1, options->hash_function_2);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        goto free_stage;
+    }
+
+    /* very small stages may round down to zero hash functions. */
+    if (0 == stage->options.num_hash_functions)
+    {
+        stage->options.num_hash_functions = 1;
+    }
+
+    retval = bloom_filter_init(&stage->options, &stage->filter);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        goto dispose_stage_options;
+    }
+
+    stage->capacity = capacity;
+    stage->count = 0;
+
+    bloom->stages[bloom->num_stages] = stage;
+    ++bloom->num_stages;
+
+    return VPR_STATUS_SUCCESS;
+
+dispose_stage_options:
+    dispose(bloom_filter_options_disposable_handle(&stage->options));
+
+free_stage:
+    release(options->alloc_opts, stage);
+
+    return retval;
+}
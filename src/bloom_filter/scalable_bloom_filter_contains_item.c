@@ -0,0 +1,39 @@
+/**
+ * \file scalable_bloom_filter_contains_item.c
+ *
+ * Implementation of scalable_bloom_filter_contains_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+
+/**
+ * \brief Query a scalable bloom filter to determine if an item has been added.
+ *
+ * \param bloom             The scalable bloom filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool scalable_bloom_filter_contains_item(
+    scalable_bloom_filter_t* bloom, const void* data, size_t len)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_SCALABLE_BLOOM_FILTER(bloom));
+    MODEL_ASSERT(NULL != data);
+
+    /* the newest stages are the largest, so they are the most likely to hold
+     * any given item. */
+    for (size_t i = bloom->num_stages; i > 0; --i)
+    {
+        bloom_filter_t* filter = &bloom->stages[i - 1]->filter;
+        if (bloom_filter_contains_item(filter, data, len))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,104 @@
+/**
+ * \file scalable_bloom_filter_init.c
+ *
+ * Implementation of scalable_bloom_filter_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+
+#include "bloom_filter_internal.h"
+
+/**
+ * \brief The number of stage pointers reserved when the filter is created.
+ */
+#define SCALABLE_BLOOM_FILTER_INITIAL_RESERVED_STAGES 4
+
+/* forward decls for internal methods */
+static void scalable_bloom_filter_dispose(void*);
+
+/**
+ * \brief Initialize a scalable bloom filter.
+ *
+ * Once initialized, the filter will be empty and will consist of a single
+ * stage.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::scalable_bloom_filter_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed.
+ *
+ * \param options           The scalable bloom filter options to use for this
+ *                          instance.
+ * \param bloom             The scalable bloom filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED if memory could not be
+ *        allocated for the first stage.
+ *      - \ref VPR_ERROR_BLOOM_BITMAP_ALLOCATION_FAILED if memory could not
+ *        be allocated for the bitmap of the first stage.
+ */
+int scalable_bloom_filter_init(
+    scalable_bloom_filter_options_t* options, scalable_bloom_filter_t* bloom)
+{
+    int retval;
+
+    /* the scalable bloom filter structure must be non-null. */
+    MODEL_ASSERT(NULL != bloom);
+
+    /* sanity checks on options. */
+    MODEL_ASSERT(MODEL_PROP_VALID_SCALABLE_BLOOM_FILTER_OPTIONS(options));
+
+    bloom->hdr.dispose = &scalable_bloom_filter_dispose;
+    bloom->options = options;
+    bloom->num_stages = 0;
+    bloom->reserved_stages = SCALABLE_BLOOM_FILTER_INITIAL_RESERVED_STAGES;
+
+    /* allocate the stage array. */
+    bloom->stages = (scalable_bloom_filter_stage_t**)allocate(
+        options->alloc_opts,
+        bloom->reserved_stages * sizeof(scalable_bloom_filter_stage_t*));
+    if (NULL == bloom->stages)
+    {
+        return VPR_ERROR_BLOOM_STAGE_ALLOCATION_FAILED;
+    }
+
+    /* create the first stage. */
+    retval = scalable_bloom_filter_add_stage(bloom);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        release(options->alloc_opts, bloom->stages);
+        return retval;
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a scalable bloom filter.
+ *
+ * \param pbloom        An opaque pointer to the scalable bloom filter.
+ */
+static void scalable_bloom_filter_dispose(void* pbloom)
+{
+    MODEL_ASSERT(NULL != pbloom);
+
+    scalable_bloom_filter_t* bloom = (scalable_bloom_filter_t*)pbloom;
+    allocator_options_t* alloc_opts = bloom->options->alloc_opts;
+
+    MODEL_ASSERT(NULL != bloom->stages);
+
+    /* dispose of each stage. */
+    for (size_t i = 0; i < bloom->num_stages; ++i)
+    {
+        scalable_bloom_filter_stage_t* stage = bloom->stages[i];
+
+        dispose(bloom_filter_disposable_handle(&stage->filter));
+        dispose(bloom_filter_options_disposable_handle(&stage->options));
+        release(alloc_opts, stage);
+    }
+
+    release(alloc_opts, bloom->stages);
+}
@@ -0,0 +1,42 @@
+/**
+ * \file scalable_bloom_filter_options_init.c
+ *
+ * Implementation of scalable_bloom_filter_options_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+
+/**
+ * \brief Initialize scalable bloom filter options using default hash functions
+ * and growth parameters.
+ *
+ * The default hash functions are sdbm and jenkins.  Each stage has twice the
+ * capacity of the previous stage, and half of its error rate.
+ *
+ * \param options                  The scalable bloom filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param initial_capacity         The number of items held by the first stage
+ *                                 of the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int scalable_bloom_filter_options_init(
+    scalable_bloom_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t initial_capacity, float target_error_rate)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(initial_capacity > 0);
+    MODEL_ASSERT(target_error_rate > 0 && target_error_rate < 1.0);
+
+    return scalable_bloom_filter_options_init_ex(
+        options, alloc_opts, initial_capacity, target_error_rate,
+        SCALABLE_BLOOM_FILTER_DEFAULT_GROWTH_FACTOR,
+        SCALABLE_BLOOM_FILTER_DEFAULT_TIGHTENING_RATIO, &sdbm, &jenkins);
+}
@@ -0,0 +1,81 @@
+/**
+ * \file scalable_bloom_filter_options_init_ex.c
+ *
+ * Implementation of scalable_bloom_filter_options_init_ex.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+#include <vpr/parameters.h>
+
+/* forward decls for internal methods */
+static void scalable_bloom_filter_simple_dispose(void*);
+
+/**
+ * \brief Initialize scalable bloom filter options using user supplied hash
+ * functions and growth parameters.
+ *
+ * The first stage of the filter holds initial_capacity entries.  Each
+ * subsequent stage holds growth_factor times as many entries as the previous
+ * stage, and has tightening_ratio times its error rate.  A growth factor of 2
+ * or 4 and a tightening ratio between 0.5 and 0.9 are typical; a larger growth
+ * factor means fewer stages to query, and a larger tightening ratio means
+ * smaller stages with more hash functions.
+ *
+ * The supplied hash functions hash_function_1 and hash_function_2 should be
+ * capable of hashing an input value of arbitrary size and producing a 64 bit
+ * hashed value.  Every stage uses the same pair of hash functions.
+ *
+ * \param options                  The scalable bloom filter options to
+ *                                 initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param initial_capacity         The number of items held by the first stage
+ *                                 of the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ * \param growth_factor            The capacity multiplier for each new stage.
+ * \param tightening_ratio         The error rate multiplier for each new stage,
+ *                                 in the range (0,1).
+ * \param hash_function_1          A hash function
+ * \param hash_function_2          A hash function
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int scalable_bloom_filter_options_init_ex(
+    scalable_bloom_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t initial_capacity, float target_error_rate,
+    unsigned int growth_factor, float tightening_ratio,
+    hash_func_t hash_function_1, hash_func_t hash_function_2)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(initial_capacity > 0);
+    MODEL_ASSERT(target_error_rate > 0 && target_error_rate < 1.0);
+    MODEL_ASSERT(growth_factor > 0);
+    MODEL_ASSERT(tightening_ratio > 0 && tightening_ratio < 1.0);
+    MODEL_ASSERT(NULL != hash_function_1);
+    MODEL_ASSERT(NULL != hash_function_2);
+
+    options->hdr.dispose = &scalable_bloom_filter_simple_dispose;
+    options->alloc_opts = alloc_opts;
+    options->initial_capacity = initial_capacity;
+    options->target_error_rate = target_error_rate;
+    options->growth_factor = growth_factor;
+    options->tightening_ratio = tightening_ratio;
+    options->hash_function_1 = hash_function_1;
+    options->hash_function_2 = hash_function_2;
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of the options structure.  Nothing special needs to be done.
+ *
+ * \param poptions          Opaque pointer to the options structure.
+ */
+static void scalable_bloom_filter_simple_dispose(void* UNUSED(poptions))
+{
+    MODEL_ASSERT(poptions != NULL);
+}
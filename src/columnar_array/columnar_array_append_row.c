@@ -0,0 +1,64 @@
+/**
+ * \file columnar_array_append_row.c
+ *
+ * Implementation of columnar_array_append_row.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/columnar_array.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief The number of rows reserved when appending to an empty array.
+ */
+#define COLUMNAR_ARRAY_MINIMUM_RESERVE 8
+
+/**
+ * \brief Append a row to the end of a columnar array.
+ *
+ * The array doubles its reserve size when it is full.
+ *
+ * \param array             The array.
+ * \param values            One pointer per column, to the field to copy into
+ *                          that column.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if the array was full
+ *             and could not grow, in which case the array is unchanged.
+ */
+int columnar_array_append_row(
+    columnar_array_t* array, const void* const* values)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_COLUMNAR_ARRAY(array));
+    MODEL_ASSERT(NULL != values);
+
+    if (array->rows == array->reserved_rows)
+    {
+        size_t reserve =
+            array->reserved_rows < COLUMNAR_ARRAY_MINIMUM_RESERVE
+                ? COLUMNAR_ARRAY_MINIMUM_RESERVE
+                : 2 * array->reserved_rows;
+
+        int retval = columnar_array_reserve(array, reserve);
+        if (VPR_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    for (size_t c = 0; c < array->column_count; ++c)
+    {
+        columnar_array_column_t* column = array->columns + c;
+        memcpy(
+            column->data + array->rows * column->element_size, values[c],
+            column->element_size);
+    }
+
+    ++array->rows;
+
+    return VPR_STATUS_SUCCESS;
+}
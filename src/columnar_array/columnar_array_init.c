@@ -0,0 +1,109 @@
+/**
+ * \file columnar_array_init.c
+ *
+ * Implementation of columnar_array_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/columnar_array.h>
+#include <vpr/parameters.h>
+
+/* forward decls for internal methods */
+static void columnar_array_dispose(void* parray);
+
+/**
+ * \brief Initialize a columnar array.
+ *
+ * The array starts out with no rows, and with room for the given number of
+ * rows.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::columnar_array_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.
+ *
+ * \param array             The columnar array to initialize.
+ * \param alloc_opts        The allocator to use for this array.
+ * \param element_sizes     The size of the field in each column.
+ * \param column_count      The number of columns.
+ * \param reserve           The number of rows to reserve, which may be 0.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT if there are no
+ *             columns, or a column has a field size of 0.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the array.
+ */
+int columnar_array_init(
+    columnar_array_t* array, allocator_options_t* alloc_opts,
+    const size_t* element_sizes, size_t column_count, size_t reserve)
+{
+    MODEL_ASSERT(NULL != array);
+    MODEL_ASSERT(prop_allocator_valid(alloc_opts));
+    MODEL_ASSERT(NULL != element_sizes || 0 == column_count);
+
+    if (0 == column_count)
+    {
+        return VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT;
+    }
+
+    for (size_t c = 0; c < column_count; ++c)
+    {
+        if (0 == element_sizes[c])
+        {
+            return VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT;
+        }
+    }
+
+    array->columns =
+        (columnar_array_column_t*)allocate(
+            alloc_opts, column_count * sizeof(columnar_array_column_t));
+    if (NULL == array->columns)
+    {
+        return VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED;
+    }
+
+    for (size_t c = 0; c < column_count; ++c)
+    {
+        array->columns[c].element_size = element_sizes[c];
+        array->columns[c].data = NULL;
+    }
+
+    array->hdr.dispose = &columnar_array_dispose;
+    array->alloc_opts = alloc_opts;
+    array->column_count = column_count;
+    array->rows = 0;
+    array->reserved_rows = 0;
+    array->block = NULL;
+
+    /* reserve the initial rows, if any. */
+    int retval = columnar_array_reserve(array, reserve);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        release(alloc_opts, array->columns);
+        return retval;
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a columnar array.
+ *
+ * \param parray        An opaque pointer to the columnar array.
+ */
+static void columnar_array_dispose(void* parray)
+{
+    MODEL_ASSERT(NULL != parray);
+
+    columnar_array_t* array = (columnar_array_t*)parray;
+
+    if (NULL != array->block)
+    {
+        release(array->alloc_opts, array->block);
+    }
+
+    release(array->alloc_opts, array->columns);
+}
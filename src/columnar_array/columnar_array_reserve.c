@@ -0,0 +1,96 @@
+/**
+ * \file columnar_array_reserve.c
+ *
+ * Implementation of columnar_array_reserve.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/columnar_array.h>
+#include <vpr/parameters.h>
+
+/* forward decls for internal methods */
+static inline size_t columnar_array_padded(size_t size);
+
+/**
+ * \brief Ensure that a columnar array has room for the given number of rows.
+ *
+ * If the array must grow, every column is moved to a new block, so that
+ * pointers to the columns are invalidated.
+ *
+ * \param array             The array.
+ * \param rows              The number of rows.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the larger array, in which case the array is
+ *             unchanged.
+ */
+int columnar_array_reserve(columnar_array_t* array, size_t rows)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_COLUMNAR_ARRAY(array));
+
+    if (rows <= array->reserved_rows)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /* the columns share one block, each padded to the alignment; the block
+     * has room to align the first column. */
+    size_t total = COLUMNAR_ARRAY_ALIGNMENT - 1;
+    for (size_t c = 0; c < array->column_count; ++c)
+    {
+        total += columnar_array_padded(rows * array->columns[c].element_size);
+    }
+
+    void* block = allocate(array->alloc_opts, total);
+    if (NULL == block)
+    {
+        return VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED;
+    }
+
+    uint8_t* data =
+        (uint8_t*)(
+            ((uintptr_t)block + COLUMNAR_ARRAY_ALIGNMENT - 1)
+          & ~(uintptr_t)(COLUMNAR_ARRAY_ALIGNMENT - 1));
+
+    /* move each column to its place in the new block. */
+    for (size_t c = 0; c < array->column_count; ++c)
+    {
+        columnar_array_column_t* column = array->columns + c;
+        if (array->rows > 0)
+        {
+            memcpy(data, column->data, array->rows * column->element_size);
+        }
+
+        column->data = data;
+        data += columnar_array_padded(rows * column->element_size);
+    }
+
+    if (NULL != array->block)
+    {
+        release(array->alloc_opts, array->block);
+    }
+
+    array->block = block;
+    array->reserved_rows = rows;
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Round a size up to a multiple of the column alignment.
+ *
+ * \param size              The size.
+ *
+ * \returns the padded size.
+ */
+static inline size_t columnar_array_padded(size_t size)
+{
+    return
+        (size + COLUMNAR_ARRAY_ALIGNMENT - 1)
+      & ~(size_t)(COLUMNAR_ARRAY_ALIGNMENT - 1);
+}
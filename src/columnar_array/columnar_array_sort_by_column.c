@@ -0,0 +1,248 @@
+/**
+ * \file columnar_array_sort_by_column.c
+ *
+ * Implementation of columnar_array_sort_by_column.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/columnar_array.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Runs of up to this many rows are sorted by insertion sort before
+ * merging.
+ */
+#define COLUMNAR_ARRAY_SORT_RUN 16
+
+/* forward decls for internal methods */
+static size_t* columnar_array_sort_permutation(
+    const columnar_array_column_t* key, compare_method_t compare,
+    size_t* order, size_t* scratch, size_t rows);
+static void columnar_array_gather(
+    uint8_t* output, const uint8_t* input, const size_t* order, size_t rows,
+    size_t size);
+
+/**
+ * \brief Stable sort the rows of a columnar array by the fields of one column.
+ *
+ * The rows are ordered by the key column, and the same permutation is then
+ * applied to every other column, one column at a time.  Rows with equal keys
+ * keep their order, so that a table can be sorted by several columns in turn,
+ * from the least significant column to the most significant column.  A single
+ * scratch buffer is allocated, which holds the permutation and one column.
+ *
+ * \param array             The array to sort.
+ * \param column            The key column.
+ * \param compare           The method comparing fields of the key column.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT if the column does not
+ *             exist.
+ *      - \ref VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the scratch buffer, in which case the array is
+ *             unchanged.
+ */
+int columnar_array_sort_by_column(
+    columnar_array_t* array, size_t column, compare_method_t compare)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_COLUMNAR_ARRAY(array));
+    MODEL_ASSERT(NULL != compare);
+
+    if (column >= array->column_count)
+    {
+        return VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT;
+    }
+
+    size_t rows = array->rows;
+    if (rows < 2)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    size_t widest = 0;
+    for (size_t c = 0; c < array->column_count; ++c)
+    {
+        if (array->columns[c].element_size > widest)
+        {
+            widest = array->columns[c].element_size;
+        }
+    }
+
+    /* the permutation and its merge buffer come first, to keep them
+     * aligned; the column being permuted is gathered after them. */
+    size_t* order =
+        (size_t*)allocate(
+            array->alloc_opts, rows * (2 * sizeof(size_t) + widest));
+    if (NULL == order)
+    {
+        return VPR_ERROR_COLUMNAR_ARRAY_ALLOCATION_FAILED;
+    }
+
+    size_t* sorted =
+        columnar_array_sort_permutation(
+            array->columns + column, compare, order, order + rows, rows);
+    uint8_t* gathered = (uint8_t*)(order + 2 * rows);
+
+    /* gather each column in sorted order, then copy it back. */
+    for (size_t c = 0; c < array->column_count; ++c)
+    {
+        columnar_array_column_t* current = array->columns + c;
+        columnar_array_gather(
+            gathered, current->data, sorted, rows, current->element_size);
+        memcpy(current->data, gathered, rows * current->element_size);
+    }
+
+    release(array->alloc_opts, order);
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Compute the stable sorted order of the rows of a key column.
+ *
+ * Runs of rows are sorted by insertion sort, then merged pairwise, switching
+ * between the two buffers on each pass.
+ *
+ * \param key               The key column.
+ * \param compare           The method comparing fields of the key column.
+ * \param order             A buffer for the permutation.
+ * \param scratch           A second buffer of the same size.
+ * \param rows              The number of rows.
+ *
+ * \returns the buffer holding the row numbers in sorted order, which is
+ *          either order or scratch.
+ */
+static size_t* columnar_array_sort_permutation(
+    const columnar_array_column_t* key, compare_method_t compare,
+    size_t* order, size_t* scratch, size_t rows)
+{
+    const uint8_t* data = key->data;
+    size_t size = key->element_size;
+
+    for (size_t first = 0; first < rows; first += COLUMNAR_ARRAY_SORT_RUN)
+    {
+        size_t last =
+            rows - first < COLUMNAR_ARRAY_SORT_RUN
+                ? rows : first + COLUMNAR_ARRAY_SORT_RUN;
+
+        for (size_t i = first; i < last; ++i)
+        {
+            size_t row = i;
+            size_t j = i;
+            while (
+                j > first
+             && compare(data + order[j - 1] * size, data + row * size, size)
+                    > 0)
+            {
+                order[j] = order[j - 1];
+                --j;
+            }
+
+            order[j] = row;
+        }
+    }
+
+    size_t* input = order;
+    size_t* output = scratch;
+    for (size_t width = COLUMNAR_ARRAY_SORT_RUN; width < rows; width *= 2)
+    {
+        for (size_t first = 0; first < rows; first += 2 * width)
+        {
+            size_t middle = rows - first < width ? rows : first + width;
+            size_t last = rows - middle < width ? rows : middle + width;
+            size_t left = first, right = middle, out = first;
+
+            /* take from the left run unless the right key is smaller, which
+             * keeps equal keys in order. */
+            while (left < middle && right < last)
+            {
+                if (
+                    compare(
+                        data + input[right] * size, data + input[left] * size,
+                        size) < 0)
+                {
+                    output[out++] = input[right++];
+                }
+                else
+                {
+                    output[out++] = input[left++];
+                }
+            }
+
+            while (left < middle)
+            {
+                output[out++] = input[left++];
+            }
+
+            while (right < last)
+            {
+                output[out++] = input[right++];
+            }
+        }
+
+        size_t* tmp = input;
+        input = output;
+        output = tmp;
+    }
+
+    return input;
+}
+
+/**
+ * \brief Gather the fields of a column in the given order.
+ *
+ * Fields of 1, 2, 4, or 8 bytes are copied with fixed-size copies, which
+ * compile to single loads and stores.
+ *
+ * \param output            The buffer receiving the fields.
+ * \param input             The column.
+ * \param order             The row numbers, in the order to gather them.
+ * \param rows              The number of rows.
+ * \param size              The size of each field.
+ */
+static void columnar_array_gather(
+    uint8_t* output, const uint8_t* input, const size_t* order, size_t rows,
+    size_t size)
+{
+    switch (size)
+    {
+        case 1:
+            for (size_t i = 0; i < rows; ++i)
+            {
+                output[i] = input[order[i]];
+            }
+            break;
+
+        case 2:
+            for (size_t i = 0; i < rows; ++i)
+            {
+                memcpy(output + i * 2, input + order[i] * 2, 2);
+            }
+            break;
+
+        case 4:
+            for (size_t i = 0; i < rows; ++i)
+            {
+                memcpy(output + i * 4, input + order[i] * 4, 4);
+            }
+            break;
+
+        case 8:
+            for (size_t i = 0; i < rows; ++i)
+            {
+                memcpy(output + i * 8, input + order[i] * 8, 8);
+            }
+            break;
+
+        default:
+            for (size_t i = 0; i < rows; ++i)
+            {
+                memcpy(output + i * size, input + order[i] * size, size);
+            }
+            break;
+    }
+}
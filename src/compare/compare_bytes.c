@@ -0,0 +1,40 @@
+/**
+ * \file compare_bytes.c
+ *
+ * Implementation of compare_bytes.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/compare.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Compare two values of any size as strings of bytes.
+ *
+ * Values are ordered as by memcmp(), so two values compare as equal only if
+ * their bytes are identical.  Searches that use this method compare several
+ * elements at once where the platform supports it.
+ *
+ * \param x             The left-hand element.
+ * \param y             The right-hand element.
+ * \param size          The size of each value.
+ *
+ * \returns (> 0 if x > y) (< 0 if x < y) (== 0 if x == y)
+ */
+int compare_bytes(const void* x, const void* y, size_t size)
+{
+    MODEL_ASSERT(x != NULL);
+    MODEL_ASSERT(y != NULL);
+
+    int result = memcmp(x, y, size);
+
+    if (result > 0)
+        return VPR_COMPARE_GREATER;
+    else if (result < 0)
+        return VPR_COMPARE_LESS;
+    else
+        return VPR_COMPARE_EQUAL;
+}
@@ -0,0 +1,12 @@
+/**
+ * \file cuckoo_filter/concrete_inline_impls.c
+ *
+ * \brief Provide concrete implementations for inline functions for debug-time
+ * linkage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#define VPR_CUCKOO_FILTER_CONCRETE_IMPLEMENTATION
+
+#include <vpr/cuckoo_filter.h>
@@ -0,0 +1,52 @@
+/**
+ * \file cuckoo_filter_add_item.c
+ *
+ * Implementation of cuckoo_filter_add_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "cuckoo_filter_internal.h"
+
+/**
+ * \brief Add an item to a cuckoo filter.
+ *
+ * An item may be added more than once, in which case it must be removed as
+ * many times before it is no longer reported.  At most
+ * 2 * CUCKOO_FILTER_BUCKET_SIZE copies of an item can be held.
+ *
+ * \param filter            The cuckoo filter.
+ * \param data              The data to add to the filter.
+ * \param len               The size of the data to add to the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_CUCKOO_FILTER_FULL if the filter is full.  The filter
+ *        is left unchanged.
+ */
+int cuckoo_filter_add_item(
+    cuckoo_filter_t* filter, const void* data, size_t len)
+{
+    size_t index;
+    uint32_t fingerprint;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER(filter));
+    MODEL_ASSERT(NULL != data);
+    MODEL_ASSERT(len > 0);
+
+    /* a pending victim means that the last insert could not be placed. */
+    if (filter->has_victim)
+    {
+        return VPR_ERROR_CUCKOO_FILTER_FULL;
+    }
+
+    cuckoo_filter_hash(filter->options, data, len, &index, &fingerprint);
+    cuckoo_filter_insert_fingerprint(filter, index, fingerprint);
+    ++filter->count;
+
+    /* this item is stored even if some other fingerprint became the victim,
+     * so the add succeeds. */
+    return VPR_STATUS_SUCCESS;
+}
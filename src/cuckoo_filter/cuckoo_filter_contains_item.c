@@ -0,0 +1,47 @@
+/**
+ * \file cuckoo_filter_contains_item.c
+ *
+ * Implementation of cuckoo_filter_contains_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "cuckoo_filter_internal.h"
+
+/**
+ * \brief Query a cuckoo filter to determine if an item has been added.
+ *
+ * \param filter            The cuckoo filter.
+ * \param data              The data to query the filter for.
+ * \param len               The size of the data to query for.
+ *
+ * \returns a boolean value indicating if the data is present in the filter.
+ */
+_Bool cuckoo_filter_contains_item(
+    cuckoo_filter_t* filter, const void* data, size_t len)
+{
+    size_t index;
+    uint32_t fingerprint;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER(filter));
+    MODEL_ASSERT(NULL != data);
+
+    cuckoo_filter_hash(filter->options, data, len, &index, &fingerprint);
+    size_t alt_index =
+        cuckoo_filter_alt_index(filter->options, index, fingerprint);
+
+    if (filter->has_victim
+     && fingerprint == filter->victim_fingerprint
+     && (index == filter->victim_index || alt_index == filter->victim_index))
+    {
+        return true;
+    }
+
+    return
+        CUCKOO_FILTER_BUCKET_SIZE
+            != cuckoo_filter_find(filter, index, fingerprint)
+     || CUCKOO_FILTER_BUCKET_SIZE
+            != cuckoo_filter_find(filter, alt_index, fingerprint);
+}
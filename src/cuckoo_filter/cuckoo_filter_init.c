@@ -0,0 +1,79 @@
+/**
+ * \file cuckoo_filter_init.c
+ *
+ * Implementation of cuckoo_filter_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <cbmc/model_assert.h>
+#include <vpr/cuckoo_filter.h>
+
+/* forward decls for internal methods */
+static void cuckoo_filter_dispose(void*);
+
+/**
+ * \brief Initialize a cuckoo filter.
+ *
+ * This method allows for the creation of a cuckoo filter.  Once initialized,
+ * the filter will be empty.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::cuckoo_filter_t instance and must dispose of it by calling dispose()
+ * when it is no longer needed.
+ *
+ * \param options           The cuckoo filter options to use for this instance.
+ * \param filter            The cuckoo filter to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_CUCKOO_FILTER_ALLOCATION_FAILED if memory could not
+ *        be allocated for the buckets.
+ */
+int cuckoo_filter_init(
+    cuckoo_filter_options_t* options, cuckoo_filter_t* filter)
+{
+    MODEL_ASSERT(NULL != filter);
+    MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER_OPTIONS(options));
+
+    size_t size =
+        options->num_buckets * CUCKOO_FILTER_BUCKET_SIZE
+            * options->fingerprint_size;
+
+    filter->buckets = allocate(options->alloc_opts, size);
+    if (NULL == filter->buckets)
+    {
+        return VPR_ERROR_CUCKOO_FILTER_ALLOCATION_FAILED;
+    }
+
+    /* every slot starts empty. */
+    MODEL_EXEMPT(memset(filter->buckets, 0, size));
+
+    filter->hdr.dispose = &cuckoo_filter_dispose;
+    filter->options = options;
+    filter->count = 0;
+    filter->has_victim = false;
+    filter->victim_fingerprint = 0;
+    filter->victim_index = 0;
+    filter->kick_state = 0x9e3779b9;
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a cuckoo filter.
+ *
+ * \param pfilter       An opaque pointer to the cuckoo filter.
+ */
+static void cuckoo_filter_dispose(void* pfilter)
+{
+    MODEL_ASSERT(NULL != pfilter);
+
+    cuckoo_filter_t* filter = (cuckoo_filter_t*)pfilter;
+
+    MODEL_ASSERT(NULL != filter->options);
+    MODEL_ASSERT(NULL != filter->buckets);
+
+    release(filter->options->alloc_opts, filter->buckets);
+}
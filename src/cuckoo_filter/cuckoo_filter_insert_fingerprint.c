@@ -0,0 +1,77 @@
+/**
+ * \file cuckoo_filter_insert_fingerprint.c
+ *
+ * Implementation of cuckoo_filter_insert_fingerprint.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "cuckoo_filter_internal.h"
+
+/**
+ * \brief Insert a fingerprint into one of its candidate buckets, relocating
+ * other fingerprints as needed.
+ *
+ * If no slot can be found within max_kicks relocations, then the fingerprint
+ * left over is stored as the victim of the filter.
+ *
+ * \param filter            The cuckoo filter, which must not have a victim.
+ * \param index             One of the candidate buckets of the fingerprint.
+ * \param fingerprint       The fingerprint to insert.
+ */
+void cuckoo_filter_insert_fingerprint(
+    cuckoo_filter_t* filter, size_t index, uint32_t fingerprint)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER(filter));
+    MODEL_ASSERT(!filter->has_victim);
+    MODEL_ASSERT(0 != fingerprint);
+
+    const cuckoo_filter_options_t* options = filter->options;
+    unsigned int slot;
+
+    /* try both candidate buckets before relocating anything. */
+    slot = cuckoo_filter_find(filter, index, 0);
+    if (CUCKOO_FILTER_BUCKET_SIZE != slot)
+    {
+        cuckoo_filter_set(filter, index, slot, fingerprint);
+        return;
+    }
+
+    index = cuckoo_filter_alt_index(options, index, fingerprint);
+    slot = cuckoo_filter_find(filter, index, 0);
+    if (CUCKOO_FILTER_BUCKET_SIZE != slot)
+    {
+        cuckoo_filter_set(filter, index, slot, fingerprint);
+        return;
+    }
+
+    /* evict a fingerprint from a full bucket and move it to its other
+     * bucket, until one has room. */
+    for (unsigned int kick = 0; kick < options->max_kicks; ++kick)
+    {
+        /* xorshift32 */
+        filter->kick_state ^= filter->kick_state << 13;
+        filter->kick_state ^= filter->kick_state >> 17;
+        filter->kick_state ^= filter->kick_state << 5;
+        slot = filter->kick_state % CUCKOO_FILTER_BUCKET_SIZE;
+
+        uint32_t evicted = cuckoo_filter_get(filter, index, slot);
+        cuckoo_filter_set(filter, index, slot, fingerprint);
+        fingerprint = evicted;
+
+        index = cuckoo_filter_alt_index(options, index, fingerprint);
+        slot = cuckoo_filter_find(filter, index, 0);
+        if (CUCKOO_FILTER_BUCKET_SIZE != slot)
+        {
+            cuckoo_filter_set(filter, index, slot, fingerprint);
+            return;
+        }
+    }
+
+    /* the table is effectively full; hold on to the homeless fingerprint. */
+    filter->has_victim = true;
+    filter->victim_fingerprint = fingerprint;
+    filter->victim_index = index;
+}
@@ -0,0 +1,156 @@
+/**
+ * \file cuckoo_filter_internal.h
+ *
+ * \brief Internal helpers shared by the cuckoo filter implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_CUCKOO_FILTER_INTERNAL_HEADER_GUARD
+#define VPR_CUCKOO_FILTER_INTERNAL_HEADER_GUARD
+
+#include <string.h>
+#include <vpr/cuckoo_filter.h>
+
+/**
+ * \brief Hash an item to its primary bucket and its fingerprint.
+ *
+ * Zero marks an empty slot, so a fingerprint of zero is stored as one.
+ *
+ * \param options           The cuckoo filter options.
+ * \param data              The data to hash.
+ * \param len               The length of the data to hash.
+ * \param index             Set to the primary bucket of the item.
+ * \param fingerprint       Set to the fingerprint of the item.
+ */
+static inline void cuckoo_filter_hash(
+    const cuckoo_filter_options_t* options, const void* data, size_t len,
+    size_t* index, uint32_t* fingerprint)
+{
+    uint64_t fp = options->hash_function_2(data, len);
+
+    if (options->fingerprint_size < sizeof(uint32_t))
+    {
+        fp &= (UINT32_C(1) << (8 * options->fingerprint_size)) - 1;
+    }
+
+    *index = options->hash_function_1(data, len) & (options->num_buckets - 1);
+    *fingerprint = 0 == (uint32_t)fp ? 1 : (uint32_t)fp;
+}
+
+/**
+ * \brief Get the other candidate bucket for a fingerprint.
+ *
+ * The two candidate buckets of a fingerprint differ by a hash of the
+ * fingerprint, so either one can be found from the other without the item.
+ *
+ * \param options           The cuckoo filter options.
+ * \param index             One of the candidate buckets.
+ * \param fingerprint       The fingerprint.
+ *
+ * \returns the other candidate bucket.
+ */
+static inline size_t cuckoo_filter_alt_index(
+    const cuckoo_filter_options_t* options, size_t index, uint32_t fingerprint)
+{
+    return
+        (index ^ ((size_t)fingerprint * UINT32_C(0x5bd1e995)))
+            & (options->num_buckets - 1);
+}
+
+/**
+ * \brief Read the fingerprint in a slot.
+ *
+ * \param filter            The cuckoo filter.
+ * \param index             The bucket.
+ * \param slot              The slot within the bucket.
+ *
+ * \returns the fingerprint in the slot, or zero if the slot is empty.
+ */
+static inline uint32_t cuckoo_filter_get(
+    const cuckoo_filter_t* filter, size_t index, unsigned int slot)
+{
+    size_t pos = index * CUCKOO_FILTER_BUCKET_SIZE + slot;
+
+    switch (filter->options->fingerprint_size)
+    {
+        case 1:
+            return ((const uint8_t*)filter->buckets)[pos];
+
+        case 2:
+            return ((const uint16_t*)filter->buckets)[pos];
+
+        default:
+            return ((const uint32_t*)filter->buckets)[pos];
+    }
+}
+
+/**
+ * \brief Write a fingerprint to a slot.
+ *
+ * \param filter            The cuckoo filter.
+ * \param index             The bucket.
+ * \param slot              The slot within the bucket.
+ * \param fingerprint       The fingerprint, or zero to empty the slot.
+ */
+static inline void cuckoo_filter_set(
+    cuckoo_filter_t* filter, size_t index, unsigned int slot,
+    uint32_t fingerprint)
+{
+    size_t pos = index * CUCKOO_FILTER_BUCKET_SIZE + slot;
+
+    switch (filter->options->fingerprint_size)
+    {
+        case 1:
+            ((uint8_t*)filter->buckets)[pos] = (uint8_t)fingerprint;
+            break;
+
+        case 2:
+            ((uint16_t*)filter->buckets)[pos] = (uint16_t)fingerprint;
+            break;
+
+        default:
+            ((uint32_t*)filter->buckets)[pos] = fingerprint;
+            break;
+    }
+}
+
+/**
+ * \brief Find a fingerprint in a bucket.
+ *
+ * \param filter            The cuckoo filter.
+ * \param index             The bucket.
+ * \param fingerprint       The fingerprint to find; zero finds an empty slot.
+ *
+ * \returns the slot holding the fingerprint, or CUCKOO_FILTER_BUCKET_SIZE if
+ * the bucket does not hold it.
+ */
+static inline unsigned int cuckoo_filter_find(
+    const cuckoo_filter_t* filter, size_t index, uint32_t fingerprint)
+{
+    for (unsigned int slot = 0; slot < CUCKOO_FILTER_BUCKET_SIZE; ++slot)
+    {
+        if (fingerprint == cuckoo_filter_get(filter, index, slot))
+        {
+            return slot;
+        }
+    }
+
+    return CUCKOO_FILTER_BUCKET_SIZE;
+}
+
+/**
+ * \brief Insert a fingerprint into one of its candidate buckets, relocating
+ * other fingerprints as needed.
+ *
+ * If no slot can be found within max_kicks relocations, then the fingerprint
+ * left over is stored as the victim of the filter.
+ *
+ * \param filter            The cuckoo filter, which must not have a victim.
+ * \param index             One of the candidate buckets of the fingerprint.
+ * \param fingerprint       The fingerprint to insert.
+ */
+void cuckoo_filter_insert_fingerprint(
+    cuckoo_filter_t* filter, size_t index, uint32_t fingerprint);
+
+#endif  //VPR_CUCKOO_FILTER_INTERNAL_HEADER_GUARD
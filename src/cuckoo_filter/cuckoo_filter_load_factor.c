@@ -0,0 +1,26 @@
+/**
+ * \file cuckoo_filter_load_factor.c
+ *
+ * Implementation of cuckoo_filter_load_factor.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/cuckoo_filter.h>
+
+/**
+ * \brief Get the load factor of a cuckoo filter.
+ *
+ * \param filter            The cuckoo filter.
+ *
+ * \returns the fraction of fingerprint slots which are in use.
+ */
+float cuckoo_filter_load_factor(const cuckoo_filter_t* filter)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER(filter));
+
+    return
+        (float)filter->count
+            / (filter->options->num_buckets * CUCKOO_FILTER_BUCKET_SIZE);
+}
@@ -0,0 +1,47 @@
+/**
+ * \file cuckoo_filter_options_init.c
+ *
+ * Implementation of cuckoo_filter_options_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/cuckoo_filter.h>
+
+/**
+ * \brief Initialize cuckoo filter options using default hash functions.
+ *
+ * Initialize the cuckoo filter options using default hash functions.  Those
+ * hash functions are sdbm and jenkins.  The num_expected_entries parameter
+ * should be an upper bound on the number of entries that will be in the
+ * filter at once.  Unlike a bloom filter, a cuckoo filter has a hard capacity;
+ * once it is full, further inserts fail.
+ *
+ * The target_error_rate is the desired rate of false positives, expressed as
+ * a percentage in the range (0,1).  It determines the fingerprint size: 1 byte
+ * for rates of about 3% and above, 2 bytes for rates down to about 0.01%, and 4
+ * bytes below that.
+ *
+ * \param options                  The cuckoo filter options to initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param num_expected_entries     The number of items that are expected to be
+ *                                 added to the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int cuckoo_filter_options_init(
+    cuckoo_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t num_expected_entries, float target_error_rate)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(num_expected_entries > 0);
+    MODEL_ASSERT(target_error_rate > 0 && target_error_rate < 1.0);
+
+    return cuckoo_filter_options_init_ex(
+        options, alloc_opts, num_expected_entries, target_error_rate, &sdbm,
+        &jenkins);
+}
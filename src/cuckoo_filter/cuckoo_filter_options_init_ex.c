@@ -0,0 +1,105 @@
+/**
+ * \file cuckoo_filter_options_init_ex.c
+ *
+ * Implementation of cuckoo_filter_options_init_ex.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <math.h>
+#include <cbmc/model_assert.h>
+#include <vpr/cuckoo_filter.h>
+#include <vpr/parameters.h>
+
+/* forward decls for internal methods */
+static void cuckoo_filter_simple_dispose(void*);
+
+/**
+ * \brief Initialize cuckoo filter options using user supplied hash functions.
+ *
+ * The num_expected_entries parameter should be an upper bound on the number of
+ * entries that will be in the filter at once.  The filter is sized so that
+ * this many entries fill it to CUCKOO_FILTER_TARGET_LOAD_FACTOR or less.
+ *
+ * The target_error_rate is the desired rate of false positives, expressed as
+ * a percentage in the range (0,1).  It determines the fingerprint size: 1 byte
+ * for rates of about 3% and above, 2 bytes for rates down to about 0.01%, and 4
+ * bytes below that.
+ *
+ * The supplied hash functions hash_function_1 and hash_function_2 should be
+ * capable of hashing an input value of arbitrary size and producing a 64 bit
+ * hashed value.  The first selects the primary bucket of an item, and the
+ * second derives its fingerprint, so they must be independent of each other.
+ *
+ * \param options                  The cuckoo filter options to initialize.
+ * \param alloc_opts               The allocator options to use.
+ * \param num_expected_entries     The number of items that are expected to be
+ *                                 added to the filter.
+ * \param target_error_rate        The desired error rate for false positives.
+ * \param hash_function_1          A hash function
+ * \param hash_function_2          A hash function
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ */
+int cuckoo_filter_options_init_ex(
+    cuckoo_filter_options_t* options, allocator_options_t* alloc_opts,
+    size_t num_expected_entries, float target_error_rate,
+    hash_func_t hash_function_1, hash_func_t hash_function_2)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(num_expected_entries > 0);
+    MODEL_ASSERT(target_error_rate > 0 && target_error_rate < 1.0);
+    MODEL_ASSERT(NULL != hash_function_1);
+    MODEL_ASSERT(NULL != hash_function_2);
+
+    options->hdr.dispose = &cuckoo_filter_simple_dispose;
+    options->alloc_opts = alloc_opts;
+    options->num_expected_entries = num_expected_entries;
+    options->max_kicks = CUCKOO_FILTER_DEFAULT_MAX_KICKS;
+    options->hash_function_1 = hash_function_1;
+    options->hash_function_2 = hash_function_2;
+
+    /* a query compares against up to 2b fingerprints of f bits, so the error
+     * rate is about 2b / 2^f. */
+    double fingerprint_bits =
+        ceil(log2(2.0 * CUCKOO_FILTER_BUCKET_SIZE / target_error_rate));
+    if (fingerprint_bits <= 8)
+    {
+        options->fingerprint_size = 1;
+    }
+    else if (fingerprint_bits <= 16)
+    {
+        options->fingerprint_size = 2;
+    }
+    else
+    {
+        options->fingerprint_size = 4;
+    }
+
+    /* the alternate bucket is found by xor, so the number of buckets must be
+     * a power of two. */
+    double min_buckets =
+        ceil(
+            num_expected_entries
+                / (CUCKOO_FILTER_BUCKET_SIZE
+                    * CUCKOO_FILTER_TARGET_LOAD_FACTOR));
+    options->num_buckets = 1;
+    while (options->num_buckets < min_buckets)
+    {
+        options->num_buckets *= 2;
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of the options structure.  Nothing special needs to be done.
+ *
+ * \param poptions          Opaque pointer to the options structure.
+ */
+static void cuckoo_filter_simple_dispose(void* UNUSED(poptions))
+{
+    MODEL_ASSERT(poptions != NULL);
+}
@@ -0,0 +1,78 @@
+/**
+ * \file cuckoo_filter_remove_item.c
+ *
+ * Implementation of cuckoo_filter_remove_item.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "cuckoo_filter_internal.h"
+
+/**
+ * \brief Remove an item from a cuckoo filter.
+ *
+ * Only items which were previously added should be removed.  Removing an item
+ * which was never added, but which shares a fingerprint and bucket with an
+ * item that was, removes that other item instead.
+ *
+ * \param filter            The cuckoo filter.
+ * \param data              The data to remove from the filter.
+ * \param len               The size of the data to remove from the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_CUCKOO_FILTER_ITEM_NOT_FOUND if the item is not in the
+ *        filter.
+ */
+int cuckoo_filter_remove_item(
+    cuckoo_filter_t* filter, const void* data, size_t len)
+{
+    size_t index;
+    uint32_t fingerprint;
+    unsigned int slot;
+
+    MODEL_ASSERT(MODEL_PROP_VALID_CUCKOO_FILTER(filter));
+    MODEL_ASSERT(NULL != data);
+    MODEL_ASSERT(len > 0);
+
+    cuckoo_filter_hash(filter->options, data, len, &index, &fingerprint);
+    size_t alt_index =
+        cuckoo_filter_alt_index(filter->options, index, fingerprint);
+
+    /* if the victim is this item, dropping it is all that is needed. */
+    if (filter->has_victim
+     && fingerprint == filter->victim_fingerprint
+     && (index == filter->victim_index || alt_index == filter->victim_index))
+    {
+        filter->has_victim = false;
+        --filter->count;
+
+        return VPR_STATUS_SUCCESS;
+    }
+
+    slot = cuckoo_filter_find(filter, index, fingerprint);
+    if (CUCKOO_FILTER_BUCKET_SIZE == slot)
+    {
+        index = alt_index;
+        slot = cuckoo_filter_find(filter, index, fingerprint);
+        if (CUCKOO_FILTER_BUCKET_SIZE == slot)
+        {
+            return VPR_ERROR_CUCKOO_FILTER_ITEM_NOT_FOUND;
+        }
+    }
+
+    cuckoo_filter_set(filter, index, slot, 0);
+    --filter->count;
+
+    /* a slot has opened up, so give the victim another chance. */
+    if (filter->has_victim)
+    {
+        filter->has_victim = false;
+        cuckoo_filter_insert_fingerprint(
+            filter, filter->victim_index, filter->victim_fingerprint);
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -4,9 +4,11 @@
  * \brief Provide concrete implementations for inline functions for debug-time
  * linkage.
  *
- * \copyright 2021 Velo Payments, Inc.  All rights reserved.
+ * \copyright 2021-2026 Velo Payments, Inc.  All rights reserved.
  */
 
 #define VPR_DYNAMIC_ARRAY_CONCRETE_IMPLEMENTATION
+#define VPR_DYNAMIC_ARRAY_MAPPED_CONCRETE_IMPLEMENTATION
 
 #include <vpr/dynamic_array.h>
+#include <vpr/dynamic_array/dynamic_array_mapped.h>
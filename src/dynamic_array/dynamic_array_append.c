@@ -7,17 +7,22 @@
  */
 
 #include <cbmc/model_assert.h>
+#include <stdint.h>
 #include <string.h>
 #include <vpr/dynamic_array.h>
 #include <vpr/parameters.h>
 
+#include "dynamic_array_internal.h"
+
 /**
  * \brief Append an element to the end of the dynamic array.
  *
- * If the reserved size is not large enough for this operation, then it will
- * fail.  Users should grow the array using dynamic_array_grow() to change the
- * size of this structure prior to calling this method if the reserved space has
- * been exhausted.
+ * If the reserved size is not large enough for this operation, and the array
+ * options have a growth factor set with
+ * dynamic_array_options_set_growth_factor(), then the array is grown by that
+ * factor first.  Otherwise, it will fail.  Users should grow the array using
+ * dynamic_array_grow() to change the size of this structure prior to calling
+ * this method if the reserved space has been exhausted.
  *
  * If successful, then a copy of this element will be placed at the end of this
  * array using the defined copy method.
@@ -28,7 +33,10 @@
  * \returns a status code indicating success or failure.
  *          - \ref VPR_STATUS_SUCCESS if successful.
  *          - \ref VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE if there is no
- *                 reserve room left for appending this element.
+ *                 reserve room left for appending this element, and automatic
+ *                 growth is disabled.
+ *          - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the array
+ *                 could not be grown.
  */
 int dynamic_array_append(dynamic_array_t* array, void* element)
 {
@@ -38,21 +46,33 @@ int dynamic_array_append(dynamic_array_t* array, void* element)
     MODEL_ASSERT(array->options != NULL);
     MODEL_ASSERT(array->options->element_size > 0);
     MODEL_ASSERT(array->options->dynamic_array_element_copy != NULL);
-    MODEL_ASSERT(array->elements < array->reserved_elements);
+    MODEL_ASSERT(
+        array->elements < array->reserved_elements
+     || array->options->growth_factor > 1.0f);
 
     //we need at least one reserved slot for this append to work
-    if (array->elements >= array->reserved_elements)
+    int retval = dynamic_array_reserve_one(array);
+    if (VPR_STATUS_SUCCESS != retval)
     {
-        return VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE;
+        return retval;
     }
 
     //copy the element to the end of the array
     uint8_t* byteArray = (uint8_t*)array->array;
-    array->options->dynamic_array_element_copy(
-        array->options->context,
-        byteArray + array->elements * array->options->element_size,
-        element,
-        array->options->element_size);
+    if (array->options->trivially_copyable)
+    {
+        memcpy(
+            byteArray + array->elements * array->options->element_size,
+            element, array->options->element_size);
+    }
+    else
+    {
+        array->options->dynamic_array_element_copy(
+            array->options->context,
+            byteArray + array->elements * array->options->element_size,
+            element,
+            array->options->element_size);
+    }
     //increment the number of elements in the array
     ++array->elements;
 
@@ -11,6 +11,8 @@
 #include <vpr/dynamic_array.h>
 #include <vpr/parameters.h>
 
+#include "dynamic_array_internal.h"
+
 /**
  * \brief Perform a binary search for an element matching the given key in this
  * array.
@@ -53,47 +55,19 @@ void* dynamic_array_binary_search(dynamic_array_t* array, const void* elem)
     /* get the element size for this array. */
     size_t element_size = array->options->element_size;
 
-    /* if there are no elements, return no result. */
-    size_t elements = array->elements;
-    if (0 == elements)
-    {
-        return NULL;
-    }
-
-    /* work with a byte array to make offset calculation easier. */
-    uint8_t* byte_array = (uint8_t*)array->array;
+    /* find the first element which is not less than elem. */
+    size_t index =
+        dynamic_array_bound(
+            array->options, dynamic_array_typed_kind(array->options),
+            (const uint8_t*)array->array, array->elements, elem, false);
 
-    /* set the initial bounds. */
-    size_t lower_bound = 0;
-    size_t upper_bound = array->elements - 1;
-
-    /* loop over the bounds. */
-    while (lower_bound <= upper_bound)
+    /* this is a match if it exists and is equal to elem. */
+    uint8_t* index_elem = (uint8_t*)array->array + index * element_size;
+    if (
+        index < array->elements
+     && VPR_COMPARE_EQUAL == compare_method(index_elem, elem, element_size))
     {
-        /* compute the midpoint. */
-        size_t midpoint = (lower_bound + upper_bound) / 2;
-
-        /* calculate the offset of the midpoint element. */
-        uint8_t* midpoint_elem = byte_array + midpoint * element_size;
-
-        int compare_result =
-            compare_method(midpoint_elem, elem, element_size);
-
-        /* result found. */
-        if (VPR_COMPARE_EQUAL == compare_result)
-        {
-            return midpoint_elem;
-        }
-        /* midpoint_elem > elem. */
-        else if (VPR_COMPARE_GREATER == compare_result)
-        {
-            upper_bound = midpoint - 1;
-        }
-        /* midpoint_elem < elem. */
-        else
-        {
-            lower_bound = midpoint + 1;
-        }
+        return index_elem;
     }
 
     /* no results were found. */
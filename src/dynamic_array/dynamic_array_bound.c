@@ -0,0 +1,90 @@
+/**
+ * \file dynamic_array_bound.c
+ *
+ * Implementation of the bisection shared by the dynamic array bound queries.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Find the first element of a sorted range which is not less than, or
+ * with upper set, which is greater than, the given key.
+ *
+ * Each step of the bisection halves the range with a conditional move rather
+ * than a branch on the comparison, which avoids mispredicted branches.
+ * Elements compared by a built-in integer comparison method are compared
+ * inline.
+ *
+ * \param options           The dynamic array options.
+ * \param kind              The kind of the elements, as returned by
+ *                          dynamic_array_typed_kind().
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param elem              The key.
+ * \param upper             true to skip elements equal to the key.
+ *
+ * \returns the index of the first such element, or count if there is none.
+ */
+size_t dynamic_array_bound(
+    const dynamic_array_options_t* options, int kind, const uint8_t* base,
+    size_t count, const void* elem, bool upper)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != base || 0 == count);
+    MODEL_ASSERT(NULL != elem);
+
+    size_t size = options->element_size;
+    size_t lo = 0;
+
+    if (0 == count)
+    {
+        return 0;
+    }
+
+    /* the first such element is always within [lo, lo + count]. */
+    if (
+        DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED == kind
+     || DYNAMIC_ARRAY_TYPED_KIND_SIGNED == kind)
+    {
+        uint64_t key =
+            dynamic_array_integer_key((const uint8_t*)elem, size, kind);
+
+        while (count > 1)
+        {
+            size_t half = count / 2;
+            uint64_t probe =
+                dynamic_array_integer_key(
+                    base + (lo + half - 1) * size, size, kind);
+
+            lo += (upper ? probe <= key : probe < key) ? half : 0;
+            count -= half;
+        }
+
+        uint64_t last = dynamic_array_integer_key(base + lo * size, size, kind);
+        return lo + (upper ? last <= key : last < key);
+    }
+
+    /* the comparison result is below this for elements to be skipped. */
+    int skip_below = upper ? 1 : 0;
+
+    while (count > 1)
+    {
+        size_t half = count / 2;
+        int result =
+            options->dynamic_array_element_compare(
+                base + (lo + half - 1) * size, elem, size);
+
+        lo += result < skip_below ? half : 0;
+        count -= half;
+    }
+
+    return
+        lo
+      + (options->dynamic_array_element_compare(base + lo * size, elem, size)
+            < skip_below);
+}
@@ -0,0 +1,36 @@
+/**
+ * \file dynamic_array_count.c
+ *
+ * Implementation of dynamic_array_count.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Count the elements matching the given key in this array.
+ *
+ * As with dynamic_array_linear_search(), the array need not be sorted, and
+ * several elements are compared at once if the comparison method is
+ * compare_bytes() or a built-in integer comparison method matching the element
+ * size.
+ *
+ * \param array             The array to be searched.
+ * \param compare_method    Optional comparison method override.
+ * \param elem              The element to use for searching.
+ *
+ * \returns the number of matching elements.
+ */
+size_t dynamic_array_count(
+    const dynamic_array_t* array, compare_method_t compare_method,
+    const void* elem)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(NULL != elem);
+
+    return dynamic_array_find_all(array, compare_method, elem, NULL, 0);
+}
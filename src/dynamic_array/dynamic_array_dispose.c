@@ -0,0 +1,47 @@
+/**
+ * \file dynamic_array_dispose.c
+ *
+ * Implementation of the dispose method shared by the dynamic array init
+ * methods.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * Dispose of a dynamic array.
+ *
+ * \param parray        An opaque pointer to the dynamic array.
+ */
+void dynamic_array_dispose(void* parray)
+{
+    MODEL_ASSERT(parray != NULL);
+    dynamic_array_t* array = (dynamic_array_t*)parray;
+    MODEL_ASSERT(array->options != NULL);
+    MODEL_ASSERT(array->options->alloc_opts != NULL);
+    MODEL_ASSERT(array->options->dynamic_array_element_dispose != NULL);
+    MODEL_ASSERT(array->array != NULL);
+    MODEL_ASSERT(array->elements <= array->reserved_elements);
+
+    //dispose of each element in the array, unless there is nothing to do
+    uint8_t* barr = (uint8_t*)array->array;
+    if (!array->options->trivially_copyable)
+    {
+        for (size_t i = 0; i < array->elements; ++i)
+        {
+            array->options->dynamic_array_element_dispose(
+                array->options->context,
+                barr + i * array->options->element_size);
+        }
+    }
+
+    //release the memory, unless it is the caller's inline storage
+    if (array->array != array->inline_array)
+    {
+        release(array->options->alloc_opts, array->array);
+    }
+}
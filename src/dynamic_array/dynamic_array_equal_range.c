@@ -0,0 +1,50 @@
+/**
+ * \file dynamic_array_equal_range.c
+ *
+ * Implementation of dynamic_array_equal_range.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Find the range of elements in this sorted array which compare as
+ * equal to the given key.
+ *
+ * The array must be sorted by its comparison method.  On return, the matching
+ * elements are those with indices from *begin up to but not including *end.
+ * If no element matches, then *begin and *end are both the index at which the
+ * key would be inserted.  This search has a worst-case performance of
+ * O(log n); once the lower bound is found, the upper bound is only searched
+ * for among the remaining elements.
+ *
+ * \param array             The array to be searched.
+ * \param elem              The element to use for searching.
+ * \param begin             Set to the index of the first matching element.
+ * \param end               Set to the index past the last matching element.
+ */
+void dynamic_array_equal_range(
+    const dynamic_array_t* array, const void* elem, size_t* begin, size_t* end)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(NULL != elem);
+    MODEL_ASSERT(NULL != begin);
+    MODEL_ASSERT(NULL != end);
+
+    const dynamic_array_options_t* options = array->options;
+    int kind = dynamic_array_typed_kind(options);
+    const uint8_t* base = (const uint8_t*)array->array;
+    size_t size = options->element_size;
+
+    *begin =
+        dynamic_array_bound(options, kind, base, array->elements, elem, false);
+    *end =
+        *begin
+      + dynamic_array_bound(
+            options, kind, base + *begin * size, array->elements - *begin,
+            elem, true);
+}
@@ -0,0 +1,48 @@
+/**
+ * \file dynamic_array_erase_range.c
+ *
+ * Implementation of dynamic_array_erase_range.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Erase a range of elements from the dynamic array.
+ *
+ * The elements from first up to but not including last are disposed, and the
+ * elements after them move down to close the gap, keeping their order.
+ * Trivially copyable elements are moved with a single memmove(); otherwise
+ * each element that moves is copied with the copy method and then disposed.
+ * Erasing a prefix of the array this way expires the oldest entries of a
+ * sliding window without rebuilding the array.
+ *
+ * \param array             The array.
+ * \param first             The index of the first element to erase.
+ * \param last              The index past the last element to erase.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX if first is greater than
+ *             last, or last is past the end of the array.
+ */
+int dynamic_array_erase_range(
+    dynamic_array_t* array, size_t first, size_t last)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+
+    if (first > last || last > array->elements)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX;
+    }
+
+    dynamic_array_dispose_range(array, first, last - first);
+    dynamic_array_move_range(array, first, last, array->elements - last);
+    array->elements -= last - first;
+
+    return VPR_STATUS_SUCCESS;
+}
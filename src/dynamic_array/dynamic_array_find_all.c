@@ -0,0 +1,74 @@
+/**
+ * \file dynamic_array_find_all.c
+ *
+ * Implementation of dynamic_array_find_all.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Find the indices of every element matching the given key in this
+ * array.
+ *
+ * As with dynamic_array_linear_search(), the array need not be sorted, and
+ * several elements are compared at once if the comparison method is
+ * compare_bytes() or a built-in integer comparison method matching the element
+ * size.  The indices of the first capacity matches are written in increasing
+ * order, and the total number of matches is returned, so a caller can size the
+ * indices array with a first call whose capacity is 0.
+ *
+ * \param array             The array to be searched.
+ * \param compare_method    Optional comparison method override.
+ * \param elem              The element to use for searching.
+ * \param indices           Set to the indices of the first matches; may be
+ *                          NULL if capacity is 0.
+ * \param capacity          The number of indices which may be written.
+ *
+ * \returns the number of matching elements.
+ */
+size_t dynamic_array_find_all(
+    const dynamic_array_t* array, compare_method_t compare_method,
+    const void* elem, size_t* indices, size_t capacity)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(NULL != elem);
+    MODEL_ASSERT(NULL != indices || 0 == capacity);
+
+    /* use the array's comparison method if none is given. */
+    if (NULL == compare_method)
+    {
+        compare_method = array->options->dynamic_array_element_compare;
+    }
+
+    const uint8_t* base = (const uint8_t*)array->array;
+    size_t size = array->options->element_size;
+
+    if (dynamic_array_bytewise_equality(compare_method, size))
+    {
+        return
+            dynamic_array_scan(
+                base, array->elements, size, (const uint8_t*)elem, SIZE_MAX,
+                indices, capacity);
+    }
+
+    size_t found = 0;
+    for (size_t i = 0; i < array->elements; ++i)
+    {
+        if (VPR_COMPARE_EQUAL == compare_method(base + i * size, elem, size))
+        {
+            if (found < capacity)
+            {
+                indices[found] = i;
+            }
+
+            ++found;
+        }
+    }
+
+    return found;
+}
@@ -0,0 +1,65 @@
+/**
+ * \file dynamic_array_gallop.c
+ *
+ * Implementation of the exponential search used by the sorted set operations.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Find the first element of a sorted range which is not less than, or
+ * with upper set, which is greater than, the given key, searching outward from
+ * the start of the range.
+ *
+ * The elements at offsets 0, 1, 3, 7, ... are probed until one is past the
+ * key, and then the last gap is bisected, so that finding an element k places
+ * in takes O(log k) comparisons however long the range is.
+ *
+ * \param options           The dynamic array options.
+ * \param kind              The kind of the elements, as returned by
+ *                          dynamic_array_typed_kind().
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param elem              The key.
+ * \param upper             true to skip elements equal to the key.
+ *
+ * \returns the index of the first such element, or count if there is none.
+ */
+size_t dynamic_array_gallop(
+    const dynamic_array_options_t* options, int kind, const uint8_t* base,
+    size_t count, const void* elem, bool upper)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != base || 0 == count);
+    MODEL_ASSERT(NULL != elem);
+
+    size_t size = options->element_size;
+    int skip_below = upper ? 1 : 0;
+    size_t lo = 0;
+    size_t probe = 0;
+    size_t step = 1;
+
+    /* every element before lo is skipped. */
+    while (
+        probe < count
+     && options->dynamic_array_element_compare(
+            base + probe * size, elem, size) < skip_below)
+    {
+        lo = probe + 1;
+        probe += step;
+        step *= 2;
+    }
+
+    /* the first such element is within [lo, min(probe, count)]. */
+    size_t hi = probe < count ? probe : count;
+
+    return
+        lo
+      + dynamic_array_bound(
+            options, kind, base + lo * size, hi - lo, elem, upper);
+}
@@ -11,8 +11,7 @@
 #include <vpr/dynamic_array.h>
 #include <vpr/parameters.h>
 
-//forward decls
-static void darr_dispose(void*);
+#include "dynamic_array_internal.h"
 
 /**
  * \brief Initialize a dynamic array.
@@ -58,11 +57,13 @@ int dynamic_array_init(
     MODEL_ASSERT(options->alloc_opts != NULL);
     MODEL_ASSERT(options->dynamic_array_element_copy != NULL);
 
-    array->hdr.dispose = &darr_dispose;
+    array->hdr.dispose = &dynamic_array_dispose;
     array->options = options;
     array->reserved_elements = reserve;
     array->elements = instance;
     array->array = allocate(options->alloc_opts, reserve * options->element_size);
+    array->inline_array = NULL;
+    array->inline_elements = 0;
 
     //if memory allocation failed, return an error.
     if (array->array == NULL)
@@ -72,40 +73,29 @@ int dynamic_array_init(
 
     //instantiate each value in the array with our copy data
     uint8_t* bytearr = (uint8_t*)array->array;
-    for (size_t i = 0; i < instance; ++i)
+    if (options->trivially_copyable && instance > 0)
     {
-        options->dynamic_array_element_copy(
-            options->context, bytearr + i * options->element_size, copy,
-            options->element_size);
+        //copy the first instance, then double the filled region each pass
+        size_t total = instance * options->element_size;
+        size_t filled = options->element_size;
+        memcpy(bytearr, copy, filled);
+        while (filled < total)
+        {
+            size_t chunk = filled < total - filled ? filled : total - filled;
+            memcpy(bytearr + filled, bytearr, chunk);
+            filled += chunk;
+        }
     }
-
-    //success
-    return VPR_STATUS_SUCCESS;
-}
-
-/**
- * Dispose of a dynamic array.
- *
- * \param parray        An opaque pointer to the dynamic array.
- */
-void darr_dispose(void* parray)
-{
-    MODEL_ASSERT(parray != NULL);
-    dynamic_array_t* array = (dynamic_array_t*)parray;
-    MODEL_ASSERT(array->options != NULL);
-    MODEL_ASSERT(array->options->alloc_opts != NULL);
-    MODEL_ASSERT(array->options->dynamic_array_element_dispose != NULL);
-    MODEL_ASSERT(array->array != NULL);
-    MODEL_ASSERT(array->elements <= array->reserved_elements);
-
-    //dispose of each element in the array
-    uint8_t* barr = (uint8_t*)array->array;
-    for (size_t i = 0; i < array->elements; ++i)
+    else
     {
-        array->options->dynamic_array_element_dispose(
-            array->options->context, barr + i * array->options->element_size);
+        for (size_t i = 0; i < instance; ++i)
+        {
+            options->dynamic_array_element_copy(
+                options->context, bytearr + i * options->element_size, copy,
+                options->element_size);
+        }
     }
 
-    //release the memory
-    release(array->options->alloc_opts, array->array);
+    //success
+    return VPR_STATUS_SUCCESS;
 }
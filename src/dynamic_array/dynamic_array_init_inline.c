@@ -0,0 +1,67 @@
+/**
+ * \file dynamic_array_init_inline.c
+ *
+ * Implementation of dynamic_array_init_inline.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Initialize an empty dynamic array which keeps its elements in
+ * caller-supplied inline storage until it outgrows it.
+ *
+ * No memory is allocated until an element is added to a full array, at which
+ * point the elements are moved to an allocated buffer as the array grows.
+ * dynamic_array_shrink_to_fit() moves them back if they fit again.  Adding
+ * elements beyond the inline storage requires a growth factor; see
+ * dynamic_array_options_set_growth_factor().
+ *
+ * The storage must be suitably aligned for the elements, and must outlive the
+ * array; see \ref DYNAMIC_ARRAY_WITH_INLINE_STORAGE.  Pointers to elements are
+ * invalidated when the elements move.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::dynamic_array_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.  Disposing the array does not release the storage.
+ *
+ * \param options           The dynamic array options to use for this instance.
+ * \param array             The array to initialize.
+ * \param storage           The inline storage.
+ * \param storage_size      The size of the inline storage in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INLINE_STORAGE_TOO_SMALL if the storage
+ *             cannot hold a single element.
+ */
+int dynamic_array_init_inline(
+    dynamic_array_options_t* options, dynamic_array_t* array, void* storage,
+    size_t storage_size)
+{
+    MODEL_ASSERT(array != NULL);
+    MODEL_ASSERT(storage != NULL);
+    MODEL_ASSERT(options != NULL);
+    MODEL_ASSERT(options->alloc_opts != NULL);
+    MODEL_ASSERT(options->element_size > 0);
+
+    size_t inline_elements = storage_size / options->element_size;
+    if (0 == inline_elements)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_INLINE_STORAGE_TOO_SMALL;
+    }
+
+    array->hdr.dispose = &dynamic_array_dispose;
+    array->options = options;
+    array->reserved_elements = inline_elements;
+    array->elements = 0;
+    array->array = storage;
+    array->inline_array = storage;
+    array->inline_elements = inline_elements;
+
+    return VPR_STATUS_SUCCESS;
+}
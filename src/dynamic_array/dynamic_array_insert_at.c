@@ -0,0 +1,64 @@
+/**
+ * \file dynamic_array_insert_at.c
+ *
+ * Implementation of dynamic_array_insert_at.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Insert an element into the dynamic array at the given index.
+ *
+ * The elements from the index onward move up by one to make room.  The array
+ * grows as it does for dynamic_array_append().  Trivially copyable elements
+ * are moved with a single memmove(); otherwise each element that moves is
+ * copied with the copy method and then disposed.  The new element is copied
+ * into place, and must not be an element of this array.
+ *
+ * \param array             The array.
+ * \param index             The index of the new element, from 0 up to and
+ *                          including the number of elements in the array.
+ * \param element           The element to insert into this array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX if the index is past the
+ *             end of the array.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE if there is no reserve
+ *             room left for this element, and automatic growth is disabled.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the array
+ *             could not be grown.
+ */
+int dynamic_array_insert_at(
+    dynamic_array_t* array, size_t index, const void* element)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(NULL != element);
+
+    if (index > array->elements)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX;
+    }
+
+    int retval = dynamic_array_reserve_one(array);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    dynamic_array_move_range(
+        array, index + 1, index, array->elements - index);
+    dynamic_array_copy_element(
+        array,
+        dynamic_array_elem(
+            (uint8_t*)array->array, index, array->options->element_size),
+        element);
+    ++array->elements;
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,776 @@
+/**
+ * \file dynamic_array_internal.h
+ *
+ * \brief Internal helpers shared by the dynamic array implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_DYNAMIC_ARRAY_INTERNAL_HEADER_GUARD
+#define VPR_DYNAMIC_ARRAY_INTERNAL_HEADER_GUARD
+
+#include <string.h>
+#include <vpr/dynamic_array.h>
+
+/**
+ * \brief Elements up to this size are moved through a buffer on the stack;
+ * larger elements are moved by swapping.
+ */
+#define DYNAMIC_ARRAY_SORT_TEMP_SIZE 64
+
+/**
+ * \brief Ranges up to this many elements are sorted by insertion sort.
+ */
+#define DYNAMIC_ARRAY_SORT_INSERTION_THRESHOLD 24
+
+/**
+ * \brief Kinds of value compared by the built-in comparison methods.
+ */
+#define DYNAMIC_ARRAY_TYPED_KIND_NONE 0
+#define DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED 1
+#define DYNAMIC_ARRAY_TYPED_KIND_SIGNED 2
+#define DYNAMIC_ARRAY_TYPED_KIND_FLOAT 3
+
+/**
+ * \brief Hint that memory at the given address will be read soon.
+ */
+#if defined(__GNUC__)
+# define DYNAMIC_ARRAY_PREFETCH(addr) __builtin_prefetch((addr), 0, 1)
+#else
+# define DYNAMIC_ARRAY_PREFETCH(addr) ((void)(addr))
+#endif
+
+/**
+ * \brief The magic number and format version of a mapped dynamic array file.
+ */
+#define DYNAMIC_ARRAY_MAPPED_MAGIC "VPRDARR"
+#define DYNAMIC_ARRAY_MAPPED_VERSION 1
+
+/**
+ * \brief The header of a mapped dynamic array file, in host byte order.
+ */
+typedef struct dynamic_array_mapped_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t element_size;
+    uint64_t elements;
+    uint8_t reserved[32];
+
+} dynamic_array_mapped_header_t;
+
+/**
+ * \brief Get the address of an element.
+ *
+ * \param base              The first element of the range.
+ * \param index             The index of the element.
+ * \param size              The size of each element.
+ *
+ * \returns the address of the element.
+ */
+static inline uint8_t* dynamic_array_elem(
+    uint8_t* base, size_t index, size_t size)
+{
+    return base + index * size;
+}
+
+/**
+ * \brief Swap two elements, byte by byte, without allocating.
+ *
+ * \param x                 The first element.
+ * \param y                 The second element.
+ * \param size              The size of each element.
+ */
+static inline void dynamic_array_swap(uint8_t* x, uint8_t* y, size_t size)
+{
+    uint8_t tmp[DYNAMIC_ARRAY_SORT_TEMP_SIZE];
+
+    while (size > 0)
+    {
+        size_t chunk = size < sizeof(tmp) ? size : sizeof(tmp);
+
+        memcpy(tmp, x, chunk);
+        memcpy(x, y, chunk);
+        memcpy(y, tmp, chunk);
+
+        x += chunk;
+        y += chunk;
+        size -= chunk;
+    }
+}
+
+/**
+ * \brief Copy an element into a vacant slot, with the copy method of the
+ * array unless its elements are trivially copyable.
+ *
+ * \param array             The array.
+ * \param dst               The vacant slot.
+ * \param src               The element to copy.
+ */
+static inline void dynamic_array_copy_element(
+    dynamic_array_t* array, uint8_t* dst, const void* src)
+{
+    if (array->options->trivially_copyable)
+    {
+        memcpy(dst, src, array->options->element_size);
+    }
+    else
+    {
+        array->options->dynamic_array_element_copy(
+            array->options->context, dst, src, array->options->element_size);
+    }
+}
+
+/**
+ * \brief Dispose a range of elements, leaving their slots vacant.
+ *
+ * \param array             The array.
+ * \param first             The index of the first element to dispose.
+ * \param count             The number of elements to dispose.
+ */
+static inline void dynamic_array_dispose_range(
+    dynamic_array_t* array, size_t first, size_t count)
+{
+    if (array->options->trivially_copyable)
+    {
+        return;
+    }
+
+    uint8_t* base = (uint8_t*)array->array;
+    size_t size = array->options->element_size;
+    for (size_t i = first; i < first + count; ++i)
+    {
+        array->options->dynamic_array_element_dispose(
+            array->options->context, base + i * size);
+    }
+}
+
+/**
+ * \brief Move elements to other slots, which may be in another buffer.
+ *
+ * Each destination slot must be vacant, or be part of the source range.
+ * Trivially copyable elements are moved with a single memmove(); otherwise,
+ * each element is copied with the copy method and then disposed, in an order
+ * that never overwrites an element before it has been moved.
+ *
+ * \param options           The dynamic array options.
+ * \param dst               The first destination slot.
+ * \param src               The first element to move.
+ * \param count             The number of elements to move.
+ */
+static inline void dynamic_array_move_elements(
+    const dynamic_array_options_t* options, uint8_t* dst, uint8_t* src,
+    size_t count)
+{
+    size_t size = options->element_size;
+
+    if (options->trivially_copyable)
+    {
+        memmove(dst, src, count * size);
+    }
+    else if (dst < src)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            options->dynamic_array_element_copy(
+                options->context, dst + i * size, src + i * size, size);
+            options->dynamic_array_element_dispose(
+                options->context, src + i * size);
+        }
+    }
+    else if (dst > src)
+    {
+        for (size_t i = count; i > 0; --i)
+        {
+            options->dynamic_array_element_copy(
+                options->context, dst + (i - 1) * size,
+                src + (i - 1) * size, size);
+            options->dynamic_array_element_dispose(
+                options->context, src + (i - 1) * size);
+        }
+    }
+}
+
+/**
+ * \brief Copy elements to vacant slots, which must not overlap them.
+ *
+ * The source elements are left in place, with the copy method of the array
+ * unless its elements are trivially copyable.
+ *
+ * \param options           The dynamic array options.
+ * \param dst               The first destination slot.
+ * \param src               The first element to copy.
+ * \param count             The number of elements to copy.
+ */
+static inline void dynamic_array_copy_elements(
+    const dynamic_array_options_t* options, uint8_t* dst, const uint8_t* src,
+    size_t count)
+{
+    size_t size = options->element_size;
+
+    if (options->trivially_copyable)
+    {
+        memcpy(dst, src, count * size);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        options->dynamic_array_element_copy(
+            options->context, dst + i * size, src + i * size, size);
+    }
+}
+
+/**
+ * \brief Move a range of elements to another position in the array.
+ *
+ * Each destination slot must be vacant, or be part of the source range.  The
+ * elements are moved as by dynamic_array_move_elements().
+ *
+ * \param array             The array.
+ * \param dst               The index of the first destination slot.
+ * \param src               The index of the first element to move.
+ * \param count             The number of elements to move.
+ */
+static inline void dynamic_array_move_range(
+    dynamic_array_t* array, size_t dst, size_t src, size_t count)
+{
+    uint8_t* base = (uint8_t*)array->array;
+    size_t size = array->options->element_size;
+
+    dynamic_array_move_elements(
+        array->options, base + dst * size, base + src * size, count);
+}
+
+/**
+ * \brief Swap two elements.
+ *
+ * Trivially copyable elements are swapped byte by byte; otherwise, the
+ * elements are moved through a temporary slot, as by
+ * dynamic_array_move_elements().
+ *
+ * \param options           The dynamic array options.
+ * \param x                 The first element.
+ * \param y                 The second element.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ */
+static inline void dynamic_array_swap_elements(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* temp)
+{
+    if (x == y)
+    {
+        return;
+    }
+
+    if (options->trivially_copyable)
+    {
+        dynamic_array_swap(x, y, options->element_size);
+        return;
+    }
+
+    dynamic_array_move_elements(options, temp, x, 1);
+    dynamic_array_move_elements(options, x, y, 1);
+    dynamic_array_move_elements(options, y, temp, 1);
+}
+
+/**
+ * \brief Copy a range of elements to the end of an array which has room for
+ * them.
+ *
+ * Trivially copyable elements are copied with a single memcpy(); otherwise,
+ * each element is copied with the copy method.
+ *
+ * \param array             The array.
+ * \param src               The first element to copy, which must not be in
+ *                          the array.
+ * \param count             The number of elements to copy.
+ */
+static inline void dynamic_array_append_range(
+    dynamic_array_t* array, const uint8_t* src, size_t count)
+{
+    size_t size = array->options->element_size;
+    uint8_t* dst =
+        dynamic_array_elem((uint8_t*)array->array, array->elements, size);
+
+    if (array->options->trivially_copyable)
+    {
+        memcpy(dst, src, count * size);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            dynamic_array_copy_element(array, dst + i * size, src + i * size);
+        }
+    }
+
+    array->elements += count;
+}
+
+/**
+ * \brief Make sure that the array has room for the given number of further
+ * elements, growing it to exactly that size if it does not.
+ *
+ * \param array             The array.
+ * \param count             The number of elements to make room for.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if growing the
+ *             array failed, in which case the array is unchanged.
+ */
+static inline int dynamic_array_reserve_more(
+    dynamic_array_t* array, size_t count)
+{
+    if (array->reserved_elements - array->elements >= count)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    return dynamic_array_grow(array, array->elements + count);
+}
+
+/**
+ * \brief Make sure that the array has room for one more element, growing it
+ * by its growth factor if it is full.
+ *
+ * \param array             The array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE if the array is full
+ *             and has no growth factor.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if growing the
+ *             array failed.
+ */
+int dynamic_array_reserve_one(dynamic_array_t* array);
+
+/**
+ * \brief Dispose of a dynamic array.
+ *
+ * \param parray            An opaque pointer to the dynamic array.
+ */
+void dynamic_array_dispose(void* parray);
+
+/**
+ * \brief Move the elements of an array to a buffer of the given reserve size.
+ *
+ * If the array has inline storage and the elements fit in it, they are moved
+ * there, and the reserve size becomes the size of the inline storage.
+ *
+ * \param array             The array to resize.
+ * \param reserve           The new reserve size, which must be at least the
+ *                          number of elements in the array.
+ *
+ * \returns true if the array was resized, or false if allocation failed, in
+ *          which case the array is unchanged.
+ */
+bool dynamic_array_resize(dynamic_array_t* array, size_t reserve);
+
+/**
+ * \brief Compare two elements with the comparison method of the options.
+ *
+ * \param options           The dynamic array options.
+ * \param x                 The left-hand element.
+ * \param y                 The right-hand element.
+ *
+ * \returns (> 0 if x > y) (< 0 if x < y) (== 0 if x == y)
+ */
+static inline int dynamic_array_compare(
+    const dynamic_array_options_t* options, const uint8_t* x,
+    const uint8_t* y)
+{
+    return
+        options->dynamic_array_element_compare(x, y, options->element_size);
+}
+
+/**
+ * \brief Insertion sort a range of elements.
+ *
+ * This sort is stable.  If limit is nonzero, then the sort gives up once more
+ * than limit elements have been moved.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param limit             The maximum number of moves, or 0 for no limit.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ *
+ * \returns true if the range was sorted, or false if the limit was exceeded.
+ */
+static inline bool dynamic_array_insertion_sort(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    size_t limit, uint8_t* temp)
+{
+    size_t size = options->element_size;
+    size_t moves = 0;
+    uint8_t tmp[DYNAMIC_ARRAY_SORT_TEMP_SIZE];
+
+    for (size_t i = 1; i < count; ++i)
+    {
+        uint8_t* cur = dynamic_array_elem(base, i, size);
+        if (dynamic_array_compare(options, cur, cur - size) >= 0)
+        {
+            continue;
+        }
+
+        if (0 != limit && moves > limit)
+        {
+            return false;
+        }
+
+        if (!options->trivially_copyable)
+        {
+            /* find the insertion point, then move the element aside while the
+             * run is shifted up by one. */
+            size_t j = i - 1;
+            while (
+                j > 0 && dynamic_array_compare(
+                            options, cur,
+                            dynamic_array_elem(base, j - 1, size)) < 0)
+            {
+                --j;
+            }
+
+            uint8_t* dst = dynamic_array_elem(base, j, size);
+            dynamic_array_move_elements(options, temp, cur, 1);
+            dynamic_array_move_elements(options, dst + size, dst, i - j);
+            dynamic_array_move_elements(options, dst, temp, 1);
+            moves += i - j;
+        }
+        else if (size <= sizeof(tmp))
+        {
+            /* find the insertion point, then shift the run up by one. */
+            size_t j = i - 1;
+            memcpy(tmp, cur, size);
+            while (
+                j > 0 && dynamic_array_compare(
+                            options, tmp,
+                            dynamic_array_elem(base, j - 1, size)) < 0)
+            {
+                --j;
+            }
+
+            memmove(
+                dynamic_array_elem(base, j + 1, size),
+                dynamic_array_elem(base, j, size), (i - j) * size);
+            memcpy(dynamic_array_elem(base, j, size), tmp, size);
+            moves += i - j;
+        }
+        else
+        {
+            /* large elements are swapped down one position at a time. */
+            for (
+                uint8_t* p = cur;
+                p > base && dynamic_array_compare(options, p, p - size) < 0;
+                p -= size)
+            {
+                dynamic_array_swap(p, p - size, size);
+                ++moves;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Sort a range of elements in place, without allocating.
+ *
+ * This is a pattern-defeating quicksort, which falls back to heapsort on
+ * adversarial input.  It is not stable.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ */
+void dynamic_array_sort_unstable(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp);
+
+/**
+ * \brief Stable sort a range of elements, using a scratch buffer.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param scratch           A scratch buffer large enough to hold count / 2
+ *                          elements.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ */
+void dynamic_array_sort_stable(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* scratch, uint8_t* temp);
+
+/**
+ * \brief Partially order a range of elements so that the element at the given
+ * index is the one which would be there if the range were sorted.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param index             The index of the element to put in place, which
+ *                          must be less than count.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ */
+void dynamic_array_select(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    size_t index, uint8_t* temp);
+
+/**
+ * \brief Load an integer element as an unsigned 64-bit key which sorts in the
+ * same order as the element.
+ *
+ * \param elem              The element.
+ * \param size              The size of the element; 1, 2, 4, or 8.
+ * \param kind              \ref DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED or
+ *                          \ref DYNAMIC_ARRAY_TYPED_KIND_SIGNED.
+ *
+ * \returns the key.
+ */
+static inline uint64_t dynamic_array_integer_key(
+    const uint8_t* elem, size_t size, int kind)
+{
+    uint64_t key;
+    uint8_t u8;
+    uint16_t u16;
+    uint32_t u32;
+
+    switch (size)
+    {
+        case 1:
+            memcpy(&u8, elem, 1);
+            key = u8;
+            break;
+
+        case 2:
+            memcpy(&u16, elem, 2);
+            key = u16;
+            break;
+
+        case 4:
+            memcpy(&u32, elem, 4);
+            key = u32;
+            break;
+
+        default:
+            memcpy(&key, elem, 8);
+            break;
+    }
+
+    if (DYNAMIC_ARRAY_TYPED_KIND_SIGNED == kind)
+    {
+        /* sign extend, then flip the sign bit. */
+        uint64_t sign = UINT64_C(1) << (8 * size - 1);
+        key = ((key ^ sign) - sign) ^ (UINT64_C(1) << 63);
+    }
+
+    return key;
+}
+
+/**
+ * \brief Get the kind of value compared by the comparison method of the
+ * options, if it is a built-in one whose type matches the element size.
+ *
+ * \param options           The dynamic array options.
+ *
+ * \returns one of the DYNAMIC_ARRAY_TYPED_KIND_* values.
+ */
+int dynamic_array_typed_kind(const dynamic_array_options_t* options);
+
+/**
+ * \brief Get the kind of value compared by a comparison method, if it is a
+ * built-in one whose type matches the given size.
+ *
+ * \param compare           The comparison method.
+ * \param size              The size of the values compared.
+ *
+ * \returns one of the DYNAMIC_ARRAY_TYPED_KIND_* values.
+ */
+int dynamic_array_method_kind(compare_method_t compare, size_t size);
+
+/**
+ * \brief Determine whether two values compare as equal under a comparison
+ * method exactly when their bytes are identical.
+ *
+ * \param compare           The comparison method.
+ * \param size              The size of the values compared.
+ *
+ * \returns true if equality under this method is bytewise equality.
+ */
+bool dynamic_array_bytewise_equality(compare_method_t compare, size_t size);
+
+/**
+ * \brief Find the elements of a range whose bytes are identical to a key.
+ *
+ * Where the platform supports it, several elements of 1, 2, 4, 8, or 16
+ * bytes are compared at once with vector instructions.
+ *
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param size              The size of each element.
+ * \param key               The key.
+ * \param limit             Stop after finding this many matches.
+ * \param indices           Set to the indices of the first matches.
+ * \param capacity          The number of indices which may be written.
+ *
+ * \returns the number of matches found, up to limit.
+ */
+size_t dynamic_array_scan(
+    const uint8_t* base, size_t count, size_t size, const uint8_t* key,
+    size_t limit, size_t* indices, size_t capacity);
+
+/**
+ * \brief Find the first element of a sorted range which is not less than, or
+ * with upper set, which is greater than, the given key.
+ *
+ * \param options           The dynamic array options.
+ * \param kind              The kind of the elements, as returned by
+ *                          dynamic_array_typed_kind().
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param elem              The key.
+ * \param upper             true to skip elements equal to the key.
+ *
+ * \returns the index of the first such element, or count if there is none.
+ */
+size_t dynamic_array_bound(
+    const dynamic_array_options_t* options, int kind, const uint8_t* base,
+    size_t count, const void* elem, bool upper);
+
+/**
+ * \brief Find the first element of a sorted range which is not less than, or
+ * with upper set, which is greater than, the given key, searching outward from
+ * the start of the range.
+ *
+ * The elements at offsets 0, 1, 3, 7, ... are probed until one is past the
+ * key, and then the last gap is bisected, so that finding an element k places
+ * in takes O(log k) comparisons however long the range is.
+ *
+ * \param options           The dynamic array options.
+ * \param kind              The kind of the elements, as returned by
+ *                          dynamic_array_typed_kind().
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param elem              The key.
+ * \param upper             true to skip elements equal to the key.
+ *
+ * \returns the index of the first such element, or count if there is none.
+ */
+size_t dynamic_array_gallop(
+    const dynamic_array_options_t* options, int kind, const uint8_t* base,
+    size_t count, const void* elem, bool upper);
+
+/**
+ * \brief Flags selecting which elements a set operation keeps.
+ */
+#define DYNAMIC_ARRAY_SET_LEFT_ONLY 0x01
+#define DYNAMIC_ARRAY_SET_RIGHT_ONLY 0x02
+#define DYNAMIC_ARRAY_SET_BOTH 0x04
+
+/**
+ * \brief Append the elements selected by the given flags from two sorted
+ * arrays to an output array.
+ *
+ * Runs of elements which are in only one array are found by galloping, and
+ * copied in bulk.
+ *
+ * \param output            The output array.
+ * \param left              The left-hand sorted array.
+ * \param right             The right-hand sorted array.
+ * \param flags             The elements to keep; a combination of the
+ *                          DYNAMIC_ARRAY_SET_* flags.
+ * \param reserve           The greatest number of elements appended, which
+ *                          the output array is grown to hold first.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown, in which case it is unchanged.
+ */
+int dynamic_array_set_operation(
+    dynamic_array_t* output, const dynamic_array_t* left,
+    const dynamic_array_t* right, int flags, size_t reserve);
+
+/**
+ * \brief Sort a range of elements with a typed kernel, if the comparison
+ * method of the options is a built-in one.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param mode              The sort mode.
+ *
+ * \returns true if the range was sorted, or false if there is no typed kernel
+ *          for these options and mode.
+ */
+bool dynamic_array_sort_typed(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    int mode);
+
+/**
+ * \brief Stable sort fixed-size records by a key at a fixed offset, one byte
+ * of the key per pass.
+ *
+ * \param records           The records to sort.
+ * \param scratch           A buffer large enough to hold count records.
+ * \param count             The number of records.
+ * \param record_size       The size of each record.
+ * \param key_offset        The offset of the key in each record.
+ * \param width             The width of the key.
+ * \param kind              The kind of key, one of the
+ *                          DYNAMIC_ARRAY_RADIX_KEY_* values.
+ * \param counts            A buffer of width * 256 counters.
+ *
+ * \returns either records or scratch, whichever holds the sorted records.
+ */
+uint8_t* dynamic_array_radix_sort_records(
+    uint8_t* records, uint8_t* scratch, size_t count, size_t record_size,
+    size_t key_offset, size_t width, int kind, size_t* counts);
+
+/**
+ * \brief Reorder the elements of an array to match sorted records which each
+ * hold the index of an element.
+ *
+ * This is how elements which are not trivially copyable are radix sorted:
+ * the records are sorted in their place, and each element is then moved to
+ * the scratch buffer in sorted order and back, with the copy and dispose
+ * methods.
+ *
+ * \param array             The array.
+ * \param records           The sorted records, one per element.
+ * \param record_size       The size of each record.
+ * \param index_offset      The offset of the element index in each record.
+ * \param scratch           A suitably aligned buffer large enough to hold
+ *                          every element of the array.
+ */
+static inline void dynamic_array_radix_sort_apply(
+    dynamic_array_t* array, const uint8_t* records, size_t record_size,
+    size_t index_offset, uint8_t* scratch)
+{
+    size_t size = array->options->element_size;
+    uint8_t* elements = (uint8_t*)array->array;
+
+    for (size_t i = 0; i < array->elements; ++i)
+    {
+        size_t index;
+        memcpy(
+            &index, records + i * record_size + index_offset, sizeof(index));
+        dynamic_array_copy_element(
+            array, scratch + i * size, elements + index * size);
+    }
+
+    dynamic_array_dispose_range(array, 0, array->elements);
+    dynamic_array_move_elements(
+        array->options, elements, scratch, array->elements);
+}
+
+#endif  //VPR_DYNAMIC_ARRAY_INTERNAL_HEADER_GUARD
@@ -11,6 +11,8 @@
 #include <vpr/dynamic_array.h>
 #include <vpr/parameters.h>
 
+#include "dynamic_array_internal.h"
+
 /**
  * \brief Perform a linear search for an element matching the given key in this
  * array.
@@ -22,7 +24,11 @@
  *
  * The search method uses the comparison method defined in the array options.
  * How the comparison occurs is up to the comparison method, so this search can
- * be used for key-value pairs.
+ * be used for key-value pairs.  If the comparison method is compare_bytes(),
+ * or a built-in integer comparison method matching the element size, then
+ * several elements are compared at once where the platform supports it.  This
+ * makes a linear search the fastest way to look up small tables of up to a few
+ * hundred elements.
  *
  * \param array             The array to be sorted.
  * \param compare_method    Optional comparison method override.
@@ -55,8 +61,24 @@ void* dynamic_array_linear_search(
         }
     }
 
-    //attempt to find a matching element
+    //if equality is bytewise, compare several elements at once
     uint8_t* byteArray = (uint8_t*)array->array;
+    size_t size = array->options->element_size;
+    if (dynamic_array_bytewise_equality(compare_method, size))
+    {
+        size_t index;
+        if (
+            0 == dynamic_array_scan(
+                    byteArray, array->elements, size, (const uint8_t*)elem, 1,
+                    &index, 1))
+        {
+            return NULL;
+        }
+
+        return byteArray + index * size;
+    }
+
+    //attempt to find a matching element
     for (size_t i = 0; i < array->elements; ++i)
     {
         uint8_t* lhs = byteArray + i * array->options->element_size;
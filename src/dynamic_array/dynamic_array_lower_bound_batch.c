@@ -0,0 +1,73 @@
+/**
+ * \file dynamic_array_lower_bound_batch.c
+ *
+ * Implementation of dynamic_array_lower_bound_batch.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Find the lower bound of each of several sorted keys in this sorted
+ * array.
+ *
+ * The keys are count elements of the array's element size, sorted by the
+ * array's comparison method.  On return, indices[i] is the index of the first
+ * element in the array which is not less than keys[i], as returned by
+ * dynamic_array_lower_bound().
+ *
+ * The keys are walked through the array in a single pass.  Each search starts
+ * from the previous result and gallops forward in doubling steps before
+ * bisecting, so a batch of k keys over n elements costs O(k log(n / k))
+ * comparisons, and keys which fall close together cost O(1) each.  The
+ * endpoints of many time windows over a sorted array of events can be found
+ * this way in one call.
+ *
+ * \param array             The array to be searched.
+ * \param keys              The sorted keys.
+ * \param count             The number of keys.
+ * \param indices           An array of count indices, set to the lower bound
+ *                          of each key.
+ */
+void dynamic_array_lower_bound_batch(
+    const dynamic_array_t* array, const void* keys, size_t count,
+    size_t* indices)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(NULL != keys || 0 == count);
+    MODEL_ASSERT(NULL != indices || 0 == count);
+
+    const dynamic_array_options_t* options = array->options;
+    int kind = dynamic_array_typed_kind(options);
+    const uint8_t* base = (const uint8_t*)array->array;
+    const uint8_t* key = (const uint8_t*)keys;
+    size_t size = options->element_size;
+    size_t n = array->elements;
+    size_t lo = 0;
+
+    for (size_t i = 0; i < count; ++i, key += size)
+    {
+        /* every element before lo is less than this key; gallop forward until
+         * an element is found which is not. */
+        size_t step = 1;
+        while (
+            lo + step <= n
+         && options->dynamic_array_element_compare(
+                base + (lo + step - 1) * size, key, size) < 0)
+        {
+            lo += step;
+            step *= 2;
+        }
+
+        /* the bound is now within [lo, lo + step - 1], capped at n. */
+        size_t span = lo + step - 1 < n ? step - 1 : n - lo;
+        lo +=
+            dynamic_array_bound(
+                options, kind, base + lo * size, span, key, false);
+        indices[i] = lo;
+    }
+}
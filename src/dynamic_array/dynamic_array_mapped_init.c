@@ -0,0 +1,400 @@
+/**
+ * \file dynamic_array_mapped_init.c
+ *
+ * Implementation of dynamic_array_mapped_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+/* memory mapping is only available on POSIX platforms; mremap() is only
+ * available on Linux. */
+#if defined(__unix__) || defined(__APPLE__)
+
+#if defined(__linux__)
+# define _GNU_SOURCE
+#else
+# define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cbmc/model_assert.h>
+#include <vpr/dynamic_array/dynamic_array_mapped.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+MODEL_STRUCT_TAG_GLOBAL_EXTERN(allocator);
+
+/* forward decls for internal methods */
+static void dynamic_array_mapped_dispose(void* pmapped);
+static void dynamic_array_mapped_allocator_dispose(void* poptions);
+static void* dynamic_array_mapped_allocate(void* context, size_t size);
+static void dynamic_array_mapped_release(void* context, void* mem);
+static void* dynamic_array_mapped_reallocate(
+    void* context, void* mem, size_t old_size, size_t new_size);
+static int dynamic_array_mapped_control(
+    void* context, uint32_t key, void* value);
+static uint8_t* dynamic_array_mapped_remap(
+    dynamic_array_mapped_t* mapped, size_t map_size);
+
+/**
+ * \brief Open or create a dynamic array stored in a memory-mapped file.
+ *
+ * If the file is empty, as when newly created, a new empty array is written to
+ * it; otherwise, the file must hold an array with elements of the size given
+ * by the options, whose elements become the elements of the array.  The file
+ * is extended to hold at least the given reserve size.
+ *
+ * The number of elements is written to the file by
+ * dynamic_array_mapped_sync() and when the array is disposed.  Elements added
+ * since the last of these are lost if the process exits first.
+ *
+ * This function is only available on POSIX platforms.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::dynamic_array_mapped_t instance and must dispose of it by calling
+ * dispose() when it is no longer needed, which trims the file to the size of
+ * its elements and unmaps it.
+ *
+ * \param mapped            The mapped dynamic array to initialize.
+ * \param options           The dynamic array options, which must be trivially
+ *                          copyable, and whose allocator is used for scratch
+ *                          buffers.
+ * \param path              The path of the file, which is created if it does
+ *                          not exist.
+ * \param reserve           The minimum reserve size for this array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_NOT_TRIVIALLY_COPYABLE if the
+ *             elements are not trivially copyable.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_INVALID_FORMAT if the file does
+ *             not hold an array of elements of the given size.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO if the file could not be
+ *             opened, extended, or mapped.
+ */
+int dynamic_array_mapped_init(
+    dynamic_array_mapped_t* mapped, dynamic_array_options_t* options,
+    const char* path, size_t reserve)
+{
+    int retval;
+    struct stat st;
+    dynamic_array_mapped_header_t header;
+
+    MODEL_ASSERT(NULL != mapped);
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != options->alloc_opts);
+    MODEL_ASSERT(options->element_size > 0);
+    MODEL_ASSERT(NULL != path);
+
+    /* the elements are moved and persisted by their bytes. */
+    if (!options->trivially_copyable)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_MAPPED_NOT_TRIVIALLY_COPYABLE;
+    }
+
+    size_t size = options->element_size;
+
+    /* the descriptor is not inherited by programs this process executes. */
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO;
+    }
+
+    if (0 != fstat(fd, &st))
+    {
+        retval = VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO;
+        goto close_fd;
+    }
+
+    /* an existing array must have elements of our size, and the file must
+     * hold every element it counts. */
+    size_t file_size = (size_t)st.st_size;
+    size_t elements = 0;
+    size_t capacity = 0;
+    if (file_size > 0)
+    {
+        if (
+            file_size < DYNAMIC_ARRAY_MAPPED_HEADER_SIZE
+         || (ssize_t)sizeof(header) != pread(fd, &header, sizeof(header), 0)
+         || 0 != memcmp(
+                    header.magic, DYNAMIC_ARRAY_MAPPED_MAGIC,
+                    sizeof(header.magic))
+         || DYNAMIC_ARRAY_MAPPED_VERSION != header.version
+         || DYNAMIC_ARRAY_MAPPED_HEADER_SIZE != header.header_size
+         || size != header.element_size)
+        {
+            retval = VPR_ERROR_DYNAMIC_ARRAY_MAPPED_INVALID_FORMAT;
+            goto close_fd;
+        }
+
+        capacity = (file_size - DYNAMIC_ARRAY_MAPPED_HEADER_SIZE) / size;
+        if (header.elements > capacity)
+        {
+            retval = VPR_ERROR_DYNAMIC_ARRAY_MAPPED_INVALID_FORMAT;
+            goto close_fd;
+        }
+
+        elements = (size_t)header.elements;
+    }
+
+    /* reserve at least one element, so that the mapping is never empty. */
+    if (capacity < reserve)
+    {
+        capacity = reserve;
+    }
+
+    if (0 == capacity)
+    {
+        capacity = 1;
+    }
+
+    size_t map_size = DYNAMIC_ARRAY_MAPPED_HEADER_SIZE + capacity * size;
+    if (map_size > file_size && 0 != ftruncate(fd, (off_t)map_size))
+    {
+        retval = VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO;
+        goto close_fd;
+    }
+
+    mapped->map =
+        (uint8_t*)mmap(
+            NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == (void*)mapped->map)
+    {
+        retval = VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO;
+        goto restore_file_size;
+    }
+
+    /* write the header of a new array. */
+    if (0 == file_size)
+    {
+        memset(&header, 0, sizeof(header));
+        memcpy(
+            header.magic, DYNAMIC_ARRAY_MAPPED_MAGIC,
+            sizeof(DYNAMIC_ARRAY_MAPPED_MAGIC));
+        header.version = DYNAMIC_ARRAY_MAPPED_VERSION;
+        header.header_size = DYNAMIC_ARRAY_MAPPED_HEADER_SIZE;
+        header.element_size = size;
+        memcpy(mapped->map, &header, sizeof(header));
+    }
+
+    /* the allocator resizes the file, and passes other allocations on to the
+     * caller's allocator. */
+    dispose_init(
+        &mapped->alloc_opts.hdr, &dynamic_array_mapped_allocator_dispose);
+    MODEL_STRUCT_TAG_INIT(
+        mapped->alloc_opts.MODEL_STRUCT_TAG_REF(allocator), allocator);
+    mapped->alloc_opts.allocator_allocate = &dynamic_array_mapped_allocate;
+    mapped->alloc_opts.allocator_release = &dynamic_array_mapped_release;
+    mapped->alloc_opts.allocator_reallocate =
+        &dynamic_array_mapped_reallocate;
+    mapped->alloc_opts.allocator_control = &dynamic_array_mapped_control;
+    mapped->alloc_opts.context = mapped;
+
+    mapped->options = *options;
+    mapped->options.alloc_opts = &mapped->alloc_opts;
+    mapped->scratch_alloc_opts = options->alloc_opts;
+
+    mapped->array.hdr.dispose = &dynamic_array_dispose;
+    mapped->array.options = &mapped->options;
+    mapped->array.reserved_elements = capacity;
+    mapped->array.elements = elements;
+    mapped->array.array = mapped->map + DYNAMIC_ARRAY_MAPPED_HEADER_SIZE;
+    mapped->array.inline_array = NULL;
+    mapped->array.inline_elements = 0;
+
+    mapped->hdr.dispose = &dynamic_array_mapped_dispose;
+    mapped->fd = fd;
+    mapped->map_size = map_size;
+
+    return VPR_STATUS_SUCCESS;
+
+restore_file_size:
+    /* undo any extension, so that a new file is left empty rather than
+     * holding zeros with no header. */
+    if (map_size > file_size)
+    {
+        (void)ftruncate(fd, (off_t)file_size);
+    }
+
+close_fd:
+    close(fd);
+
+    return retval;
+}
+
+/**
+ * Dispose of a mapped dynamic array.
+ *
+ * \param pmapped       An opaque pointer to the mapped dynamic array.
+ */
+static void dynamic_array_mapped_dispose(void* pmapped)
+{
+    MODEL_ASSERT(NULL != pmapped);
+
+    dynamic_array_mapped_t* mapped = (dynamic_array_mapped_t*)pmapped;
+
+    /* record the number of elements, then trim the unused reserve. */
+    dynamic_array_mapped_header_t* header =
+        (dynamic_array_mapped_header_t*)mapped->map;
+    header->elements = mapped->array.elements;
+
+    munmap(mapped->map, mapped->map_size);
+    (void)ftruncate(
+        mapped->fd,
+        (off_t)(
+            DYNAMIC_ARRAY_MAPPED_HEADER_SIZE
+          + mapped->array.elements * mapped->options.element_size));
+    close(mapped->fd);
+}
+
+/**
+ * Dispose of the allocator of a mapped dynamic array, which owns nothing.
+ *
+ * \param poptions      An opaque pointer to the allocator options.
+ */
+static void dynamic_array_mapped_allocator_dispose(void* UNUSED(poptions))
+{
+}
+
+/**
+ * \brief Allocate memory from the caller's allocator.
+ *
+ * \param context           The mapped dynamic array.
+ * \param size              The size to allocate.
+ *
+ * \returns the allocated memory, or NULL on failure.
+ */
+static void* dynamic_array_mapped_allocate(void* context, size_t size)
+{
+    dynamic_array_mapped_t* mapped = (dynamic_array_mapped_t*)context;
+
+    return allocate(mapped->scratch_alloc_opts, size);
+}
+
+/**
+ * \brief Release memory to the caller's allocator, unless it is the mapping,
+ * which is unmapped when the array is disposed.
+ *
+ * \param context           The mapped dynamic array.
+ * \param mem               The memory to release.
+ */
+static void dynamic_array_mapped_release(void* context, void* mem)
+{
+    dynamic_array_mapped_t* mapped = (dynamic_array_mapped_t*)context;
+
+    if (mem != mapped->map + DYNAMIC_ARRAY_MAPPED_HEADER_SIZE)
+    {
+        release(mapped->scratch_alloc_opts, mem);
+    }
+}
+
+/**
+ * \brief Resize the elements of the mapping by resizing the file, or
+ * reallocate memory from the caller's allocator.
+ *
+ * \param context           The mapped dynamic array.
+ * \param mem               The memory to reallocate.
+ * \param old_size          The previous size of the memory.
+ * \param new_size          The new size of the memory.
+ *
+ * \returns the resized memory, or NULL on failure, in which case the memory
+ *          is unchanged.
+ */
+static void* dynamic_array_mapped_reallocate(
+    void* context, void* mem, size_t old_size, size_t new_size)
+{
+    dynamic_array_mapped_t* mapped = (dynamic_array_mapped_t*)context;
+
+    if (mem != mapped->map + DYNAMIC_ARRAY_MAPPED_HEADER_SIZE)
+    {
+        return reallocate(mapped->scratch_alloc_opts, mem, old_size, new_size);
+    }
+
+    size_t map_size = DYNAMIC_ARRAY_MAPPED_HEADER_SIZE + new_size;
+
+    /* extend the file before mapping more of it. */
+    if (
+        map_size > mapped->map_size
+     && 0 != ftruncate(mapped->fd, (off_t)map_size))
+    {
+        return NULL;
+    }
+
+    uint8_t* map = dynamic_array_mapped_remap(mapped, map_size);
+    if (NULL == map)
+    {
+        return NULL;
+    }
+
+    /* shrink the file after mapping less of it. */
+    if (map_size < mapped->map_size)
+    {
+        (void)ftruncate(mapped->fd, (off_t)map_size);
+    }
+
+    mapped->map = map;
+    mapped->map_size = map_size;
+
+    return map + DYNAMIC_ARRAY_MAPPED_HEADER_SIZE;
+}
+
+/**
+ * \brief Make an allocator control call, which this allocator does not
+ * support.
+ *
+ * \param context           The mapped dynamic array.
+ * \param key               The control key being called.
+ * \param value             The optional value parameter for this call.
+ *
+ * \returns \ref VPR_ERROR_ALLOCATOR_CONTROL_INVALID_KEY.
+ */
+static int dynamic_array_mapped_control(
+    void* UNUSED(context), uint32_t UNUSED(key), void* UNUSED(value))
+{
+    return VPR_ERROR_ALLOCATOR_CONTROL_INVALID_KEY;
+}
+
+/**
+ * \brief Map the file of a mapped dynamic array at a new size.
+ *
+ * The file already has the new size.  On Linux, mremap() extends the mapping
+ * in place when it can, and otherwise moves it without copying.  Elsewhere, a
+ * new mapping is made before the old one is unmapped, so that a failure leaves
+ * the old mapping intact; since both map the file, nothing is copied.
+ *
+ * \param mapped            The mapped dynamic array.
+ * \param map_size          The new size of the mapping.
+ *
+ * \returns the new mapping, or NULL on failure, in which case the old mapping
+ *          is unchanged.
+ */
+static uint8_t* dynamic_array_mapped_remap(
+    dynamic_array_mapped_t* mapped, size_t map_size)
+{
+#if defined(__linux__)
+    void* map =
+        mremap(mapped->map, mapped->map_size, map_size, MREMAP_MAYMOVE);
+    if (MAP_FAILED == map)
+    {
+        return NULL;
+    }
+#else
+    void* map =
+        mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, mapped->fd, 0);
+    if (MAP_FAILED == map)
+    {
+        return NULL;
+    }
+
+    munmap(mapped->map, mapped->map_size);
+#endif
+
+    return (uint8_t*)map;
+}
+
+#endif /*defined(__unix__) || defined(__APPLE__)*/
@@ -0,0 +1,57 @@
+/**
+ * \file dynamic_array_mapped_sync.c
+ *
+ * Implementation of dynamic_array_mapped_sync.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+/* memory mapping is only available on POSIX platforms. */
+#if defined(__unix__) || defined(__APPLE__)
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <sys/mman.h>
+#include <cbmc/model_assert.h>
+#include <vpr/dynamic_array/dynamic_array_mapped.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Write the elements and the number of elements of a mapped dynamic
+ * array to its file.
+ *
+ * The elements are flushed before the number of elements is recorded, so that
+ * the file never counts elements which have not been written.
+ *
+ * \param mapped            The mapped dynamic array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO if the mapping could not
+ *             be written to the file.
+ */
+int dynamic_array_mapped_sync(dynamic_array_mapped_t* mapped)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_DYNAMIC_ARRAY_MAPPED(mapped));
+
+    size_t used =
+        DYNAMIC_ARRAY_MAPPED_HEADER_SIZE
+      + mapped->array.elements * mapped->options.element_size;
+    if (0 != msync(mapped->map, used, MS_SYNC))
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO;
+    }
+
+    dynamic_array_mapped_header_t* header =
+        (dynamic_array_mapped_header_t*)mapped->map;
+    header->elements = mapped->array.elements;
+    if (0 != msync(mapped->map, sizeof(*header), MS_SYNC))
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_MAPPED_FILE_IO;
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
+
+#endif /*defined(__unix__) || defined(__APPLE__)*/
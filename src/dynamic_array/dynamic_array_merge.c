@@ -0,0 +1,229 @@
+/**
+ * \file dynamic_array_merge.c
+ *
+ * Implementation of dynamic_array_merge.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/* forward decls for internal methods */
+static bool head_less(
+    const dynamic_array_t* const* inputs, const size_t* cursors, size_t x,
+    size_t y);
+static void sift_down(
+    const dynamic_array_t* const* inputs, const size_t* cursors,
+    size_t* heap, size_t heap_size, size_t parent);
+
+/**
+ * \brief Append the elements of several sorted dynamic arrays to an output
+ * array, in sorted order.
+ *
+ * Each input array must be sorted by the comparison method of its options,
+ * which must be the same as those of the output array.  The merge is stable:
+ * elements which compare as equal keep their order within an input array, and
+ * come from earlier input arrays first.  The inputs are kept in a binary heap
+ * ordered by their next elements.  Once the least input is found, a galloping
+ * search finds the run of its elements which come before the next element of
+ * any other input, and that run is copied in bulk, so that inputs which
+ * overlap little are merged in far fewer than one comparison per element.
+ * Elements are copied into the output array with its copy method.
+ *
+ * A single buffer holding two indices per input array is allocated, and the
+ * output array is first grown to hold every element of the inputs, if it
+ * cannot already.
+ *
+ * \param output            The array to which the result is appended, which
+ *                          must not be any of the input arrays.
+ * \param inputs            The sorted input arrays.
+ * \param count             The number of input arrays.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_MERGE_ALLOCATION_FAILED if memory could
+ *             not be allocated for the heap of inputs.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown.
+ *      On failure, the output array is unchanged.
+ */
+int dynamic_array_merge(
+    dynamic_array_t* output, const dynamic_array_t* const* inputs,
+    size_t count)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(output));
+    MODEL_ASSERT(NULL != inputs || 0 == count);
+
+    const dynamic_array_options_t* options = output->options;
+    int kind = dynamic_array_typed_kind(options);
+    size_t size = options->element_size;
+    size_t total = 0;
+    size_t heap_size = 0;
+    int retval;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        MODEL_ASSERT(prop_dynamic_array_valid(inputs[i]));
+        MODEL_ASSERT(inputs[i] != output);
+        MODEL_ASSERT(inputs[i]->options->element_size == size);
+
+        total += inputs[i]->elements;
+    }
+
+    if (0 == count)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /* the cursor of each input, followed by the heap of inputs. */
+    size_t* cursors =
+        (size_t*)allocate(options->alloc_opts, 2 * count * sizeof(size_t));
+    if (NULL == cursors)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_MERGE_ALLOCATION_FAILED;
+    }
+
+    size_t* heap = cursors + count;
+
+    retval = dynamic_array_reserve_more(output, total);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        goto release_cursors;
+    }
+
+    /* heapify the non-empty inputs. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        cursors[i] = 0;
+        if (inputs[i]->elements > 0)
+        {
+            heap[heap_size++] = i;
+        }
+    }
+
+    for (size_t i = heap_size / 2; i > 0; --i)
+    {
+        sift_down(inputs, cursors, heap, heap_size, i - 1);
+    }
+
+    while (heap_size > 1)
+    {
+        size_t least = heap[0];
+        const dynamic_array_t* input = inputs[least];
+        const uint8_t* run =
+            (const uint8_t*)input->array + cursors[least] * size;
+
+        /* the next least input is one of the children of the root. */
+        size_t next = heap[1];
+        if (heap_size > 2 && head_less(inputs, cursors, heap[2], next))
+        {
+            next = heap[2];
+        }
+
+        /* copy the run of elements which come before that of the next input;
+         * elements equal to it come first only from an earlier input. */
+        const uint8_t* bound =
+            (const uint8_t*)inputs[next]->array + cursors[next] * size;
+        size_t length =
+            1 + dynamic_array_gallop(
+                    options, kind, run + size,
+                    input->elements - cursors[least] - 1, bound,
+                    least < next);
+        dynamic_array_append_range(output, run, length);
+        cursors[least] += length;
+
+        /* drop an exhausted input, and restore the heap. */
+        if (cursors[least] == input->elements)
+        {
+            heap[0] = heap[--heap_size];
+        }
+
+        sift_down(inputs, cursors, heap, heap_size, 0);
+    }
+
+    /* the last input is copied in one run. */
+    if (1 == heap_size)
+    {
+        const dynamic_array_t* input = inputs[heap[0]];
+        dynamic_array_append_range(
+            output, (const uint8_t*)input->array + cursors[heap[0]] * size,
+            input->elements - cursors[heap[0]]);
+    }
+
+    retval = VPR_STATUS_SUCCESS;
+
+release_cursors:
+    release(options->alloc_opts, cursors);
+
+    return retval;
+}
+
+/**
+ * \brief Check whether the next element of one input comes before that of
+ * another, breaking ties by the order of the inputs.
+ *
+ * \param inputs            The input arrays.
+ * \param cursors           The cursor of each input.
+ * \param x                 The index of the first input.
+ * \param y                 The index of the second input.
+ *
+ * \returns true if the next element of x comes first.
+ */
+static bool head_less(
+    const dynamic_array_t* const* inputs, const size_t* cursors, size_t x,
+    size_t y)
+{
+    const dynamic_array_options_t* options = inputs[x]->options;
+    size_t size = options->element_size;
+    int result =
+        options->dynamic_array_element_compare(
+            (const uint8_t*)inputs[x]->array + cursors[x] * size,
+            (const uint8_t*)inputs[y]->array + cursors[y] * size, size);
+
+    return result < 0 || (0 == result && x < y);
+}
+
+/**
+ * \brief Sift an input in a heap of inputs down to its place.
+ *
+ * \param inputs            The input arrays.
+ * \param cursors           The cursor of each input.
+ * \param heap              The heap of input indices.
+ * \param heap_size         The number of inputs in the heap.
+ * \param parent            The position in the heap of the input to sift.
+ */
+static void sift_down(
+    const dynamic_array_t* const* inputs, const size_t* cursors,
+    size_t* heap, size_t heap_size, size_t parent)
+{
+    size_t value = heap[parent];
+
+    for (;;)
+    {
+        size_t child = 2 * parent + 1;
+        if (child >= heap_size)
+        {
+            break;
+        }
+
+        if (
+            child + 1 < heap_size
+         && head_less(inputs, cursors, heap[child + 1], heap[child]))
+        {
+            ++child;
+        }
+
+        if (!head_less(inputs, cursors, heap[child], value))
+        {
+            break;
+        }
+
+        heap[parent] = heap[child];
+        parent = child;
+    }
+
+    heap[parent] = value;
+}
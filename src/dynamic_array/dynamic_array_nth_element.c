@@ -0,0 +1,69 @@
+/**
+ * \file dynamic_array_nth_element.c
+ *
+ * Implementation of dynamic_array_nth_element.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Partially order a dynamic array so that the element at the given
+ * index is the one which would be there if the array were sorted.
+ *
+ * No element before the given index is greater than that element, and no
+ * element after it is less than it; the elements on each side are otherwise
+ * in no particular order.  This is an introselect, which runs in O(n) time on
+ * average, and falls back to sorting the remaining range if its partitions
+ * are unbalanced too often, so that the worst case is O(n log n).
+ *
+ * Elements are moved as with dynamic_array_sort_ex(), so memory is only
+ * allocated for a temporary element when the elements are not trivially
+ * copyable.  If the index is past the end of the array, then the array is
+ * unchanged.
+ *
+ * \param array             The array.
+ * \param index             The index of the element to put in place.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the temporary element failed.
+ */
+int dynamic_array_nth_element(dynamic_array_t* array, size_t index)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(array->options->dynamic_array_element_compare != NULL);
+
+    const dynamic_array_options_t* options = array->options;
+
+    if (index >= array->elements)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /* elements which are not trivially copyable move through a vacant one. */
+    uint8_t* temp = NULL;
+    if (!options->trivially_copyable)
+    {
+        temp = (uint8_t*)allocate(options->alloc_opts, options->element_size);
+        if (NULL == temp)
+        {
+            return VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED;
+        }
+    }
+
+    dynamic_array_select(
+        options, (uint8_t*)array->array, array->elements, index, temp);
+
+    if (NULL != temp)
+    {
+        release(options->alloc_opts, temp);
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
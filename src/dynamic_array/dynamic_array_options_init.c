@@ -24,6 +24,9 @@ static void darr_simple_elem_dispose(void*, void*);
  * memcmp() will be used.  Please see vpr/compare.h for a set of pre-defined
  * comparison methods for most builtin C types. 0
  *
+ * The options are marked as trivially copyable, so that arrays are copied and
+ * grown in bulk rather than one element at a time.
+ *
  * When the function completes successfully, the caller owns this
  * ::dynamic_array_t instance and must dispose of it by calling dispose() when
  * it is no longer needed.
@@ -51,9 +54,15 @@ int dynamic_array_options_init(
         compare_method = &memcmp;
 
     //initialize this structure in terms of dynamic_array_options_init_ex
-    return dynamic_array_options_init_ex(
-        options, alloc_opts, element_size, options, &darr_simple_elem_copy,
-        &darr_simple_elem_dispose, compare_method);
+    int retval =
+        dynamic_array_options_init_ex(
+            options, alloc_opts, element_size, options, &darr_simple_elem_copy,
+            &darr_simple_elem_dispose, compare_method);
+
+    //our copy method is memcpy, and our dispose method does nothing
+    options->trivially_copyable = true;
+
+    return retval;
 }
 
 /**
@@ -66,6 +66,10 @@ int dynamic_array_options_init_ex(
     options->dynamic_array_element_compare = compare_method;
     //set the context
     options->context = context;
+    //appending to a full array fails unless a growth factor is set
+    options->growth_factor = 0.0f;
+    //user-supplied copy and dispose methods must be called for each element
+    options->trivially_copyable = false;
 
     return VPR_STATUS_SUCCESS;
 }
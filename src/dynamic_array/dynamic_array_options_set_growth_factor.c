@@ -0,0 +1,45 @@
+/**
+ * \file dynamic_array_options_set_growth_factor.c
+ *
+ * Implementation of dynamic_array_options_set_growth_factor.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/dynamic_array.h>
+
+/**
+ * \brief Enable or disable automatic growth of arrays created with these
+ * options.
+ *
+ * By default, dynamic_array_append() fails when an array is full.  Once a
+ * growth factor is set, dynamic_array_append() instead grows a full array to
+ * growth_factor times its reserved size, so that a run of appends takes
+ * amortised constant time per element.  A factor of 2 minimises the number of
+ * copies; a factor of 1.5 wastes less reserve space.
+ *
+ * \param options           The dynamic array options to update.
+ * \param growth_factor     The growth factor, which must be greater than 1, or
+ *                          0 to disable automatic growth.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_INVALID_ARGUMENT if the growth
+ *             factor is neither 0 nor greater than 1.
+ */
+int dynamic_array_options_set_growth_factor(
+    dynamic_array_options_t* options, float growth_factor)
+{
+    MODEL_ASSERT(options != NULL);
+
+    //a factor of 1 or less would never grow the array
+    if (0.0f != growth_factor && !(growth_factor > 1.0f))
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_GROW_INVALID_ARGUMENT;
+    }
+
+    options->growth_factor = growth_factor;
+
+    return VPR_STATUS_SUCCESS;
+}
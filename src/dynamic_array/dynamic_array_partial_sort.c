@@ -0,0 +1,82 @@
+/**
+ * \file dynamic_array_partial_sort.c
+ *
+ * Implementation of dynamic_array_partial_sort.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Sort the least elements of a dynamic array into its first positions.
+ *
+ * When this completes, the first count elements of the array are the least
+ * count elements, in sorted order, and the remaining elements follow in no
+ * particular order.  The least elements are first selected with
+ * dynamic_array_nth_element(), and then only they are sorted, so this runs in
+ * O(n + k log k) time on average, instead of the O(n log n) time of sorting
+ * the whole array.  The greatest elements are found with a comparison method
+ * which reverses the order.  This sort is not stable.
+ *
+ * Elements are moved as with dynamic_array_sort_ex(), so memory is only
+ * allocated for a temporary element when the elements are not trivially
+ * copyable.  If the count is not less than the number of elements, then the
+ * whole array is sorted.
+ *
+ * \param array             The array.
+ * \param count             The number of elements to sort into place.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the temporary element failed.
+ */
+int dynamic_array_partial_sort(dynamic_array_t* array, size_t count)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(array->options->dynamic_array_element_compare != NULL);
+
+    const dynamic_array_options_t* options = array->options;
+    uint8_t* base = (uint8_t*)array->array;
+
+    if (count > array->elements)
+    {
+        count = array->elements;
+    }
+
+    /* elements which are not trivially copyable move through a vacant one. */
+    uint8_t* temp = NULL;
+    if (!options->trivially_copyable)
+    {
+        temp = (uint8_t*)allocate(options->alloc_opts, options->element_size);
+        if (NULL == temp)
+        {
+            return VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED;
+        }
+    }
+
+    /* move the least count elements to the front. */
+    if (count < array->elements)
+    {
+        dynamic_array_select(options, base, array->elements, count, temp);
+    }
+
+    /* built-in comparison methods have faster, typed kernels. */
+    if (
+        !dynamic_array_sort_typed(
+            options, base, count, DYNAMIC_ARRAY_SORT_UNSTABLE))
+    {
+        dynamic_array_sort_unstable(options, base, count, temp);
+    }
+
+    if (NULL != temp)
+    {
+        release(options->alloc_opts, temp);
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
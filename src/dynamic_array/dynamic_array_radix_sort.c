@@ -0,0 +1,133 @@
+/**
+ * \file dynamic_array_radix_sort.c
+ *
+ * Implementation of dynamic_array_radix_sort.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Stable sort the given dynamic array by a key within each element,
+ * using a radix sort.
+ *
+ * The key is width bytes at the given offset in each element.  Integer and
+ * floating point keys are in host byte order; byte string keys are ordered as
+ * by memcmp().  Floating point keys are ordered by value, except that -0.0
+ * sorts before 0.0, and NaNs sort before or after every other value according
+ * to their sign.
+ *
+ * The sort takes O(n * width) time, does not call the comparison method, and
+ * skips key bytes which every element shares.  It is stable, so that an array
+ * can be sorted by several keys in turn, from the least significant key to the
+ * most significant key.  It makes a single allocation of a scratch buffer the
+ * size of the array.  Elements which are not trivially copyable are sorted as
+ * records of their key and index, which the scratch buffer also holds, and
+ * are then moved through the scratch buffer into place with the copy and
+ * dispose methods.
+ *
+ * \param array             The array to be sorted.
+ * \param offset            The offset of the key in each element.
+ * \param width             The width of the key in bytes.
+ * \param kind              The kind of key; either
+ *                          \ref DYNAMIC_ARRAY_RADIX_KEY_UNSIGNED or
+ *                          \ref DYNAMIC_ARRAY_RADIX_KEY_SIGNED with a width of
+ *                          1, 2, 4, or 8, \ref DYNAMIC_ARRAY_RADIX_KEY_FLOAT
+ *                          with a width of 4 or 8, or
+ *                          \ref DYNAMIC_ARRAY_RADIX_KEY_BYTES with any width.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY if the key does
+ *             not fit in an element, or its width does not suit its kind.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer failed.
+ */
+int dynamic_array_radix_sort(
+    dynamic_array_t* array, size_t offset, size_t width, int kind)
+{
+    MODEL_ASSERT(array != NULL);
+    MODEL_ASSERT(array->options != NULL);
+    MODEL_ASSERT(array->options->alloc_opts != NULL);
+
+    size_t size = array->options->element_size;
+    bool native = 1 == width || 2 == width || 4 == width || 8 == width;
+
+    /* verify that the key fits in an element, and suits its kind. */
+    if (
+        0 == width || width > size || offset > size - width
+     || ((DYNAMIC_ARRAY_RADIX_KEY_UNSIGNED == kind
+            || DYNAMIC_ARRAY_RADIX_KEY_SIGNED == kind) && !native)
+     || (DYNAMIC_ARRAY_RADIX_KEY_FLOAT == kind && 4 != width && 8 != width)
+     || kind < DYNAMIC_ARRAY_RADIX_KEY_UNSIGNED
+     || kind > DYNAMIC_ARRAY_RADIX_KEY_BYTES)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY;
+    }
+
+    if (array->elements < 2)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /* elements which are not trivially copyable are sorted as records of
+     * their key and index, and then copied into place. */
+    bool by_index = !array->options->trivially_copyable;
+    size_t record_size = width + sizeof(size_t);
+    size_t elements_size = array->elements * size;
+    size_t records_size = by_index ? array->elements * record_size : 0;
+
+    /* the counters come first, to keep them and the elements aligned. */
+    size_t counts_size = width * 256 * sizeof(size_t);
+    size_t* counts =
+        (size_t*)allocate(
+            array->options->alloc_opts,
+            counts_size + elements_size + 2 * records_size);
+    if (NULL == counts)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED;
+    }
+
+    uint8_t* scratch = (uint8_t*)counts + counts_size;
+    uint8_t* elements = (uint8_t*)array->array;
+
+    if (by_index)
+    {
+        uint8_t* records = scratch + elements_size;
+        for (size_t i = 0; i < array->elements; ++i)
+        {
+            uint8_t* record = records + i * record_size;
+            memcpy(record, elements + i * size + offset, width);
+            memcpy(record + width, &i, sizeof(i));
+        }
+
+        uint8_t* sorted =
+            dynamic_array_radix_sort_records(
+                records, records + records_size, array->elements,
+                record_size, 0, width, kind, counts);
+        dynamic_array_radix_sort_apply(
+            array, sorted, record_size, width, scratch);
+    }
+    else
+    {
+        uint8_t* sorted =
+            dynamic_array_radix_sort_records(
+                elements, scratch, array->elements, size, offset, width,
+                kind, counts);
+
+        /* an odd number of passes leaves the elements in the scratch
+         * buffer. */
+        if (sorted != elements)
+        {
+            memcpy(elements, sorted, elements_size);
+        }
+    }
+
+    release(array->options->alloc_opts, counts);
+
+    return VPR_STATUS_SUCCESS;
+}
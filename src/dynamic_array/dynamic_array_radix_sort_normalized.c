@@ -0,0 +1,117 @@
+/**
+ * \file dynamic_array_radix_sort_normalized.c
+ *
+ * Implementation of dynamic_array_radix_sort_normalized.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Stable sort the given dynamic array by keys computed from each
+ * element, using a radix sort.
+ *
+ * The normalize method writes a key of width bytes for an element, such that
+ * the keys of two elements compare with memcmp() in the order that the
+ * elements should be sorted.  It is called once per element.
+ *
+ * The sort takes O(n * width) time, and is stable.  It makes a single
+ * allocation of a scratch buffer large enough to hold two copies of the array
+ * with a key beside each element.  Elements which are not trivially copyable
+ * are instead sorted as records of their key and index, and are then moved
+ * through the scratch buffer into place with the copy and dispose methods.
+ *
+ * \param array             The array to be sorted.
+ * \param width             The width of each normalized key in bytes.
+ * \param normalize         The method which computes the key of an element.
+ * \param context           The context passed to the normalize method.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY if the width is 0.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer failed.
+ */
+int dynamic_array_radix_sort_normalized(
+    dynamic_array_t* array, size_t width,
+    dynamic_array_radix_normalize_t normalize, void* context)
+{
+    MODEL_ASSERT(array != NULL);
+    MODEL_ASSERT(array->options != NULL);
+    MODEL_ASSERT(array->options->alloc_opts != NULL);
+    MODEL_ASSERT(normalize != NULL);
+
+    if (0 == width)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY;
+    }
+
+    if (array->elements < 2)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /* each record is a key followed by its element, or by the index of its
+     * element if elements are not trivially copyable, in which case they are
+     * copied into place afterwards. */
+    bool by_index = !array->options->trivially_copyable;
+    size_t size = array->options->element_size;
+    size_t record_size = width + (by_index ? sizeof(size_t) : size);
+    size_t elements_size = by_index ? array->elements * size : 0;
+    size_t records_size = array->elements * record_size;
+
+    /* the counters come first, to keep them and the elements aligned. */
+    size_t counts_size = width * 256 * sizeof(size_t);
+    size_t* counts =
+        (size_t*)allocate(
+            array->options->alloc_opts,
+            counts_size + elements_size + 2 * records_size);
+    if (NULL == counts)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED;
+    }
+
+    uint8_t* scratch = (uint8_t*)counts + counts_size;
+    uint8_t* records = scratch + elements_size;
+    uint8_t* elements = (uint8_t*)array->array;
+    for (size_t i = 0; i < array->elements; ++i)
+    {
+        uint8_t* record = records + i * record_size;
+        normalize(context, elements + i * size, record);
+        if (by_index)
+        {
+            memcpy(record + width, &i, sizeof(i));
+        }
+        else
+        {
+            memcpy(record + width, elements + i * size, size);
+        }
+    }
+
+    uint8_t* sorted =
+        dynamic_array_radix_sort_records(
+            records, records + records_size, array->elements, record_size, 0,
+            width, DYNAMIC_ARRAY_RADIX_KEY_BYTES, counts);
+
+    if (by_index)
+    {
+        dynamic_array_radix_sort_apply(
+            array, sorted, record_size, width, scratch);
+    }
+    else
+    {
+        for (size_t i = 0; i < array->elements; ++i)
+        {
+            memcpy(
+                elements + i * size, sorted + i * record_size + width, size);
+        }
+    }
+
+    release(array->options->alloc_opts, counts);
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/**
+ * \file dynamic_array_radix_sort_records.c
+ *
+ * Implementation of the least-significant-digit radix sort shared by
+ * dynamic_array_radix_sort and dynamic_array_radix_sort_normalized.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/* forward decls for internal methods */
+static inline uint8_t key_digit(
+    const uint8_t* key, size_t width, int kind, size_t pos, size_t sign_pos,
+    size_t significance);
+
+/**
+ * \brief Stable sort fixed-size records by a key at a fixed offset, one byte
+ * of the key per pass.
+ *
+ * \param records           The records to sort.
+ * \param scratch           A buffer large enough to hold count records.
+ * \param count             The number of records.
+ * \param record_size       The size of each record.
+ * \param key_offset        The offset of the key in each record.
+ * \param width             The width of the key.
+ * \param kind              The kind of key, one of the
+ *                          DYNAMIC_ARRAY_RADIX_KEY_* values.
+ * \param counts            A buffer of width * 256 counters.
+ *
+ * \returns either records or scratch, whichever holds the sorted records.
+ */
+uint8_t* dynamic_array_radix_sort_records(
+    uint8_t* records, uint8_t* scratch, size_t count, size_t record_size,
+    size_t key_offset, size_t width, int kind, size_t* counts)
+{
+    MODEL_ASSERT(NULL != records);
+    MODEL_ASSERT(NULL != scratch);
+    MODEL_ASSERT(NULL != counts);
+    MODEL_ASSERT(width > 0);
+
+    /* native integers are stored least significant byte first on little
+     * endian hosts; byte strings are always most significant byte first. */
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    memcpy(&first_byte, &one, 1);
+    bool least_first =
+        DYNAMIC_ARRAY_RADIX_KEY_BYTES != kind && 1 == first_byte;
+    size_t sign_pos = least_first ? width - 1 : 0;
+
+    /* count the digits of every pass at once. */
+    memset(counts, 0, width * 256 * sizeof(size_t));
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t* key = records + i * record_size + key_offset;
+        for (size_t d = 0; d < width; ++d)
+        {
+            size_t pos = least_first ? d : width - 1 - d;
+            ++counts[d * 256 + key_digit(key, width, kind, pos, sign_pos, d)];
+        }
+    }
+
+    uint8_t* src = records;
+    uint8_t* dst = scratch;
+    for (size_t d = 0; d < width; ++d)
+    {
+        size_t* offsets = counts + d * 256;
+        size_t pos = least_first ? d : width - 1 - d;
+
+        /* skip digits which every record shares. */
+        const uint8_t* first_key = src + key_offset;
+        if (
+            offsets[key_digit(first_key, width, kind, pos, sign_pos, d)]
+                == count)
+        {
+            continue;
+        }
+
+        size_t sum = 0;
+        for (size_t b = 0; b < 256; ++b)
+        {
+            size_t bucket = offsets[b];
+            offsets[b] = sum;
+            sum += bucket;
+        }
+
+        /* scatter the records in order, which keeps the sort stable. */
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint8_t* record = src + i * record_size;
+            uint8_t digit =
+                key_digit(record + key_offset, width, kind, pos, sign_pos, d);
+            memcpy(dst + offsets[digit]++ * record_size, record, record_size);
+        }
+
+        uint8_t* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    return src;
+}
+
+/**
+ * \brief Get one digit of a key, mapped so that digits sort in key order.
+ *
+ * \param key               The key.
+ * \param width             The width of the key.
+ * \param kind              The kind of key.
+ * \param pos               The position of this digit in the key.
+ * \param sign_pos          The position of the most significant byte.
+ * \param significance      The significance of this digit, with 0 being the
+ *                          least significant.
+ *
+ * \returns the mapped digit.
+ */
+static inline uint8_t key_digit(
+    const uint8_t* key, size_t width, int kind, size_t pos, size_t sign_pos,
+    size_t significance)
+{
+    bool top = significance == width - 1;
+
+    switch (kind)
+    {
+        case DYNAMIC_ARRAY_RADIX_KEY_SIGNED:
+            return (uint8_t)(key[pos] ^ (top ? 0x80 : 0));
+
+        case DYNAMIC_ARRAY_RADIX_KEY_FLOAT:
+            /* negative values reverse their order; positive values sort
+             * after them. */
+            if (key[sign_pos] & 0x80)
+            {
+                return (uint8_t)~key[pos];
+            }
+
+            return (uint8_t)(key[pos] ^ (top ? 0x80 : 0));
+
+        default:
+            return key[pos];
+    }
+}
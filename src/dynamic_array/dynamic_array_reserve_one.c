@@ -0,0 +1,61 @@
+/**
+ * \file dynamic_array_reserve_one.c
+ *
+ * Implementation of the growth policy shared by dynamic_array_append and
+ * dynamic_array_insert_at.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdint.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Make sure that the array has room for one more element, growing it
+ * by its growth factor if it is full.
+ *
+ * \param array             The array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE if the array is full
+ *             and has no growth factor.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if growing the
+ *             array failed.
+ */
+int dynamic_array_reserve_one(dynamic_array_t* array)
+{
+    MODEL_ASSERT(array != NULL);
+    MODEL_ASSERT(array->options != NULL);
+
+    if (array->elements < array->reserved_elements)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    if (0.0f == array->options->growth_factor)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_APPEND_NO_RESERVE;
+    }
+
+    /* grow geometrically, but never past the largest array that can be
+     * allocated. */
+    double target =
+        (double)array->reserved_elements * array->options->growth_factor;
+    if (target >= (double)SIZE_MAX / array->options->element_size)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED;
+    }
+
+    /* always grow by at least one element. */
+    size_t reserve = (size_t)target;
+    if (reserve <= array->reserved_elements)
+    {
+        reserve = array->reserved_elements + 1;
+    }
+
+    return dynamic_array_grow(array, reserve);
+}
@@ -0,0 +1,118 @@
+/**
+ * \file dynamic_array_resize.c
+ *
+ * Implementation of the buffer resize shared by dynamic_array_grow and
+ * dynamic_array_shrink_to_fit.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Move the elements of an array to a buffer of the given reserve size.
+ *
+ * If the array has inline storage and the elements fit in it, they are moved
+ * there, and the reserve size becomes the size of the inline storage.
+ *
+ * \param array             The array to resize.
+ * \param reserve           The new reserve size, which must be at least the
+ *                          number of elements in the array.
+ *
+ * \returns true if the array was resized, or false if allocation failed, in
+ *          which case the array is unchanged.
+ */
+bool dynamic_array_resize(dynamic_array_t* array, size_t reserve)
+{
+    MODEL_ASSERT(array != NULL);
+    MODEL_ASSERT(array->array != NULL);
+    MODEL_ASSERT(reserve >= array->elements);
+    MODEL_ASSERT(reserve > 0);
+
+    size_t size = array->options->element_size;
+    bool is_inline = array->array == array->inline_array;
+    bool to_inline =
+        NULL != array->inline_array && reserve <= array->inline_elements;
+
+    /* the inline storage is never resized; an array already using it is as
+     * small as it can be. */
+    if (is_inline && to_inline)
+    {
+        return true;
+    }
+
+    /* trivially copyable elements in an allocated buffer can be moved by the
+     * allocator, which may be able to resize the buffer in place. */
+    if (array->options->trivially_copyable && !is_inline && !to_inline)
+    {
+        void* resized =
+            reallocate(
+                array->options->alloc_opts, array->array,
+                array->reserved_elements * size, reserve * size);
+        if (NULL == resized)
+        {
+            return false;
+        }
+
+        array->reserved_elements = reserve;
+        array->array = resized;
+
+        return true;
+    }
+
+    uint8_t* old_buffer = (uint8_t*)array->array;
+    uint8_t* new_buffer;
+    if (to_inline)
+    {
+        new_buffer = (uint8_t*)array->inline_array;
+        reserve = array->inline_elements;
+    }
+    else
+    {
+        new_buffer =
+            (uint8_t*)allocate(array->options->alloc_opts, reserve * size);
+        if (NULL == new_buffer)
+        {
+            return false;
+        }
+    }
+
+    /* trivially copyable elements need no disposal.  Otherwise, copy each
+     * element to the new buffer with the user-supplied copy method, then
+     * dispose the old elements.  The allocator's reallocate() method would
+     * move the elements as POD, which would break any internal references
+     * that the copy method maintains. */
+    if (array->options->trivially_copyable)
+    {
+        memcpy(new_buffer, old_buffer, array->elements * size);
+    }
+    else
+    {
+        for (size_t i = 0; i < array->elements; ++i)
+        {
+            array->options->dynamic_array_element_copy(
+                array->options->context, new_buffer + i * size,
+                old_buffer + i * size, size);
+        }
+
+        for (size_t i = 0; i < array->elements; ++i)
+        {
+            array->options->dynamic_array_element_dispose(
+                array->options->context, old_buffer + i * size);
+        }
+    }
+
+    array->reserved_elements = reserve;
+    array->array = new_buffer;
+
+    /* the inline storage belongs to the caller. */
+    if (!is_inline)
+    {
+        release(array->options->alloc_opts, old_buffer);
+    }
+
+    return true;
+}
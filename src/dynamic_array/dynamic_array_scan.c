@@ -0,0 +1,325 @@
+/**
+ * \file dynamic_array_scan.c
+ *
+ * Implementation of the bytewise scan shared by the dynamic array linear
+ * searches.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/*
+ * Each vector kernel compares SCAN_CHUNK bytes at a time against a pattern of
+ * the key repeated, and packs the result into a 64-bit mask holding
+ * SCAN_BITS_PER_BYTE equal bits for each byte.  AVX2 is used only when the
+ * library is built for it; SSE2 is part of every x86-64 target.  Targets
+ * without a vector kernel, such as Cortex-M, scan one element at a time.
+ */
+#if defined(__AVX2__)
+# include <immintrin.h>
+# define SCAN_CHUNK 64
+# define SCAN_BITS_PER_BYTE 1
+typedef __m256i scan_vector_t;
+#elif defined(__SSE2__)
+# include <emmintrin.h>
+# define SCAN_CHUNK 64
+# define SCAN_BITS_PER_BYTE 1
+typedef __m128i scan_vector_t;
+#elif defined(__ARM_NEON)
+# include <arm_neon.h>
+# define SCAN_CHUNK 16
+# define SCAN_BITS_PER_BYTE 4
+typedef uint8x16_t scan_vector_t;
+#endif
+
+/**
+ * \brief The size of the repeated key pattern, which is a multiple of every
+ * element size handled by the vector kernels.
+ */
+#define SCAN_PATTERN_SIZE 32
+
+/* forward decls for internal methods */
+static inline bool scan_equal(
+    const uint8_t* x, const uint8_t* y, size_t size);
+static inline size_t scan_ctz(uint64_t mask);
+#if defined(SCAN_CHUNK)
+static inline scan_vector_t scan_load_pattern(const uint8_t* pattern);
+static inline uint64_t scan_chunk(
+    const uint8_t* chunk, scan_vector_t pattern);
+#endif
+
+/**
+ * \brief Find the elements of a range whose bytes are identical to a key.
+ *
+ * Where the platform supports it, several elements of 1, 2, 4, 8, or 16
+ * bytes are compared at once with vector instructions.
+ *
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param size              The size of each element.
+ * \param key               The key.
+ * \param limit             Stop after finding this many matches.
+ * \param indices           Set to the indices of the first matches.
+ * \param capacity          The number of indices which may be written.
+ *
+ * \returns the number of matches found, up to limit.
+ */
+size_t dynamic_array_scan(
+    const uint8_t* base, size_t count, size_t size, const uint8_t* key,
+    size_t limit, size_t* indices, size_t capacity)
+{
+    MODEL_ASSERT(NULL != base || 0 == count);
+    MODEL_ASSERT(NULL != key);
+    MODEL_ASSERT(NULL != indices || 0 == capacity);
+
+    size_t found = 0;
+    size_t i = 0;
+
+#if defined(SCAN_CHUNK)
+    if (
+        limit > 0
+     && (1 == size || 2 == size || 4 == size || 8 == size || 16 == size))
+    {
+        uint8_t pattern[SCAN_PATTERN_SIZE];
+        for (size_t offset = 0; offset < sizeof(pattern); offset += size)
+        {
+            memcpy(pattern + offset, key, size);
+        }
+
+        scan_vector_t vector = scan_load_pattern(pattern);
+
+        /* an element matches if all of its bits in the mask are set; fold
+         * each element's bits down onto its lowest bit, then keep only that
+         * bit. */
+        size_t element_bits = size * SCAN_BITS_PER_BYTE;
+        uint64_t lowest_bits = 0;
+        for (size_t bit = 0; bit < 64; bit += element_bits)
+        {
+            lowest_bits |= UINT64_C(1) << bit;
+        }
+
+        size_t per_chunk = SCAN_CHUNK / size;
+        for (; i + per_chunk <= count; i += per_chunk)
+        {
+            uint64_t mask = scan_chunk(base + i * size, vector);
+            for (
+                size_t shift = SCAN_BITS_PER_BYTE; shift < element_bits;
+                shift *= 2)
+            {
+                mask &= mask >> shift;
+            }
+
+            mask &= lowest_bits;
+            while (0 != mask)
+            {
+                if (found < capacity)
+                {
+                    indices[found] = i + scan_ctz(mask) / element_bits;
+                }
+
+                if (++found == limit)
+                {
+                    return found;
+                }
+
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+
+    /* compare the remaining elements one at a time. */
+    for (; i < count && found < limit; ++i)
+    {
+        if (scan_equal(base + i * size, key, size))
+        {
+            if (found < capacity)
+            {
+                indices[found] = i;
+            }
+
+            ++found;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * \brief Compare two elements for bytewise equality.
+ *
+ * \param x                 The left-hand element.
+ * \param y                 The right-hand element.
+ * \param size              The size of each element.
+ *
+ * \returns true if the bytes of the elements are identical.
+ */
+static inline bool scan_equal(
+    const uint8_t* x, const uint8_t* y, size_t size)
+{
+    uint16_t x16, y16;
+    uint32_t x32, y32;
+    uint64_t x64, y64;
+
+    switch (size)
+    {
+        case 1:
+            return *x == *y;
+
+        case 2:
+            memcpy(&x16, x, 2);
+            memcpy(&y16, y, 2);
+            return x16 == y16;
+
+        case 4:
+            memcpy(&x32, x, 4);
+            memcpy(&y32, y, 4);
+            return x32 == y32;
+
+        case 8:
+            memcpy(&x64, x, 8);
+            memcpy(&y64, y, 8);
+            return x64 == y64;
+
+        default:
+            return 0 == memcmp(x, y, size);
+    }
+}
+
+/**
+ * \brief Count the trailing zero bits of a nonzero mask.
+ *
+ * \param mask              The mask.
+ *
+ * \returns the index of the lowest set bit.
+ */
+static inline size_t scan_ctz(uint64_t mask)
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_ctzll(mask);
+#else
+    size_t bit = 0;
+    while (0 == (mask & 1))
+    {
+        mask >>= 1;
+        ++bit;
+    }
+
+    return bit;
+#endif
+}
+
+#if defined(__AVX2__)
+
+/**
+ * \brief Load the repeated key pattern into a vector.
+ *
+ * \param pattern           The pattern.
+ *
+ * \returns the pattern vector.
+ */
+static inline scan_vector_t scan_load_pattern(const uint8_t* pattern)
+{
+    return _mm256_loadu_si256((const __m256i*)pattern);
+}
+
+/**
+ * \brief Compare a chunk of elements against the pattern, byte by byte.
+ *
+ * \param chunk             The chunk of elements.
+ * \param pattern           The pattern vector.
+ *
+ * \returns a mask with one bit set for each matching byte.
+ */
+static inline uint64_t scan_chunk(const uint8_t* chunk, scan_vector_t pattern)
+{
+    uint64_t lo =
+        (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(
+                _mm256_loadu_si256((const __m256i*)chunk), pattern));
+    uint64_t hi =
+        (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(
+                _mm256_loadu_si256((const __m256i*)(chunk + 32)), pattern));
+
+    return lo | (hi << 32);
+}
+
+#elif defined(__SSE2__)
+
+/**
+ * \brief Load the repeated key pattern into a vector.
+ *
+ * \param pattern           The pattern.
+ *
+ * \returns the pattern vector.
+ */
+static inline scan_vector_t scan_load_pattern(const uint8_t* pattern)
+{
+    return _mm_loadu_si128((const __m128i*)pattern);
+}
+
+/**
+ * \brief Compare a chunk of elements against the pattern, byte by byte.
+ *
+ * \param chunk             The chunk of elements.
+ * \param pattern           The pattern vector.
+ *
+ * \returns a mask with one bit set for each matching byte.
+ */
+static inline uint64_t scan_chunk(const uint8_t* chunk, scan_vector_t pattern)
+{
+    uint64_t mask = 0;
+
+    for (size_t part = 0; part < 4; ++part)
+    {
+        uint64_t bits =
+            (uint16_t)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)(chunk + 16 * part)),
+                    pattern));
+
+        mask |= bits << (16 * part);
+    }
+
+    return mask;
+}
+
+#elif defined(__ARM_NEON)
+
+/**
+ * \brief Load the repeated key pattern into a vector.
+ *
+ * \param pattern           The pattern.
+ *
+ * \returns the pattern vector.
+ */
+static inline scan_vector_t scan_load_pattern(const uint8_t* pattern)
+{
+    return vld1q_u8(pattern);
+}
+
+/**
+ * \brief Compare a chunk of elements against the pattern, byte by byte.
+ *
+ * NEON has no byte mask instruction, so each byte's comparison result is
+ * narrowed to four bits instead.
+ *
+ * \param chunk             The chunk of elements.
+ * \param pattern           The pattern vector.
+ *
+ * \returns a mask with four bits set for each matching byte.
+ */
+static inline uint64_t scan_chunk(const uint8_t* chunk, scan_vector_t pattern)
+{
+    uint8x16_t equal = vceqq_u8(vld1q_u8(chunk), pattern);
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * \file dynamic_array_search_index_find.c
+ *
+ * Implementation of dynamic_array_search_index_find.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Each search prefetches the slots this many levels ahead.
+ */
+#define PREFETCH_LEVELS 4
+
+/* forward decls for internal methods */
+static size_t eytzinger_result(size_t slot);
+
+/**
+ * \brief Search an index for an element matching the given key.
+ *
+ * The search finds the first element in the array which compares as equal to
+ * the key, so it returns the same pointer as dynamic_array_binary_search().
+ *
+ * \param index             The search index.
+ * \param elem              The element to use for searching.
+ *
+ * \returns a pointer value.
+ *      - the first element in the array matching the provided element given
+ *        the compare method on success.
+ *      - NULL if no matching element found.
+ */
+void* dynamic_array_search_index_find(
+    const dynamic_array_search_index_t* index, const void* elem)
+{
+    MODEL_ASSERT(NULL != index);
+    MODEL_ASSERT(NULL != elem);
+
+    const dynamic_array_options_t* options = index->array->options;
+    size_t size = options->element_size;
+    size_t n = index->elements;
+    size_t slot = 1;
+
+    /* descend to the first slot past the end, moving right whenever the slot
+     * is less than the key.  The descendants of a slot PREFETCH_LEVELS levels
+     * down are adjacent, so they are fetched ahead of time. */
+    if (NULL != index->keys)
+    {
+        uint64_t key =
+            dynamic_array_integer_key(
+                (const uint8_t*)elem, size, index->key_kind);
+
+        while (slot <= n)
+        {
+            if ((slot << PREFETCH_LEVELS) <= n)
+            {
+                DYNAMIC_ARRAY_PREFETCH(
+                    index->keys + (slot << PREFETCH_LEVELS));
+            }
+
+            slot = 2 * slot + (index->keys[slot] < key);
+        }
+
+        slot = eytzinger_result(slot);
+        if (0 == slot || index->keys[slot] != key)
+        {
+            return NULL;
+        }
+    }
+    else
+    {
+        const uint8_t* layout = (const uint8_t*)index->layout;
+
+        while (slot <= n)
+        {
+            if ((slot << PREFETCH_LEVELS) <= n)
+            {
+                DYNAMIC_ARRAY_PREFETCH(
+                    layout + (slot << PREFETCH_LEVELS) * size);
+            }
+
+            slot =
+                2 * slot
+              + (dynamic_array_compare(options, layout + slot * size, elem)
+                    < 0);
+        }
+
+        slot = eytzinger_result(slot);
+        if (
+            0 == slot
+         || 0 != dynamic_array_compare(options, layout + slot * size, elem))
+        {
+            return NULL;
+        }
+    }
+
+    return
+        dynamic_array_elem(
+            (uint8_t*)index->array->array, index->positions[slot], size);
+}
+
+/**
+ * \brief Find the slot of the first element no less than the key, given the
+ * slot past the end at which the search stopped.
+ *
+ * The search last moved left at this slot's deepest ancestor reached by a
+ * left move; undoing the trailing right moves, and then that left move, gives
+ * that ancestor.
+ *
+ * \param slot              The slot at which the search stopped.
+ *
+ * \returns the slot of the first element no less than the key, or 0 if every
+ *          element is less than the key.
+ */
+static size_t eytzinger_result(size_t slot)
+{
+    while (slot & 1)
+    {
+        slot >>= 1;
+    }
+
+    return slot >> 1;
+}
@@ -0,0 +1,161 @@
+/**
+ * \file dynamic_array_search_index_init.c
+ *
+ * Implementation of dynamic_array_search_index_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/* forward decls for internal methods */
+static void dynamic_array_search_index_dispose(void* disposable);
+static void build(
+    dynamic_array_search_index_t* index, size_t slot, size_t* position);
+
+/**
+ * \brief Build a search index over a sorted dynamic array.
+ *
+ * The array must be sorted by its comparison method, and must not change while
+ * the index is in use.  The index is allocated with the array's allocator, and
+ * is owned by the caller, who must dispose of it by calling dispose().
+ *
+ * \param index             The search index to initialize.
+ * \param array             The sorted array to index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SEARCH_INDEX_ALLOCATION_FAILED if memory
+ *             could not be allocated for the index.
+ */
+int dynamic_array_search_index_init(
+    dynamic_array_search_index_t* index, dynamic_array_t* array)
+{
+    MODEL_ASSERT(NULL != index);
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(NULL != array->options->dynamic_array_element_compare);
+
+    index->hdr.dispose = &dynamic_array_search_index_dispose;
+    index->array = array;
+    index->elements = array->elements;
+    index->layout = NULL;
+    index->keys = NULL;
+    index->positions = NULL;
+
+    /* integer elements are indexed by their keys alone. */
+    index->key_kind = dynamic_array_typed_kind(array->options);
+    if (DYNAMIC_ARRAY_TYPED_KIND_FLOAT == index->key_kind)
+    {
+        index->key_kind = DYNAMIC_ARRAY_TYPED_KIND_NONE;
+    }
+
+    if (0 == index->elements)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /* slot 0 is unused, so that the children of slot k are 2k and 2k + 1.
+     * The keys come first, to keep them aligned. */
+    size_t slots = index->elements + 1;
+    size_t keys_size =
+        DYNAMIC_ARRAY_TYPED_KIND_NONE == index->key_kind
+            ? 0
+            : slots * sizeof(uint64_t);
+    size_t positions_size = slots * sizeof(size_t);
+    size_t layout_size =
+        DYNAMIC_ARRAY_TYPED_KIND_NONE == index->key_kind
+            ? slots * array->options->element_size
+            : 0;
+
+    uint8_t* block =
+        (uint8_t*)allocate(
+            array->options->alloc_opts,
+            keys_size + positions_size + layout_size);
+    if (NULL == block)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_SEARCH_INDEX_ALLOCATION_FAILED;
+    }
+
+    if (0 != keys_size)
+    {
+        index->keys = (uint64_t*)block;
+    }
+
+    index->positions = (size_t*)(block + keys_size);
+
+    if (0 != layout_size)
+    {
+        index->layout = block + keys_size + positions_size;
+    }
+
+    /* fill the slots with an in-order walk of the implicit tree. */
+    size_t position = 0;
+    build(index, 1, &position);
+    MODEL_ASSERT(position == index->elements);
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Fill the subtree rooted at the given slot with the next elements of
+ * the array, in order.
+ *
+ * \param index             The search index.
+ * \param slot              The root of the subtree.
+ * \param position          The position of the next element of the array,
+ *                          which is advanced past the elements placed.
+ */
+static void build(
+    dynamic_array_search_index_t* index, size_t slot, size_t* position)
+{
+    if (slot > index->elements)
+    {
+        return;
+    }
+
+    build(index, 2 * slot, position);
+
+    size_t size = index->array->options->element_size;
+    const uint8_t* elem =
+        dynamic_array_elem((uint8_t*)index->array->array, *position, size);
+
+    if (NULL != index->keys)
+    {
+        index->keys[slot] =
+            dynamic_array_integer_key(elem, size, index->key_kind);
+    }
+    else
+    {
+        memcpy(
+            dynamic_array_elem((uint8_t*)index->layout, slot, size), elem,
+            size);
+    }
+
+    index->positions[slot] = (*position)++;
+
+    build(index, 2 * slot + 1, position);
+}
+
+/**
+ * \brief Dispose of a search index.
+ *
+ * \param disposable        The search index to dispose.
+ */
+static void dynamic_array_search_index_dispose(void* disposable)
+{
+    dynamic_array_search_index_t* index =
+        (dynamic_array_search_index_t*)disposable;
+
+    /* the keys, positions, and layout share one allocation. */
+    void* block =
+        NULL != index->keys ? (void*)index->keys : (void*)index->positions;
+    if (NULL != block)
+    {
+        release(index->array->options->alloc_opts, block);
+    }
+
+    memset(index, 0, sizeof(dynamic_array_search_index_t));
+}
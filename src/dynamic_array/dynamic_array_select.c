@@ -0,0 +1,188 @@
+/**
+ * \file dynamic_array_select.c
+ *
+ * Implementation of the introselect used by dynamic_array_nth_element.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Ranges larger than this use the pseudomedian of nine as a pivot.
+ */
+#define NINTHER_THRESHOLD 128
+
+/* forward decls for internal methods */
+static void sort2(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* temp);
+static void sort3(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* z, uint8_t* temp);
+static size_t partition(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp);
+
+/**
+ * \brief Partially order a range of elements so that the element at the given
+ * index is the one which would be there if the range were sorted.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param index             The index of the element to put in place, which
+ *                          must be less than count.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ */
+void dynamic_array_select(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    size_t index, uint8_t* temp)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(index < count);
+    MODEL_ASSERT(NULL != temp || options->trivially_copyable);
+
+    size_t size = options->element_size;
+
+    /* allow one bad partition per bit of the count before sorting. */
+    int bad_allowed = 0;
+    for (size_t n = count; n > 1; n >>= 1)
+    {
+        ++bad_allowed;
+    }
+
+    while (count > DYNAMIC_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        /* move the median of three, or the pseudomedian of nine, to the
+         * front. */
+        size_t half = count / 2;
+        uint8_t* mid = dynamic_array_elem(base, half, size);
+        uint8_t* last = dynamic_array_elem(base, count - 1, size);
+        if (count > NINTHER_THRESHOLD)
+        {
+            sort3(options, base, mid, last, temp);
+            sort3(options, base + size, mid - size, last - size, temp);
+            sort3(
+                options, base + 2 * size, mid + size, last - 2 * size, temp);
+            sort3(options, mid - size, mid, mid + size, temp);
+            dynamic_array_swap_elements(options, base, mid, temp);
+        }
+        else
+        {
+            sort3(options, mid, base, last, temp);
+        }
+
+        size_t pivot = partition(options, base, count, temp);
+        if (pivot == index)
+        {
+            return;
+        }
+
+        size_t l_size = pivot;
+        size_t r_size = count - pivot - 1;
+        if (l_size < count / 8 || r_size < count / 8)
+        {
+            /* too many unbalanced partitions; this input is adversarial. */
+            if (--bad_allowed == 0)
+            {
+                dynamic_array_sort_unstable(options, base, count, temp);
+                return;
+            }
+        }
+
+        /* continue in the side which holds the index. */
+        if (index < pivot)
+        {
+            count = l_size;
+        }
+        else
+        {
+            base = dynamic_array_elem(base, pivot + 1, size);
+            index -= pivot + 1;
+            count = r_size;
+        }
+    }
+
+    dynamic_array_insertion_sort(options, base, count, 0, temp);
+}
+
+/**
+ * \brief Order two elements.
+ */
+static void sort2(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* temp)
+{
+    if (dynamic_array_compare(options, y, x) < 0)
+    {
+        dynamic_array_swap_elements(options, x, y, temp);
+    }
+}
+
+/**
+ * \brief Order three elements.
+ */
+static void sort3(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* z, uint8_t* temp)
+{
+    sort2(options, x, y, temp);
+    sort2(options, y, z, temp);
+    sort2(options, x, y, temp);
+}
+
+/**
+ * \brief Partition a range around its first element.
+ *
+ * Both scans stop at elements equal to the pivot, so that a range with many
+ * equal elements is still split near its middle.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ *
+ * \returns the final index of the pivot.
+ */
+static size_t partition(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp)
+{
+    size_t size = options->element_size;
+    uint8_t* pivot = base;
+    uint8_t* first = base;
+    uint8_t* last = dynamic_array_elem(base, count, size);
+
+    for (;;)
+    {
+        do
+        {
+            first += size;
+        } while (
+            first < last && dynamic_array_compare(options, first, pivot) < 0);
+
+        /* the pivot itself guards this scan. */
+        do
+        {
+            last -= size;
+        } while (dynamic_array_compare(options, last, pivot) > 0);
+
+        if (first >= last)
+        {
+            break;
+        }
+
+        dynamic_array_swap_elements(options, first, last, temp);
+    }
+
+    /* move the pivot into place. */
+    dynamic_array_swap_elements(options, base, last, temp);
+
+    return (size_t)(last - base) / size;
+}
@@ -0,0 +1,55 @@
+/**
+ * \file dynamic_array_set_intersection.c
+ *
+ * Implementation of dynamic_array_set_intersection.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Append the intersection of two sorted dynamic arrays to an output
+ * array.
+ *
+ * The output holds each element of the left array which is also in the right
+ * array, in sorted order.  An element which appears m times in the left array
+ * and n times in the right array appears min(m, n) times in the output.  The
+ * output array is first grown to hold every element of the smaller array, if
+ * it cannot already.
+ *
+ * Both arrays must be sorted by the comparison method of their options, which
+ * must be the same as those of the output array.  Each run of elements found
+ * in only one array is skipped with a galloping search, in O(log k)
+ * comparisons for a run of k elements, so that intersecting arrays of m and n
+ * elements, with m < n, takes O(m log(n / m)) comparisons; intersecting a
+ * small array with a large one touches only a few elements of the large one.
+ * Elements are copied into the output array with its copy method.
+ *
+ * \param output            The array to which the result is appended, which
+ *                          must not be either input array.
+ * \param left              The left-hand sorted array.
+ * \param right             The right-hand sorted array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown, in which case it is unchanged.
+ */
+int dynamic_array_set_intersection(
+    dynamic_array_t* output, const dynamic_array_t* left,
+    const dynamic_array_t* right)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(output));
+    MODEL_ASSERT(prop_dynamic_array_valid(left));
+    MODEL_ASSERT(prop_dynamic_array_valid(right));
+
+    return
+        dynamic_array_set_operation(
+            output, left, right, DYNAMIC_ARRAY_SET_BOTH,
+            left->elements < right->elements
+                ? left->elements : right->elements);
+}
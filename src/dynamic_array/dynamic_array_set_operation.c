@@ -0,0 +1,115 @@
+/**
+ * \file dynamic_array_set_operation.c
+ *
+ * Implementation of the merge shared by the sorted set operations.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Append the elements selected by the given flags from two sorted
+ * arrays to an output array.
+ *
+ * Runs of elements which are in only one array are found by galloping, and
+ * copied in bulk.
+ *
+ * \param output            The output array.
+ * \param left              The left-hand sorted array.
+ * \param right             The right-hand sorted array.
+ * \param flags             The elements to keep; a combination of the
+ *                          DYNAMIC_ARRAY_SET_* flags.
+ * \param reserve           The greatest number of elements appended, which
+ *                          the output array is grown to hold first.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown, in which case it is unchanged.
+ */
+int dynamic_array_set_operation(
+    dynamic_array_t* output, const dynamic_array_t* left,
+    const dynamic_array_t* right, int flags, size_t reserve)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(output));
+    MODEL_ASSERT(prop_dynamic_array_valid(left));
+    MODEL_ASSERT(prop_dynamic_array_valid(right));
+    MODEL_ASSERT(output != left && output != right);
+    MODEL_ASSERT(
+        left->options->element_size == output->options->element_size
+     && right->options->element_size == output->options->element_size);
+
+    const dynamic_array_options_t* options = left->options;
+    int kind = dynamic_array_typed_kind(options);
+    size_t size = options->element_size;
+    const uint8_t* x = (const uint8_t*)left->array;
+    const uint8_t* y = (const uint8_t*)right->array;
+    size_t nx = left->elements;
+    size_t ny = right->elements;
+    size_t i = 0;
+    size_t j = 0;
+
+    int retval = dynamic_array_reserve_more(output, reserve);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    while (i < nx && j < ny)
+    {
+        const uint8_t* xi = x + i * size;
+        const uint8_t* yj = y + j * size;
+        int result = options->dynamic_array_element_compare(xi, yj, size);
+
+        if (result < 0)
+        {
+            /* skip the run of left elements less than the right element. */
+            size_t run =
+                1 + dynamic_array_gallop(
+                        options, kind, xi + size, nx - i - 1, yj, false);
+            if (flags & DYNAMIC_ARRAY_SET_LEFT_ONLY)
+            {
+                dynamic_array_append_range(output, xi, run);
+            }
+            i += run;
+        }
+        else if (result > 0)
+        {
+            /* skip the run of right elements less than the left element. */
+            size_t run =
+                1 + dynamic_array_gallop(
+                        options, kind, yj + size, ny - j - 1, xi, false);
+            if (flags & DYNAMIC_ARRAY_SET_RIGHT_ONLY)
+            {
+                dynamic_array_append_range(output, yj, run);
+            }
+            j += run;
+        }
+        else
+        {
+            /* each element of one array matches at most one of the other. */
+            if (flags & DYNAMIC_ARRAY_SET_BOTH)
+            {
+                dynamic_array_append_range(output, xi, 1);
+            }
+            ++i;
+            ++j;
+        }
+    }
+
+    if (flags & DYNAMIC_ARRAY_SET_LEFT_ONLY)
+    {
+        dynamic_array_append_range(output, x + i * size, nx - i);
+    }
+
+    if (flags & DYNAMIC_ARRAY_SET_RIGHT_ONLY)
+    {
+        dynamic_array_append_range(output, y + j * size, ny - j);
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
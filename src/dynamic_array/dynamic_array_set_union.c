@@ -0,0 +1,55 @@
+/**
+ * \file dynamic_array_set_union.c
+ *
+ * Implementation of dynamic_array_set_union.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Append the union of two sorted dynamic arrays to an output array.
+ *
+ * The output holds each element of either array in sorted order.  An element
+ * which appears m times in the left array and n times in the right array
+ * appears max(m, n) times in the output, with the copies from the left array
+ * first.  The output array is first grown to hold every element of both
+ * arrays, if it cannot already.
+ *
+ * Both arrays must be sorted by the comparison method of their options, which
+ * must be the same as those of the output array.  Runs of elements found in
+ * only one array are measured with a galloping search, and copied in bulk
+ * when the elements are trivially copyable, so that a union of arrays of m
+ * and n elements, with m < n, takes O(m log(n / m)) comparisons.  Elements are
+ * copied into the output array with its copy method.
+ *
+ * \param output            The array to which the result is appended, which
+ *                          must not be either input array.
+ * \param left              The left-hand sorted array.
+ * \param right             The right-hand sorted array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_GROW_ALLOCATION_FAILED if the output
+ *             array could not be grown, in which case it is unchanged.
+ */
+int dynamic_array_set_union(
+    dynamic_array_t* output, const dynamic_array_t* left,
+    const dynamic_array_t* right)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(output));
+    MODEL_ASSERT(prop_dynamic_array_valid(left));
+    MODEL_ASSERT(prop_dynamic_array_valid(right));
+
+    int flags =
+        DYNAMIC_ARRAY_SET_LEFT_ONLY | DYNAMIC_ARRAY_SET_RIGHT_ONLY
+      | DYNAMIC_ARRAY_SET_BOTH;
+
+    return
+        dynamic_array_set_operation(
+            output, left, right, flags, left->elements + right->elements);
+}
@@ -0,0 +1,49 @@
+/**
+ * \file dynamic_array_shrink_to_fit.c
+ *
+ * Implementation of dynamic_array_shrink_to_fit.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Reduce the reserve size of the dynamic array to its number of
+ * elements.
+ *
+ * The reserve size never drops below one element.  Trivially copyable
+ * elements are moved by the allocator's reallocate() method; otherwise a new
+ * buffer is allocated and each element is copied with the copy method and then
+ * disposed, as when the array grows.  If the array has inline storage and
+ * the elements fit in it, they are moved back there, and the allocated buffer
+ * is released.
+ *
+ * \param array             The array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SHRINK_ALLOCATION_FAILED if memory could
+ *             not be allocated for the smaller array, in which case the array
+ *             is unchanged.
+ */
+int dynamic_array_shrink_to_fit(dynamic_array_t* array)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+
+    size_t reserve = array->elements > 0 ? array->elements : 1;
+    if (reserve >= array->reserved_elements)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    if (!dynamic_array_resize(array, reserve))
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_SHRINK_ALLOCATION_FAILED;
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
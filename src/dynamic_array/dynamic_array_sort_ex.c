@@ -0,0 +1,127 @@
+/**
+ * \file dynamic_array_sort_ex.c
+ *
+ * Implementation of dynamic_array_sort_ex.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Sort the given dynamic array using the given sort mode.
+ *
+ * With \ref DYNAMIC_ARRAY_SORT_UNSTABLE, the array is sorted in place with a
+ * pattern-defeating quicksort, which runs in O(n log n) time in the worst case
+ * and does not allocate memory for trivially copyable elements.  Elements that
+ * compare as equal may change relative positions.
+ *
+ * With \ref DYNAMIC_ARRAY_SORT_STABLE, the array is sorted with a merge sort,
+ * which preserves the relative positions of elements that compare as equal.
+ * This mode makes a single allocation of a scratch buffer holding half of the
+ * elements.
+ *
+ * In either mode, trivially copyable elements are moved by their bytes.  Other
+ * elements are moved by copying them with the copy method and then disposing
+ * of the originals, as when the array grows, and one more element is
+ * allocated to hold an element while others are moved.
+ *
+ * Trivially copyable arrays whose comparison method is one of the built-in
+ * integer or floating point comparison methods in vpr/compare.h are sorted
+ * with an in-place radix sort instead, which needs no scratch buffer.
+ * Floating point arrays are only radix sorted in unstable mode.
+ *
+ * \param array             The array to be sorted.
+ * \param mode              The sort mode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL if the sort mode is invalid.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer of a stable sort, or for the
+ *             temporary element, failed.
+ */
+int dynamic_array_sort_ex(dynamic_array_t* array, int mode)
+{
+    MODEL_ASSERT(array != NULL);
+    MODEL_ASSERT(array->array != NULL);
+    MODEL_ASSERT(array->reserved_elements >= array->elements);
+    MODEL_ASSERT(array->options != NULL);
+    MODEL_ASSERT(array->options->alloc_opts != NULL);
+    MODEL_ASSERT(array->options->dynamic_array_element_compare != NULL);
+    MODEL_ASSERT(array->options->element_size > 0);
+
+    if (
+        DYNAMIC_ARRAY_SORT_UNSTABLE != mode
+     && DYNAMIC_ARRAY_SORT_STABLE != mode)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL;
+    }
+
+    /* built-in comparison methods have faster, typed kernels. */
+    if (
+        dynamic_array_sort_typed(
+            array->options, (uint8_t*)array->array, array->elements, mode))
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    const dynamic_array_options_t* options = array->options;
+    size_t size = options->element_size;
+    size_t count = array->elements;
+
+    /* a stable sort of a long range needs half of the elements as scratch. */
+    size_t scratch_elements = 0;
+    if (
+        DYNAMIC_ARRAY_SORT_STABLE == mode
+     && count > DYNAMIC_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        scratch_elements = count / 2;
+    }
+
+    /* elements that are not trivially copyable are moved through a vacant
+     * element, which follows the scratch buffer. */
+    size_t temp_elements = options->trivially_copyable ? 0 : 1;
+
+    uint8_t* scratch = NULL;
+    uint8_t* temp = NULL;
+    if (scratch_elements + temp_elements > 0)
+    {
+        scratch =
+            (uint8_t*)allocate(
+                options->alloc_opts,
+                (scratch_elements + temp_elements) * size);
+        if (NULL == scratch)
+        {
+            return VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED;
+        }
+
+        if (temp_elements > 0)
+        {
+            temp = dynamic_array_elem(scratch, scratch_elements, size);
+        }
+    }
+
+    if (DYNAMIC_ARRAY_SORT_UNSTABLE == mode)
+    {
+        dynamic_array_sort_unstable(
+            options, (uint8_t*)array->array, count, temp);
+    }
+    else
+    {
+        /* short ranges are insertion sorted, and need no scratch buffer. */
+        dynamic_array_sort_stable(
+            options, (uint8_t*)array->array, count,
+            scratch_elements > 0 ? scratch : NULL, temp);
+    }
+
+    if (NULL != scratch)
+    {
+        release(options->alloc_opts, scratch);
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,402 @@
+/**
+ * \file dynamic_array_sort_parallel.c
+ *
+ * Implementation of dynamic_array_sort_parallel.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Arrays with fewer elements than this per task are sorted serially.
+ */
+#define PARALLEL_MIN_ELEMENTS_PER_TASK 4096
+
+/**
+ * \brief The state shared by the tasks of a parallel sort.
+ */
+typedef struct parallel_sort
+{
+    const dynamic_array_options_t* options;
+    int mode;
+    size_t count;
+    size_t tasks;
+
+    /* the runs being merged, and where the merged runs are written. */
+    uint8_t* input;
+    uint8_t* output;
+
+    /* one vacant element per task, or NULL if elements are trivially
+     * copyable. */
+    uint8_t* temps;
+
+    /* the length of each run in the current merge pass. */
+    size_t run_length;
+} parallel_sort_t;
+
+/* forward decls for internal methods */
+static size_t task_bound(const parallel_sort_t* sort, size_t index);
+static void sort_task(void* context, size_t index);
+static void merge_task(void* context, size_t index);
+static void dispose_task(void* context, size_t index);
+static void copy_task(void* context, size_t index);
+static size_t co_rank(
+    const dynamic_array_options_t* options, const uint8_t* lhs,
+    size_t lhs_count, const uint8_t* rhs, size_t rhs_count, size_t k);
+static void merge(
+    const dynamic_array_options_t* options, const uint8_t* lhs,
+    const uint8_t* lhs_end, const uint8_t* rhs, const uint8_t* rhs_end,
+    uint8_t* out);
+
+/**
+ * \brief Sort the given dynamic array using several tasks at once.
+ *
+ * The array is split into executor->concurrency runs, which are sorted
+ * concurrently.  The runs are then merged pairwise, with each merge pass
+ * split evenly across executor->concurrency tasks.  Each task writes a fixed
+ * range of the output, so the result does not depend on how the executor
+ * schedules tasks.  In \ref DYNAMIC_ARRAY_SORT_STABLE mode the result is
+ * identical to that of dynamic_array_sort_ex(); in unstable mode, elements
+ * that compare as equal may be ordered differently.
+ *
+ * This method makes a single allocation of a scratch buffer the size of the
+ * array.  Elements are moved as with dynamic_array_sort_ex(); elements which
+ * are not trivially copyable are moved with the copy and dispose methods,
+ * which may then be called from several tasks at once, and the scratch buffer
+ * also holds one temporary element per task.  Since the tasks of a merge pass
+ * search runs which other tasks are merging, each pass copies its input, and
+ * only disposes it once every task of the pass has finished.  If the executor
+ * is NULL, its concurrency is less than two, or the array is small, then the
+ * array is sorted serially with dynamic_array_sort_ex().
+ *
+ * \param array             The array to be sorted.
+ * \param mode              The sort mode.
+ * \param executor          The executor used to run tasks, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL if the sort mode is invalid.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED if memory
+ *             allocation for the scratch buffer failed.
+ */
+int dynamic_array_sort_parallel(
+    dynamic_array_t* array, int mode,
+    const dynamic_array_sort_executor_t* executor)
+{
+    MODEL_ASSERT(array != NULL);
+    MODEL_ASSERT(array->options != NULL);
+    MODEL_ASSERT(array->options->alloc_opts != NULL);
+    MODEL_ASSERT(NULL == executor || NULL != executor->run);
+
+    if (
+        DYNAMIC_ARRAY_SORT_UNSTABLE != mode
+     && DYNAMIC_ARRAY_SORT_STABLE != mode)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL;
+    }
+
+    /* use no more tasks than the array can keep busy. */
+    size_t tasks = NULL == executor ? 1 : executor->concurrency;
+    if (tasks > array->elements / PARALLEL_MIN_ELEMENTS_PER_TASK)
+    {
+        tasks = array->elements / PARALLEL_MIN_ELEMENTS_PER_TASK;
+    }
+
+    if (tasks < 2)
+    {
+        return dynamic_array_sort_ex(array, mode);
+    }
+
+    /* elements which are not trivially copyable move through a vacant
+     * element per task, which follow the scratch copy of the array. */
+    size_t size = array->options->element_size;
+    size_t temps = array->options->trivially_copyable ? 0 : tasks;
+    uint8_t* scratch =
+        (uint8_t*)allocate(
+            array->options->alloc_opts, (array->elements + temps) * size);
+    if (NULL == scratch)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_SORT_ALLOCATION_FAILED;
+    }
+
+    parallel_sort_t sort;
+    sort.options = array->options;
+    sort.mode = mode;
+    sort.count = array->elements;
+    sort.tasks = tasks;
+    sort.input = (uint8_t*)array->array;
+    sort.output = scratch;
+    sort.temps =
+        temps > 0 ? dynamic_array_elem(scratch, array->elements, size) : NULL;
+
+    /* sort one run per task, using the matching part of the scratch buffer
+     * for stable sorts. */
+    executor->run(executor->context, &sort_task, &sort, tasks);
+
+    /* merge pairs of runs until one run remains, alternating between the
+     * array and the scratch buffer. */
+    for (size_t runs = tasks, per_run = 1; runs > 1; per_run *= 2)
+    {
+        sort.run_length = per_run;
+        executor->run(executor->context, &merge_task, &sort, tasks);
+        if (!sort.options->trivially_copyable)
+        {
+            executor->run(executor->context, &dispose_task, &sort, tasks);
+        }
+
+        uint8_t* tmp = sort.input;
+        sort.input = sort.output;
+        sort.output = tmp;
+        runs = (runs + 1) / 2;
+    }
+
+    /* if the sorted elements ended in the scratch buffer, copy them back. */
+    if (sort.input != (uint8_t*)array->array)
+    {
+        sort.output = (uint8_t*)array->array;
+        executor->run(executor->context, &copy_task, &sort, tasks);
+    }
+
+    release(array->options->alloc_opts, scratch);
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Get the first element of a task's share of the array.
+ *
+ * The initial runs are the shares of each task, so run r of a merge pass with
+ * run_length initial runs per run starts at task_bound(r * run_length).
+ *
+ * \param sort              The parallel sort.
+ * \param index             The task index, up to and including sort->tasks.
+ *
+ * \returns the index of the first element of this share.
+ */
+static size_t task_bound(const parallel_sort_t* sort, size_t index)
+{
+    if (index >= sort->tasks)
+    {
+        return sort->count;
+    }
+
+    /* compute (count * index) / tasks without overflow. */
+    return
+        (sort->count / sort->tasks) * index
+      + ((sort->count % sort->tasks) * index) / sort->tasks;
+}
+
+/**
+ * \brief Sort one initial run.
+ *
+ * \param context           The parallel sort.
+ * \param index             The task index.
+ */
+static void sort_task(void* context, size_t index)
+{
+    parallel_sort_t* sort = (parallel_sort_t*)context;
+    size_t size = sort->options->element_size;
+    size_t begin = task_bound(sort, index);
+    size_t count = task_bound(sort, index + 1) - begin;
+    uint8_t* base = dynamic_array_elem(sort->input, begin, size);
+    uint8_t* temp =
+        NULL != sort->temps
+            ? dynamic_array_elem(sort->temps, index, size) : NULL;
+
+    if (dynamic_array_sort_typed(sort->options, base, count, sort->mode))
+    {
+        return;
+    }
+
+    if (DYNAMIC_ARRAY_SORT_UNSTABLE == sort->mode)
+    {
+        dynamic_array_sort_unstable(sort->options, base, count, temp);
+    }
+    else
+    {
+        dynamic_array_sort_stable(
+            sort->options, base, count,
+            dynamic_array_elem(sort->output, begin, size), temp);
+    }
+}
+
+/**
+ * \brief Write one task's share of the output of a merge pass.
+ *
+ * The share may span the outputs of several pairs of runs.  For each one, the
+ * part of each run that lands in the share is found by binary search, and
+ * those parts are merged.
+ *
+ * \param context           The parallel sort.
+ * \param index             The task index.
+ */
+static void merge_task(void* context, size_t index)
+{
+    parallel_sort_t* sort = (parallel_sort_t*)context;
+    const dynamic_array_options_t* options = sort->options;
+    size_t size = options->element_size;
+    size_t out_begin = task_bound(sort, index);
+    size_t out_end = task_bound(sort, index + 1);
+
+    for (size_t pair = 0; pair * 2 * sort->run_length < sort->tasks; ++pair)
+    {
+        size_t first_run = pair * 2 * sort->run_length;
+        size_t lhs_begin = task_bound(sort, first_run);
+        size_t rhs_begin = task_bound(sort, first_run + sort->run_length);
+        size_t rhs_end = task_bound(sort, first_run + 2 * sort->run_length);
+
+        /* skip pairs that do not overlap this share. */
+        if (rhs_end <= out_begin || lhs_begin >= out_end)
+        {
+            continue;
+        }
+
+        size_t from = out_begin > lhs_begin ? out_begin - lhs_begin : 0;
+        size_t to = (out_end < rhs_end ? out_end : rhs_end) - lhs_begin;
+
+        uint8_t* lhs = dynamic_array_elem(sort->input, lhs_begin, size);
+        uint8_t* rhs = dynamic_array_elem(sort->input, rhs_begin, size);
+        size_t lhs_count = rhs_begin - lhs_begin;
+        size_t rhs_count = rhs_end - rhs_begin;
+
+        size_t lhs_from =
+            co_rank(options, lhs, lhs_count, rhs, rhs_count, from);
+        size_t lhs_to =
+            co_rank(options, lhs, lhs_count, rhs, rhs_count, to);
+
+        merge(
+            options,
+            lhs + lhs_from * size, lhs + lhs_to * size,
+            rhs + (from - lhs_from) * size, rhs + (to - lhs_to) * size,
+            dynamic_array_elem(sort->output, lhs_begin + from, size));
+    }
+}
+
+/**
+ * \brief Dispose one task's share of the input of a finished merge pass.
+ *
+ * \param context           The parallel sort.
+ * \param index             The task index.
+ */
+static void dispose_task(void* context, size_t index)
+{
+    parallel_sort_t* sort = (parallel_sort_t*)context;
+    const dynamic_array_options_t* options = sort->options;
+    size_t size = options->element_size;
+    size_t end = task_bound(sort, index + 1);
+
+    for (size_t i = task_bound(sort, index); i < end; ++i)
+    {
+        options->dynamic_array_element_dispose(
+            options->context, dynamic_array_elem(sort->input, i, size));
+    }
+}
+
+/**
+ * \brief Move one task's share of the sorted elements back to the array.
+ *
+ * \param context           The parallel sort.
+ * \param index             The task index.
+ */
+static void copy_task(void* context, size_t index)
+{
+    parallel_sort_t* sort = (parallel_sort_t*)context;
+    size_t size = sort->options->element_size;
+    size_t begin = task_bound(sort, index);
+    size_t end = task_bound(sort, index + 1);
+
+    dynamic_array_move_elements(
+        sort->options, dynamic_array_elem(sort->output, begin, size),
+        dynamic_array_elem(sort->input, begin, size), end - begin);
+}
+
+/**
+ * \brief Find how many elements of the left-hand run are among the first k
+ * elements of the merge of two runs.
+ *
+ * Ties are taken from the left-hand run first, as in merge().
+ *
+ * \param options           The dynamic array options.
+ * \param lhs               The left-hand run.
+ * \param lhs_count         The number of elements in the left-hand run.
+ * \param rhs               The right-hand run.
+ * \param rhs_count         The number of elements in the right-hand run.
+ * \param k                 The number of merged elements.
+ *
+ * \returns the number of left-hand elements among the first k.
+ */
+static size_t co_rank(
+    const dynamic_array_options_t* options, const uint8_t* lhs,
+    size_t lhs_count, const uint8_t* rhs, size_t rhs_count, size_t k)
+{
+    size_t size = options->element_size;
+    size_t lo = k > rhs_count ? k - rhs_count : 0;
+    size_t hi = k < lhs_count ? k : lhs_count;
+
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        /* if lhs[mid] precedes rhs[k - mid - 1], then more than mid left-hand
+         * elements are among the first k. */
+        if (
+            dynamic_array_compare(
+                options, lhs + mid * size, rhs + (k - mid - 1) * size) <= 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * \brief Merge two sorted runs, taking ties from the left-hand run first.
+ *
+ * Each element is copied to the output, leaving the runs intact, so that
+ * other tasks of the same merge pass can still search them.
+ *
+ * \param options           The dynamic array options.
+ * \param lhs               The start of the left-hand run.
+ * \param lhs_end           The end of the left-hand run.
+ * \param rhs               The start of the right-hand run.
+ * \param rhs_end           The end of the right-hand run.
+ * \param out               The output, which must not overlap either run.
+ */
+static void merge(
+    const dynamic_array_options_t* options, const uint8_t* lhs,
+    const uint8_t* lhs_end, const uint8_t* rhs, const uint8_t* rhs_end,
+    uint8_t* out)
+{
+    size_t size = options->element_size;
+
+    while (lhs < lhs_end && rhs < rhs_end)
+    {
+        if (dynamic_array_compare(options, rhs, lhs) < 0)
+        {
+            dynamic_array_copy_elements(options, out, rhs, 1);
+            rhs += size;
+        }
+        else
+        {
+            dynamic_array_copy_elements(options, out, lhs, 1);
+            lhs += size;
+        }
+
+        out += size;
+    }
+
+    dynamic_array_copy_elements(
+        options, out, lhs, (size_t)(lhs_end - lhs) / size);
+    out += lhs_end - lhs;
+    dynamic_array_copy_elements(
+        options, out, rhs, (size_t)(rhs_end - rhs) / size);
+}
@@ -0,0 +1,85 @@
+/**
+ * \file dynamic_array_sort_stable.c
+ *
+ * Implementation of the stable merge sort used by dynamic_array_sort_ex.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Stable sort a range of elements, using a scratch buffer.
+ *
+ * This is a top-down merge sort which insertion sorts short runs.  Only the
+ * left half of each merge is moved to the scratch buffer, so the buffer need
+ * only hold half of the range.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param scratch           A scratch buffer large enough to hold count / 2
+ *                          elements.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ */
+void dynamic_array_sort_stable(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* scratch, uint8_t* temp)
+{
+    size_t size = options->element_size;
+
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != base || 0 == count);
+    MODEL_ASSERT(NULL != temp || options->trivially_copyable);
+
+    if (count <= DYNAMIC_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        dynamic_array_insertion_sort(options, base, count, 0, temp);
+        return;
+    }
+
+    /* sort each half. */
+    size_t lhs_size = count / 2;
+    uint8_t* rhs = dynamic_array_elem(base, lhs_size, size);
+    uint8_t* end = dynamic_array_elem(base, count, size);
+    dynamic_array_sort_stable(options, base, lhs_size, scratch, temp);
+    dynamic_array_sort_stable(options, rhs, count - lhs_size, scratch, temp);
+
+    /* if the halves are already in order, then there is nothing to merge. */
+    if (dynamic_array_compare(options, rhs - size, rhs) <= 0)
+    {
+        return;
+    }
+
+    /* move the left half aside, and merge both halves from the front.  The
+     * output never overtakes the unmerged part of the right half. */
+    dynamic_array_move_elements(options, scratch, base, lhs_size);
+
+    uint8_t* lhs = scratch;
+    uint8_t* lhs_end = dynamic_array_elem(scratch, lhs_size, size);
+    uint8_t* out = base;
+    while (lhs < lhs_end && rhs < end)
+    {
+        /* take from the left on ties, to keep the sort stable. */
+        if (dynamic_array_compare(options, rhs, lhs) < 0)
+        {
+            dynamic_array_move_elements(options, out, rhs, 1);
+            rhs += size;
+        }
+        else
+        {
+            dynamic_array_move_elements(options, out, lhs, 1);
+            lhs += size;
+        }
+
+        out += size;
+    }
+
+    /* the rest of the right half is already in place. */
+    dynamic_array_move_elements(
+        options, out, lhs, (size_t)(lhs_end - lhs) / size);
+}
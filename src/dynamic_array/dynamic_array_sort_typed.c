@@ -0,0 +1,249 @@
+/**
+ * \file dynamic_array_sort_typed.c
+ *
+ * Implementation of the typed sort kernels used by dynamic_array_sort_ex.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Buckets up to this many elements are sorted by insertion sort.
+ */
+#define RADIX_INSERTION_THRESHOLD 48
+
+/*
+ * Define an in-place most-significant-digit radix sort (an American flag
+ * sort) for BITS-bit values.
+ *
+ * Each value is mapped to an unsigned key which sorts in the same order as the
+ * value: signed values have their sign bit flipped, and negative floating
+ * point values have all of their bits flipped.  Values are loaded and stored
+ * with memcpy(), so that the kernel is free of aliasing concerns.
+ *
+ * The bucket bounds are only needed until the values of a digit have been
+ * scattered, so every level of the recursion shares one pair of bucket
+ * arrays, and the buckets to recurse into are found again by scanning.  This
+ * keeps the stack use of each level small.
+ */
+#define DEFINE_RADIX_SORT(T, BITS) \
+static inline T load_##BITS(const uint8_t* p) \
+{ \
+    T value; \
+    memcpy(&value, p, sizeof(value)); \
+    return value; \
+} \
+\
+static inline void store_##BITS(uint8_t* p, T value) \
+{ \
+    memcpy(p, &value, sizeof(value)); \
+} \
+\
+static inline T key_##BITS(T value, T xor_mask, T neg_mask) \
+{ \
+    T negative = (T)(0 - (T)(value >> (BITS - 1))); \
+\
+    return (T)(value ^ (xor_mask | (neg_mask & negative))); \
+} \
+\
+static void radix_sort_##BITS( \
+    uint8_t* base, size_t count, T xor_mask, T neg_mask, int shift, \
+    size_t* next, size_t* end) \
+{ \
+    const size_t size = sizeof(T); \
+\
+    for (;;) \
+    { \
+        if (count <= RADIX_INSERTION_THRESHOLD) \
+        { \
+            for (size_t i = 1; i < count; ++i) \
+            { \
+                T value = load_##BITS(base + i * size); \
+                T key = key_##BITS(value, xor_mask, neg_mask); \
+                size_t j = i; \
+                for (; j > 0; --j) \
+                { \
+                    T prev = load_##BITS(base + (j - 1) * size); \
+                    if (key_##BITS(prev, xor_mask, neg_mask) <= key) \
+                    { \
+                        break; \
+                    } \
+                    store_##BITS(base + j * size, prev); \
+                } \
+                store_##BITS(base + j * size, value); \
+            } \
+\
+            return; \
+        } \
+\
+        /* count the values in each bucket of this digit. */ \
+        memset(end, 0, 256 * sizeof(size_t)); \
+        for (size_t i = 0; i < count; ++i) \
+        { \
+            T value = load_##BITS(base + i * size); \
+            ++end[(key_##BITS(value, xor_mask, neg_mask) >> shift) & 0xFF]; \
+        } \
+\
+        /* if every value shares this digit, then move to the next one. */ \
+        T first = key_##BITS(load_##BITS(base), xor_mask, neg_mask); \
+        if (end[(first >> shift) & 0xFF] == count) \
+        { \
+            if (0 == shift) \
+            { \
+                return; \
+            } \
+\
+            shift -= 8; \
+            continue; \
+        } \
+\
+        size_t sum = 0; \
+        for (size_t b = 0; b < 256; ++b) \
+        { \
+            next[b] = sum; \
+            sum += end[b]; \
+            end[b] = sum; \
+        } \
+\
+        /* move each value to its bucket, following cycles of displaced \
+         * values. */ \
+        for (size_t b = 0; b < 256; ++b) \
+        { \
+            while (next[b] < end[b]) \
+            { \
+                T value = load_##BITS(base + next[b] * size); \
+                size_t digit = \
+                    (key_##BITS(value, xor_mask, neg_mask) >> shift) & 0xFF; \
+                while (digit != b) \
+                { \
+                    uint8_t* slot = base + next[digit]++ * size; \
+                    T displaced = load_##BITS(slot); \
+                    store_##BITS(slot, value); \
+                    value = displaced; \
+                    digit = \
+                        (key_##BITS(value, xor_mask, neg_mask) >> shift) \
+                            & 0xFF; \
+                } \
+                store_##BITS(base + next[b]++ * size, value); \
+            } \
+        } \
+\
+        if (0 == shift) \
+        { \
+            return; \
+        } \
+\
+        /* sort each bucket by the next digit; the buckets are found by \
+         * scanning, since the recursion reuses the bucket arrays. */ \
+        for (size_t start = 0, stop; start < count; start = stop) \
+        { \
+            T digit = \
+                (key_##BITS(load_##BITS(base + start * size), xor_mask, \
+                            neg_mask) >> shift) & 0xFF; \
+            for (stop = start + 1; stop < count; ++stop) \
+            { \
+                T key = \
+                    key_##BITS( \
+                        load_##BITS(base + stop * size), xor_mask, neg_mask); \
+                if (((key >> shift) & 0xFF) != digit) \
+                { \
+                    break; \
+                } \
+            } \
+\
+            if (stop - start > 1) \
+            { \
+                radix_sort_##BITS( \
+                    base + start * size, stop - start, xor_mask, neg_mask, \
+                    shift - 8, next, end); \
+            } \
+        } \
+\
+        return; \
+    } \
+}
+
+DEFINE_RADIX_SORT(uint8_t, 8)
+DEFINE_RADIX_SORT(uint16_t, 16)
+DEFINE_RADIX_SORT(uint32_t, 32)
+DEFINE_RADIX_SORT(uint64_t, 64)
+
+/**
+ * \brief Sort a range of elements with a typed kernel, if the comparison
+ * method of the options is a built-in one.
+ *
+ * Integers are sorted with an in-place radix sort.  Equal integers cannot be
+ * told apart, so this is suitable for stable sorts.  Floating point values
+ * are also radix sorted, but only for unstable sorts, since values such as
+ * -0.0 and 0.0 compare as equal but can be told apart.  The kernels move
+ * values by their bytes, so they are only used for trivially copyable
+ * elements.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param mode              The sort mode.
+ *
+ * \returns true if the range was sorted, or false if there is no typed kernel
+ *          for these options and mode.
+ */
+bool dynamic_array_sort_typed(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    int mode)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != base || 0 == count);
+
+    int kind = dynamic_array_typed_kind(options);
+    if (
+        !options->trivially_copyable
+     || DYNAMIC_ARRAY_TYPED_KIND_NONE == kind
+     || (DYNAMIC_ARRAY_TYPED_KIND_FLOAT == kind
+            && DYNAMIC_ARRAY_SORT_STABLE == mode))
+    {
+        return false;
+    }
+
+    /* the bucket arrays shared by every level of the radix sort. */
+    size_t next[256];
+    size_t end[256];
+
+    /* signed and floating point keys flip their sign bit, and negative
+     * floating point keys flip every other bit as well. */
+    bool flip_sign = DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED != kind;
+    bool flip_negative = DYNAMIC_ARRAY_TYPED_KIND_FLOAT == kind;
+
+    switch (options->element_size)
+    {
+        case sizeof(uint8_t):
+            radix_sort_8(
+                base, count, flip_sign ? UINT8_C(0x80) : 0,
+                flip_negative ? UINT8_MAX : 0, 0, next, end);
+            return true;
+
+        case sizeof(uint16_t):
+            radix_sort_16(
+                base, count, flip_sign ? UINT16_C(0x8000) : 0,
+                flip_negative ? UINT16_MAX : 0, 8, next, end);
+            return true;
+
+        case sizeof(uint32_t):
+            radix_sort_32(
+                base, count, flip_sign ? UINT32_C(0x80000000) : 0,
+                flip_negative ? UINT32_MAX : 0, 24, next, end);
+            return true;
+
+        case sizeof(uint64_t):
+            radix_sort_64(
+                base, count, flip_sign ? UINT64_C(0x8000000000000000) : 0,
+                flip_negative ? UINT64_MAX : 0, 56, next, end);
+            return true;
+
+        default:
+            return false;
+    }
+}
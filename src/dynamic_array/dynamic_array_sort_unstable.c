@@ -0,0 +1,440 @@
+/**
+ * \file dynamic_array_sort_unstable.c
+ *
+ * Implementation of the in-place unstable sort used by dynamic_array_sort.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Ranges larger than this use the pseudomedian of nine as a pivot.
+ */
+#define NINTHER_THRESHOLD 128
+
+/**
+ * \brief The number of moves allowed when checking for a sorted range.
+ */
+#define PARTIAL_INSERTION_SORT_LIMIT 8
+
+/* forward decls for internal methods */
+static void pdq_loop(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    int bad_allowed, bool leftmost, uint8_t* temp);
+static void sort2(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* temp);
+static void sort3(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* z, uint8_t* temp);
+static size_t partition_right(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    bool* already_partitioned, uint8_t* temp);
+static size_t partition_left(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp);
+static void shuffle(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp);
+static void heap_sort(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp);
+
+/**
+ * \brief Sort a range of elements in place, without allocating.
+ *
+ * This is a pattern-defeating quicksort, which falls back to heapsort on
+ * adversarial input.  It is not stable.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param temp              A vacant slot for one element, which is only used
+ *                          if the elements are not trivially copyable.
+ */
+void dynamic_array_sort_unstable(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != base || 0 == count);
+    MODEL_ASSERT(NULL != temp || options->trivially_copyable);
+
+    /* allow one bad partition per bit of the count before heapsorting. */
+    int bad_allowed = 0;
+    for (size_t n = count; n > 1; n >>= 1)
+    {
+        ++bad_allowed;
+    }
+
+    pdq_loop(options, base, count, bad_allowed, true, temp);
+}
+
+/**
+ * \brief Sort a range, recursing into the smaller partition and looping on the
+ * larger one, so that the stack depth is O(log n).
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param bad_allowed       The number of unbalanced partitions allowed before
+ *                          falling back to heapsort.
+ * \param leftmost          True if no element precedes this range, or false if
+ *                          the preceding element is no greater than any
+ *                          element in this range.
+ * \param temp              A vacant slot for one element.
+ */
+static void pdq_loop(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    int bad_allowed, bool leftmost, uint8_t* temp)
+{
+    size_t size = options->element_size;
+
+    for (;;)
+    {
+        if (count <= DYNAMIC_ARRAY_SORT_INSERTION_THRESHOLD)
+        {
+            dynamic_array_insertion_sort(options, base, count, 0, temp);
+            return;
+        }
+
+        /* move the median of three, or the pseudomedian of nine, to the
+         * front; some later element is then no less than the pivot. */
+        size_t half = count / 2;
+        uint8_t* mid = dynamic_array_elem(base, half, size);
+        uint8_t* last = dynamic_array_elem(base, count - 1, size);
+        if (count > NINTHER_THRESHOLD)
+        {
+            sort3(options, base, mid, last, temp);
+            sort3(options, base + size, mid - size, last - size, temp);
+            sort3(
+                options, base + 2 * size, mid + size, last - 2 * size, temp);
+            sort3(options, mid - size, mid, mid + size, temp);
+            dynamic_array_swap_elements(options, base, mid, temp);
+        }
+        else
+        {
+            sort3(options, mid, base, last, temp);
+        }
+
+        /* if the pivot equals the element before this range, then every
+         * element equal to it is already in place. */
+        if (
+            !leftmost
+         && dynamic_array_compare(options, base - size, base) >= 0)
+        {
+            size_t pivot = partition_left(options, base, count, temp);
+            base = dynamic_array_elem(base, pivot + 1, size);
+            count -= pivot + 1;
+            continue;
+        }
+
+        bool already_partitioned;
+        size_t pivot =
+            partition_right(
+                options, base, count, &already_partitioned, temp);
+        uint8_t* pivot_elem = dynamic_array_elem(base, pivot, size);
+        size_t l_size = pivot;
+        size_t r_size = count - pivot - 1;
+
+        if (l_size < count / 8 || r_size < count / 8)
+        {
+            /* too many unbalanced partitions; this input is adversarial. */
+            if (--bad_allowed == 0)
+            {
+                heap_sort(options, base, count, temp);
+                return;
+            }
+
+            /* break up patterns which led to the bad partition. */
+            shuffle(options, base, l_size, temp);
+            shuffle(options, pivot_elem + size, r_size, temp);
+        }
+        else if (already_partitioned)
+        {
+            /* the range may already be sorted; check cheaply. */
+            if (
+                dynamic_array_insertion_sort(
+                    options, base, l_size, PARTIAL_INSERTION_SORT_LIMIT, temp)
+             && dynamic_array_insertion_sort(
+                    options, pivot_elem + size, r_size,
+                    PARTIAL_INSERTION_SORT_LIMIT, temp))
+            {
+                return;
+            }
+        }
+
+        /* recurse into the smaller side, and loop on the larger side. */
+        if (l_size < r_size)
+        {
+            pdq_loop(options, base, l_size, bad_allowed, leftmost, temp);
+            base = pivot_elem + size;
+            count = r_size;
+            leftmost = false;
+        }
+        else
+        {
+            pdq_loop(
+                options, pivot_elem + size, r_size, bad_allowed, false, temp);
+            count = l_size;
+        }
+    }
+}
+
+/**
+ * \brief Order two elements.
+ */
+static void sort2(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* temp)
+{
+    if (dynamic_array_compare(options, y, x) < 0)
+    {
+        dynamic_array_swap_elements(options, x, y, temp);
+    }
+}
+
+/**
+ * \brief Order three elements.
+ */
+static void sort3(
+    const dynamic_array_options_t* options, uint8_t* x, uint8_t* y,
+    uint8_t* z, uint8_t* temp)
+{
+    sort2(options, x, y, temp);
+    sort2(options, y, z, temp);
+    sort2(options, x, y, temp);
+}
+
+/**
+ * \brief Partition a range around its first element, placing elements equal
+ * to the pivot on the right.
+ *
+ * Some element after the first must be no less than the pivot.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param already_partitioned Set to true if no elements were swapped.
+ * \param temp              A vacant slot for one element.
+ *
+ * \returns the final index of the pivot.
+ */
+static size_t partition_right(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    bool* already_partitioned, uint8_t* temp)
+{
+    size_t size = options->element_size;
+    uint8_t* pivot = base;
+    uint8_t* first = base;
+    uint8_t* last = dynamic_array_elem(base, count, size);
+
+    /* find the first element no less than the pivot; the choice of pivot
+     * guarantees that one exists. */
+    do
+    {
+        first += size;
+    } while (dynamic_array_compare(options, first, pivot) < 0);
+
+    /* find the last element less than the pivot; if no element was skipped
+     * above, then first guards this scan. */
+    if (first - size == base)
+    {
+        do
+        {
+            last -= size;
+        } while (
+            first < last && dynamic_array_compare(options, last, pivot) >= 0);
+    }
+    else
+    {
+        do
+        {
+            last -= size;
+        } while (dynamic_array_compare(options, last, pivot) >= 0);
+    }
+
+    *already_partitioned = first >= last;
+
+    /* swap misplaced pairs; the previous swap guards both scans. */
+    while (first < last)
+    {
+        dynamic_array_swap_elements(options, first, last, temp);
+
+        do
+        {
+            first += size;
+        } while (dynamic_array_compare(options, first, pivot) < 0);
+
+        do
+        {
+            last -= size;
+        } while (dynamic_array_compare(options, last, pivot) >= 0);
+    }
+
+    /* move the pivot into place. */
+    uint8_t* pivot_pos = first - size;
+    dynamic_array_swap_elements(options, base, pivot_pos, temp);
+
+    return (size_t)(pivot_pos - base) / size;
+}
+
+/**
+ * \brief Partition a range around its first element, placing elements equal
+ * to the pivot on the left.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param temp              A vacant slot for one element.
+ *
+ * \returns the final index of the pivot.
+ */
+static size_t partition_left(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp)
+{
+    size_t size = options->element_size;
+    uint8_t* pivot = base;
+    uint8_t* first = base;
+    uint8_t* end = dynamic_array_elem(base, count, size);
+    uint8_t* last = end;
+
+    /* the pivot itself guards this scan. */
+    do
+    {
+        last -= size;
+    } while (dynamic_array_compare(options, pivot, last) < 0);
+
+    /* if no element was skipped above, then last guards this scan. */
+    if (last + size == end)
+    {
+        do
+        {
+            first += size;
+        } while (
+            first < last && dynamic_array_compare(options, pivot, first) >= 0);
+    }
+    else
+    {
+        do
+        {
+            first += size;
+        } while (dynamic_array_compare(options, pivot, first) >= 0);
+    }
+
+    while (first < last)
+    {
+        dynamic_array_swap_elements(options, first, last, temp);
+
+        do
+        {
+            last -= size;
+        } while (dynamic_array_compare(options, pivot, last) < 0);
+
+        do
+        {
+            first += size;
+        } while (dynamic_array_compare(options, pivot, first) >= 0);
+    }
+
+    dynamic_array_swap_elements(options, base, last, temp);
+
+    return (size_t)(last - base) / size;
+}
+
+/**
+ * \brief Swap a few elements at each end of a range with elements a quarter of
+ * the way in, so that the next pivot is chosen from different elements.
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param temp              A vacant slot for one element.
+ */
+static void shuffle(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp)
+{
+    size_t size = options->element_size;
+    size_t quarter = count / 4;
+
+    if (count < DYNAMIC_ARRAY_SORT_INSERTION_THRESHOLD)
+    {
+        return;
+    }
+
+    size_t pairs = count > NINTHER_THRESHOLD ? 3 : 1;
+    for (size_t i = 0; i < pairs; ++i)
+    {
+        dynamic_array_swap_elements(
+            options, dynamic_array_elem(base, i, size),
+            dynamic_array_elem(base, quarter + i, size), temp);
+        dynamic_array_swap_elements(
+            options, dynamic_array_elem(base, count - 1 - i, size),
+            dynamic_array_elem(base, count - 1 - quarter - i, size), temp);
+    }
+}
+
+/**
+ * \brief Heapsort a range.  This bounds the worst case at O(n log n).
+ *
+ * \param options           The dynamic array options.
+ * \param base              The first element of the range.
+ * \param count             The number of elements in the range.
+ * \param temp              A vacant slot for one element.
+ */
+static void heap_sort(
+    const dynamic_array_options_t* options, uint8_t* base, size_t count,
+    uint8_t* temp)
+{
+    size_t size = options->element_size;
+
+    /* build a max heap, then repeatedly move its root to the end. */
+    for (size_t i = count / 2, n = count; n > 1; )
+    {
+        if (i > 0)
+        {
+            --i;
+        }
+        else
+        {
+            --n;
+            dynamic_array_swap_elements(
+                options, base, dynamic_array_elem(base, n, size), temp);
+        }
+
+        /* sift element i down the heap of n elements. */
+        size_t parent = i;
+        for (;;)
+        {
+            size_t child = 2 * parent + 1;
+            if (child >= n)
+            {
+                break;
+            }
+
+            uint8_t* c = dynamic_array_elem(base, child, size);
+            if (
+                child + 1 < n
+             && dynamic_array_compare(options, c, c + size) < 0)
+            {
+                ++child;
+                c += size;
+            }
+
+            uint8_t* p = dynamic_array_elem(base, parent, size);
+            if (dynamic_array_compare(options, p, c) >= 0)
+            {
+                break;
+            }
+
+            dynamic_array_swap_elements(options, p, c, temp);
+            parent = child;
+        }
+    }
+}
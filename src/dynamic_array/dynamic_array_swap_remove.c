@@ -0,0 +1,49 @@
+/**
+ * \file dynamic_array_swap_remove.c
+ *
+ * Implementation of dynamic_array_swap_remove.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Remove an element from the dynamic array in constant time, by moving
+ * the last element into its place.
+ *
+ * This does not keep the order of the elements, so a sorted array may need to
+ * be sorted again.
+ *
+ * \param array             The array.
+ * \param index             The index of the element to remove.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX if the index is not that
+ *             of an element in the array.
+ */
+int dynamic_array_swap_remove(dynamic_array_t* array, size_t index)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+
+    if (index >= array->elements)
+    {
+        return VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX;
+    }
+
+    size_t last = array->elements - 1;
+
+    dynamic_array_dispose_range(array, index, 1);
+    if (index != last)
+    {
+        dynamic_array_move_range(array, index, last, 1);
+    }
+
+    array->elements = last;
+
+    return VPR_STATUS_SUCCESS;
+}
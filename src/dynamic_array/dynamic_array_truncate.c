@@ -0,0 +1,35 @@
+/**
+ * \file dynamic_array_truncate.c
+ *
+ * Implementation of dynamic_array_truncate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Shorten the dynamic array to the given number of elements.
+ *
+ * The elements past the new end are disposed.  If the array has no more than
+ * the given number of elements, then it is unchanged.  The reserve size of the
+ * array is unchanged; see dynamic_array_shrink_to_fit().
+ *
+ * \param array             The array.
+ * \param elements          The number of elements to keep.
+ */
+void dynamic_array_truncate(dynamic_array_t* array, size_t elements)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+
+    if (elements >= array->elements)
+    {
+        return;
+    }
+
+    dynamic_array_dispose_range(array, elements, array->elements - elements);
+    array->elements = elements;
+}
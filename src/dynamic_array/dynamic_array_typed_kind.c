@@ -0,0 +1,129 @@
+/**
+ * \file dynamic_array_typed_kind.c
+ *
+ * Implementation of dynamic_array_typed_kind, dynamic_array_method_kind, and
+ * dynamic_array_bytewise_equality.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <limits.h>
+#include <vpr/compare.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief A built-in comparison method, and the type that it compares.
+ */
+typedef struct typed_comparator
+{
+    compare_method_t compare;
+    size_t size;
+    int kind;
+} typed_comparator_t;
+
+/**
+ * \brief The built-in comparison methods that have typed kernels.
+ *
+ * compare_long_double() is absent, because the layout of long double varies
+ * between platforms.
+ */
+static const typed_comparator_t typed_comparators[] = {
+    { &compare_char, sizeof(char),
+        CHAR_MIN < 0
+            ? DYNAMIC_ARRAY_TYPED_KIND_SIGNED
+            : DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_unsigned_char, sizeof(unsigned char),
+        DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_short, sizeof(short), DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_unsigned_short, sizeof(unsigned short),
+        DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_int, sizeof(int), DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_unsigned_int, sizeof(unsigned int),
+        DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_long, sizeof(long), DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_unsigned_long, sizeof(unsigned long),
+        DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_long_long, sizeof(long long),
+        DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_unsigned_long_long, sizeof(unsigned long long),
+        DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_int8, sizeof(int8_t), DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_uint8, sizeof(uint8_t), DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_int16, sizeof(int16_t), DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_uint16, sizeof(uint16_t), DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_int32, sizeof(int32_t), DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_uint32, sizeof(uint32_t), DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_int64, sizeof(int64_t), DYNAMIC_ARRAY_TYPED_KIND_SIGNED },
+    { &compare_uint64, sizeof(uint64_t), DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_bool, sizeof(bool), DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED },
+    { &compare_float, sizeof(float), DYNAMIC_ARRAY_TYPED_KIND_FLOAT },
+    { &compare_double, sizeof(double), DYNAMIC_ARRAY_TYPED_KIND_FLOAT },
+};
+
+/**
+ * \brief Get the kind of value compared by the comparison method of the
+ * options, if it is a built-in one whose type matches the element size.
+ *
+ * \param options           The dynamic array options.
+ *
+ * \returns one of the DYNAMIC_ARRAY_TYPED_KIND_* values.
+ */
+int dynamic_array_typed_kind(const dynamic_array_options_t* options)
+{
+    MODEL_ASSERT(NULL != options);
+
+    return
+        dynamic_array_method_kind(
+            options->dynamic_array_element_compare, options->element_size);
+}
+
+/**
+ * \brief Get the kind of value compared by a comparison method, if it is a
+ * built-in one whose type matches the given size.
+ *
+ * \param compare           The comparison method.
+ * \param size              The size of the values compared.
+ *
+ * \returns one of the DYNAMIC_ARRAY_TYPED_KIND_* values.
+ */
+int dynamic_array_method_kind(compare_method_t compare, size_t size)
+{
+    for (size_t i = 0;
+         i < sizeof(typed_comparators) / sizeof(typed_comparators[0]); ++i)
+    {
+        if (
+            typed_comparators[i].compare == compare
+         && typed_comparators[i].size == size)
+        {
+            return typed_comparators[i].kind;
+        }
+    }
+
+    return DYNAMIC_ARRAY_TYPED_KIND_NONE;
+}
+
+/**
+ * \brief Determine whether two values compare as equal under a comparison
+ * method exactly when their bytes are identical.
+ *
+ * This holds for compare_bytes(), and for the built-in integer comparison
+ * methods.  It does not hold for floating point values, since 0.0 equals -0.0
+ * and a NaN equals nothing.
+ *
+ * \param compare           The comparison method.
+ * \param size              The size of the values compared.
+ *
+ * \returns true if equality under this method is bytewise equality.
+ */
+bool dynamic_array_bytewise_equality(compare_method_t compare, size_t size)
+{
+    int kind = dynamic_array_method_kind(compare, size);
+
+    return
+        &compare_bytes == compare
+     || DYNAMIC_ARRAY_TYPED_KIND_UNSIGNED == kind
+     || DYNAMIC_ARRAY_TYPED_KIND_SIGNED == kind;
+}
@@ -0,0 +1,81 @@
+/**
+ * \file dynamic_array_unique.c
+ *
+ * Implementation of dynamic_array_unique.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Remove duplicate elements from a sorted dynamic array, in place.
+ *
+ * The array must be sorted by its comparison method.  Of each run of elements
+ * which compare as equal, the first is kept and the rest are disposed.  Runs
+ * of duplicates are skipped with a galloping search, and the kept elements
+ * are moved down in runs, with a single memmove() per run when the elements
+ * are trivially copyable.  The reserve size of the array is unchanged.
+ *
+ * \param array             The sorted array.
+ */
+void dynamic_array_unique(dynamic_array_t* array)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(array->options->dynamic_array_element_compare != NULL);
+
+    const dynamic_array_options_t* options = array->options;
+    int kind = dynamic_array_typed_kind(options);
+    size_t size = options->element_size;
+    uint8_t* base = (uint8_t*)array->array;
+    size_t count = array->elements;
+    size_t write = 1;
+    size_t read = 1;
+
+    if (count < 2)
+    {
+        return;
+    }
+
+    while (read < count)
+    {
+        uint8_t* kept = dynamic_array_elem(base, write - 1, size);
+        uint8_t* next = dynamic_array_elem(base, read, size);
+
+        if (dynamic_array_compare(options, next, kept) == 0)
+        {
+            /* dispose the run of duplicates of the last kept element. */
+            size_t run =
+                1 + dynamic_array_gallop(
+                        options, kind, next + size, count - read - 1, kept,
+                        true);
+            dynamic_array_dispose_range(array, read, run);
+            read += run;
+            continue;
+        }
+
+        /* find the run of distinct elements, and move it down. */
+        size_t end = read + 1;
+        while (
+            end < count
+         && dynamic_array_compare(
+                options, dynamic_array_elem(base, end, size),
+                dynamic_array_elem(base, end - 1, size)) != 0)
+        {
+            ++end;
+        }
+
+        if (write != read)
+        {
+            dynamic_array_move_range(array, write, read, end - read);
+        }
+
+        write += end - read;
+        read = end;
+    }
+
+    array->elements = write;
+}
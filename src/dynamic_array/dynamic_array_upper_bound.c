@@ -0,0 +1,39 @@
+/**
+ * \file dynamic_array_upper_bound.c
+ *
+ * Implementation of dynamic_array_upper_bound.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "dynamic_array_internal.h"
+
+/**
+ * \brief Find the index of the first element in this sorted array which is
+ * greater than the given key.
+ *
+ * The array must be sorted by its comparison method.  This search has a
+ * worst-case performance of O(log n).  Together with
+ * dynamic_array_lower_bound(), it bounds the range of elements matching a key,
+ * or the range of elements between two keys.
+ *
+ * \param array             The array to be searched.
+ * \param elem              The element to use for searching.
+ *
+ * \returns the index of the first element greater than the key, or
+ *          array->elements if there is none.
+ */
+size_t dynamic_array_upper_bound(
+    const dynamic_array_t* array, const void* elem)
+{
+    MODEL_ASSERT(prop_dynamic_array_valid(array));
+    MODEL_ASSERT(NULL != elem);
+
+    return
+        dynamic_array_bound(
+            array->options, dynamic_array_typed_kind(array->options),
+            (const uint8_t*)array->array, array->elements, elem, true);
+}
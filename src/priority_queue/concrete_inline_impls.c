@@ -0,0 +1,12 @@
+/**
+ * \file priority_queue/concrete_inline_impls.c
+ *
+ * \brief Provide concrete implementations for inline functions for debug-time
+ * linkage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#define VPR_PRIORITY_QUEUE_CONCRETE_IMPLEMENTATION
+
+#include <vpr/priority_queue.h>
@@ -0,0 +1,44 @@
+/**
+ * \file priority_queue_descend.c
+ *
+ * Implementation of priority_queue_descend.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Move a hole in the heap down to a leaf, by moving the least child
+ * of the hole up into it at each level.
+ *
+ * This takes one comparison per child at each level, against the two per
+ * child taken by priority_queue_sift_down(), and the element which then fills
+ * the hole usually belongs near the bottom of the heap.
+ *
+ * \param queue             The priority queue.
+ * \param hole              The index of the hole.
+ *
+ * \returns the index of the leaf which is now the hole.
+ */
+size_t priority_queue_descend(priority_queue_t* queue, size_t hole)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+    MODEL_ASSERT(hole < queue->array.elements);
+
+    size_t parents = priority_queue_parents(queue);
+
+    while (hole < parents)
+    {
+        size_t child = priority_queue_least_child(queue, hole);
+        priority_queue_move(
+            queue, priority_queue_elem(queue, hole),
+            priority_queue_elem(queue, child));
+        hole = child;
+    }
+
+    return hole;
+}
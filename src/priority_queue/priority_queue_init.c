@@ -0,0 +1,67 @@
+/**
+ * \file priority_queue_init.c
+ *
+ * Implementation of priority_queue_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Initialize an empty priority queue.
+ *
+ * The queue can hold the given number of elements; beyond that, pushing an
+ * element grows the queue by the growth factor of the options, and fails if
+ * there is none.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::priority_queue_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.
+ *
+ * \param options           The dynamic array options to use for this queue.
+ * \param queue             The priority queue to initialize.
+ * \param arity             The number of children of each element, which must
+ *                          be at least 2, or 0 for
+ *                          \ref PRIORITY_QUEUE_DEFAULT_ARITY.
+ * \param reserve           The reserve size for this queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY if the arity is 1.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED if memory could not
+ *             be allocated for the queue.
+ */
+int priority_queue_init(
+    dynamic_array_options_t* options, priority_queue_t* queue, size_t arity,
+    size_t reserve)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != options->dynamic_array_element_compare);
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(reserve > 0);
+
+    if (1 == arity)
+    {
+        return VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY;
+    }
+
+    if (
+        VPR_STATUS_SUCCESS
+            != dynamic_array_init(options, &queue->array, reserve, 0, NULL))
+    {
+        return VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED;
+    }
+
+    int retval = priority_queue_init_common(queue, arity);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        dispose(dynamic_array_disposable_handle(&queue->array));
+        return retval;
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/**
+ * \file priority_queue_init_common.c
+ *
+ * Implementation of the initialization shared by priority_queue_init and
+ * priority_queue_init_from_array.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/* forward decls for internal methods */
+static void priority_queue_dispose(void* pqueue);
+
+/**
+ * \brief Initialize the parts of a priority queue other than its array.
+ *
+ * \param queue             The priority queue, whose array is initialized.
+ * \param arity             The number of children of each element, or 0.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY if the arity is 1.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED if memory could not
+ *             be allocated for the queue.
+ */
+int priority_queue_init_common(priority_queue_t* queue, size_t arity)
+{
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(NULL != queue->array.options);
+
+    if (0 == arity)
+    {
+        arity = PRIORITY_QUEUE_DEFAULT_ARITY;
+    }
+
+    if (arity < 2)
+    {
+        return VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY;
+    }
+
+    queue->temp =
+        (uint8_t*)allocate(
+            queue->array.options->alloc_opts,
+            queue->array.options->element_size);
+    if (NULL == queue->temp)
+    {
+        return VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED;
+    }
+
+    queue->hdr.dispose = &priority_queue_dispose;
+    queue->arity = arity;
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a priority queue.
+ *
+ * \param pqueue        An opaque pointer to the priority queue.
+ */
+static void priority_queue_dispose(void* pqueue)
+{
+    MODEL_ASSERT(NULL != pqueue);
+
+    priority_queue_t* queue = (priority_queue_t*)pqueue;
+
+    release(queue->array.options->alloc_opts, queue->temp);
+    dispose(dynamic_array_disposable_handle(&queue->array));
+}
@@ -0,0 +1,69 @@
+/**
+ * \file priority_queue_init_from_array.c
+ *
+ * Implementation of priority_queue_init_from_array.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Initialize a priority queue from the elements of a dynamic array.
+ *
+ * The elements are arranged into a heap in place, in O(n) time.  On success,
+ * the queue takes over the array, which must no longer be used or disposed by
+ * the caller; on failure, the array is unchanged and still owned by the
+ * caller.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::priority_queue_t instance and must dispose of it by calling dispose() when
+ * it is no longer needed.
+ *
+ * \param queue             The priority queue to initialize.
+ * \param array             The array whose elements fill the queue.
+ * \param arity             The number of children of each element, which must
+ *                          be at least 2, or 0 for
+ *                          \ref PRIORITY_QUEUE_DEFAULT_ARITY.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY if the arity is 1.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED if memory could not
+ *             be allocated for the queue.
+ */
+int priority_queue_init_from_array(
+    priority_queue_t* queue, dynamic_array_t* array, size_t arity)
+{
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(NULL != array);
+    MODEL_ASSERT(NULL != array->options);
+    MODEL_ASSERT(NULL != array->options->dynamic_array_element_compare);
+
+    /* the array structure is taken over by moving it into the queue. */
+    queue->array = *array;
+
+    int retval = priority_queue_init_common(queue, arity);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* sift down each parent, from the last to the root, so that each one
+     * becomes the root of a heap. */
+    size_t count = queue->array.elements;
+    if (count > 1)
+    {
+        for (size_t parent = (count - 2) / queue->arity + 1; parent-- > 0;)
+        {
+            priority_queue_move(
+                queue, queue->temp, priority_queue_elem(queue, parent));
+            priority_queue_sift_down(queue, parent);
+        }
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,158 @@
+/**
+ * \file priority_queue_internal.h
+ *
+ * \brief Internal helpers shared by the priority queue implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VPR_PRIORITY_QUEUE_INTERNAL_HEADER_GUARD
+#define VPR_PRIORITY_QUEUE_INTERNAL_HEADER_GUARD
+
+#include <string.h>
+#include <vpr/priority_queue.h>
+
+/**
+ * \brief Get the address of an element of a priority queue.
+ *
+ * \param queue             The priority queue.
+ * \param index             The index of the element.
+ *
+ * \returns the address of the element.
+ */
+static inline uint8_t* priority_queue_elem(
+    const priority_queue_t* queue, size_t index)
+{
+    return
+        (uint8_t*)queue->array.array
+      + index * queue->array.options->element_size;
+}
+
+/**
+ * \brief Move an element of a priority queue into a vacant slot.
+ *
+ * Trivially copyable elements are moved by their bytes; otherwise, the element
+ * is copied with the copy method and then disposed.
+ *
+ * \param queue             The priority queue.
+ * \param dst               The vacant slot.
+ * \param src               The element to move, which is left vacant.
+ */
+static inline void priority_queue_move(
+    const priority_queue_t* queue, void* dst, const void* src)
+{
+    const dynamic_array_options_t* options = queue->array.options;
+
+    if (options->trivially_copyable)
+    {
+        memcpy(dst, src, options->element_size);
+    }
+    else
+    {
+        options->dynamic_array_element_copy(
+            options->context, dst, src, options->element_size);
+        options->dynamic_array_element_dispose(
+            options->context, (void*)src);
+    }
+}
+
+/**
+ * \brief Get the number of elements of a priority queue which have children.
+ *
+ * \param queue             The priority queue, which is not empty.
+ *
+ * \returns the number of elements with children, which are the first
+ *          elements of the heap.
+ */
+static inline size_t priority_queue_parents(const priority_queue_t* queue)
+{
+    return (queue->array.elements - 2 + queue->arity) / queue->arity;
+}
+
+/**
+ * \brief Find the least of the children of an element.
+ *
+ * \param queue             The priority queue.
+ * \param parent            The index of an element which has children.
+ *
+ * \returns the index of the least child.
+ */
+static inline size_t priority_queue_least_child(
+    const priority_queue_t* queue, size_t parent)
+{
+    size_t size = queue->array.options->element_size;
+    compare_method_t compare =
+        queue->array.options->dynamic_array_element_compare;
+
+    size_t first = parent * queue->arity + 1;
+    size_t count = queue->array.elements;
+    size_t last = count - first < queue->arity ? count : first + queue->arity;
+    size_t least = first;
+    uint8_t* least_elem = priority_queue_elem(queue, first);
+    for (size_t child = first + 1; child < last; ++child)
+    {
+        uint8_t* child_elem = priority_queue_elem(queue, child);
+        if (compare(child_elem, least_elem, size) < 0)
+        {
+            least = child;
+            least_elem = child_elem;
+        }
+    }
+
+    return least;
+}
+
+/**
+ * \brief Initialize the parts of a priority queue other than its array.
+ *
+ * \param queue             The priority queue, whose array is initialized.
+ * \param arity             The number of children of each element, or 0.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY if the arity is 1.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_ALLOCATION_FAILED if memory could not
+ *             be allocated for the queue.
+ */
+int priority_queue_init_common(priority_queue_t* queue, size_t arity);
+
+/**
+ * \brief Move the element in the temporary buffer up from a hole in the heap
+ * to its place.
+ *
+ * Each parent greater than the element is moved down into the hole, until the
+ * element can be placed in it.
+ *
+ * \param queue             The priority queue.
+ * \param hole              The index of the hole.
+ */
+void priority_queue_sift_up(priority_queue_t* queue, size_t hole);
+
+/**
+ * \brief Move the element in the temporary buffer down from a hole in the
+ * heap to its place.
+ *
+ * The least child of the hole is moved up into it while that child is less
+ * than the element, and then the element is placed in the hole.
+ *
+ * \param queue             The priority queue.
+ * \param hole              The index of the hole.
+ */
+void priority_queue_sift_down(priority_queue_t* queue, size_t hole);
+
+/**
+ * \brief Move a hole in the heap down to a leaf, by moving the least child
+ * of the hole up into it at each level.
+ *
+ * This takes one comparison per child at each level, against the two per
+ * child taken by priority_queue_sift_down(), and the element which then fills
+ * the hole usually belongs near the bottom of the heap.
+ *
+ * \param queue             The priority queue.
+ * \param hole              The index of the hole.
+ *
+ * \returns the index of the leaf which is now the hole.
+ */
+size_t priority_queue_descend(priority_queue_t* queue, size_t hole);
+
+#endif  //VPR_PRIORITY_QUEUE_INTERNAL_HEADER_GUARD
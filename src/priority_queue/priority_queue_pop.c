@@ -0,0 +1,60 @@
+/**
+ * \file priority_queue_pop.c
+ *
+ * Implementation of priority_queue_pop.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Remove the least element of a priority queue.
+ *
+ * If an output element is given, the removed element is moved there, as
+ * elements are moved within the queue, and the caller takes ownership of it;
+ * otherwise, it is disposed.
+ *
+ * \param queue             The priority queue.
+ * \param element           Set to the removed element, or NULL.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_EMPTY if the queue is empty.
+ */
+int priority_queue_pop(priority_queue_t* queue, void* element)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+
+    dynamic_array_options_t* options = queue->array.options;
+
+    if (0 == queue->array.elements)
+    {
+        return VPR_ERROR_PRIORITY_QUEUE_EMPTY;
+    }
+
+    uint8_t* top = priority_queue_elem(queue, 0);
+    if (NULL != element)
+    {
+        priority_queue_move(queue, element, top);
+    }
+    else if (!options->trivially_copyable)
+    {
+        options->dynamic_array_element_dispose(options->context, top);
+    }
+
+    /* the last element fills the hole left by the top; the hole is moved to
+     * a leaf first, since that is where the last element usually belongs. */
+    size_t last = --queue->array.elements;
+    if (last > 0)
+    {
+        priority_queue_move(
+            queue, queue->temp, priority_queue_elem(queue, last));
+        priority_queue_sift_up(queue, priority_queue_descend(queue, 0));
+    }
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,43 @@
+/**
+ * \file priority_queue_push.c
+ *
+ * Implementation of priority_queue_push.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Push a copy of an element onto a priority queue.
+ *
+ * \param queue             The priority queue.
+ * \param element           The element to copy into the queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - a non-zero error code from dynamic_array_append() if the queue is
+ *        full and could not grow, in which case the queue is unchanged.
+ */
+int priority_queue_push(priority_queue_t* queue, const void* element)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+    MODEL_ASSERT(NULL != element);
+
+    /* the element is only read, although append does not say so. */
+    int retval = dynamic_array_append(&queue->array, (void*)element);
+    if (VPR_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* lift the new element from the end of the heap to its place. */
+    size_t last = queue->array.elements - 1;
+    priority_queue_move(queue, queue->temp, priority_queue_elem(queue, last));
+    priority_queue_sift_up(queue, last);
+
+    return VPR_STATUS_SUCCESS;
+}
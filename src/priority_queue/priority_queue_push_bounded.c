@@ -0,0 +1,62 @@
+/**
+ * \file priority_queue_push_bounded.c
+ *
+ * Implementation of priority_queue_push_bounded.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Push a copy of an element onto a priority queue which keeps only the
+ * greatest elements pushed onto it.
+ *
+ * While the queue holds fewer than limit elements, the element is pushed as by
+ * priority_queue_push().  Once the queue is full, the element replaces the
+ * least element of the queue if it is greater, and is otherwise ignored.  The
+ * queue then holds the greatest limit elements of a stream of n elements,
+ * found in O(n log limit) time and O(limit) space, and popping them returns
+ * them in ascending order.  The least elements of a stream are kept with a
+ * comparison method which reverses the order.
+ *
+ * \param queue             The priority queue.
+ * \param element           The element to copy into the queue.
+ * \param limit             The greatest number of elements to keep, which must
+ *                          be at least 1.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful, whether or not the element was
+ *             kept.
+ *      - a non-zero error code from dynamic_array_append() if the queue is
+ *        not yet full but could not grow, in which case the queue is
+ *        unchanged.
+ */
+int priority_queue_push_bounded(
+    priority_queue_t* queue, const void* element, size_t limit)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+    MODEL_ASSERT(NULL != element);
+    MODEL_ASSERT(limit > 0);
+
+    dynamic_array_options_t* options = queue->array.options;
+
+    if (queue->array.elements < limit)
+    {
+        return priority_queue_push(queue, element);
+    }
+
+    /* a full queue only takes elements greater than its least element. */
+    if (
+        options->dynamic_array_element_compare(
+            element, priority_queue_elem(queue, 0), options->element_size)
+            <= 0)
+    {
+        return VPR_STATUS_SUCCESS;
+    }
+
+    return priority_queue_replace_top(queue, element);
+}
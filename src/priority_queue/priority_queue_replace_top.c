@@ -0,0 +1,58 @@
+/**
+ * \file priority_queue_replace_top.c
+ *
+ * Implementation of priority_queue_replace_top.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Replace the least element of a priority queue with a copy of another
+ * element.
+ *
+ * This is equivalent to popping and then pushing, but restores the heap only
+ * once, which suits keeping the greatest k of a stream of elements in a queue
+ * of size k.  The replaced element is disposed.
+ *
+ * \param queue             The priority queue.
+ * \param element           The element to copy into the queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_PRIORITY_QUEUE_EMPTY if the queue is empty.
+ */
+int priority_queue_replace_top(priority_queue_t* queue, const void* element)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+    MODEL_ASSERT(NULL != element);
+
+    dynamic_array_options_t* options = queue->array.options;
+    size_t size = options->element_size;
+
+    if (0 == queue->array.elements)
+    {
+        return VPR_ERROR_PRIORITY_QUEUE_EMPTY;
+    }
+
+    /* copy the new element aside, then sink it from the top to its place. */
+    if (options->trivially_copyable)
+    {
+        memcpy(queue->temp, element, size);
+    }
+    else
+    {
+        options->dynamic_array_element_dispose(
+            options->context, priority_queue_elem(queue, 0));
+        options->dynamic_array_element_copy(
+            options->context, queue->temp, element, size);
+    }
+
+    priority_queue_sift_down(queue, 0);
+
+    return VPR_STATUS_SUCCESS;
+}
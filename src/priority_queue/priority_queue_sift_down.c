@@ -0,0 +1,49 @@
+/**
+ * \file priority_queue_sift_down.c
+ *
+ * Implementation of priority_queue_sift_down.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Move the element in the temporary buffer down from a hole in the
+ * heap to its place.
+ *
+ * The least child of the hole is moved up into it while that child is less
+ * than the element, and then the element is placed in the hole.
+ *
+ * \param queue             The priority queue.
+ * \param hole              The index of the hole.
+ */
+void priority_queue_sift_down(priority_queue_t* queue, size_t hole)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+    MODEL_ASSERT(hole < queue->array.elements);
+
+    size_t parents = priority_queue_parents(queue);
+    size_t size = queue->array.options->element_size;
+    compare_method_t compare =
+        queue->array.options->dynamic_array_element_compare;
+
+    while (hole < parents)
+    {
+        size_t child = priority_queue_least_child(queue, hole);
+        uint8_t* child_elem = priority_queue_elem(queue, child);
+        if (compare(child_elem, queue->temp, size) >= 0)
+        {
+            break;
+        }
+
+        priority_queue_move(
+            queue, priority_queue_elem(queue, hole), child_elem);
+        hole = child;
+    }
+
+    priority_queue_move(queue, priority_queue_elem(queue, hole), queue->temp);
+}
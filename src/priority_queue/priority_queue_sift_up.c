@@ -0,0 +1,48 @@
+/**
+ * \file priority_queue_sift_up.c
+ *
+ * Implementation of priority_queue_sift_up.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "priority_queue_internal.h"
+
+/**
+ * \brief Move the element in the temporary buffer up from a hole in the heap
+ * to its place.
+ *
+ * Each parent greater than the element is moved down into the hole, until the
+ * element can be placed in it.
+ *
+ * \param queue             The priority queue.
+ * \param hole              The index of the hole.
+ */
+void priority_queue_sift_up(priority_queue_t* queue, size_t hole)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_PRIORITY_QUEUE(queue));
+    MODEL_ASSERT(hole < queue->array.elements);
+
+    size_t size = queue->array.options->element_size;
+    compare_method_t compare =
+        queue->array.options->dynamic_array_element_compare;
+
+    while (hole > 0)
+    {
+        size_t parent = (hole - 1) / queue->arity;
+        uint8_t* parent_elem = priority_queue_elem(queue, parent);
+        if (compare(queue->temp, parent_elem, size) >= 0)
+        {
+            break;
+        }
+
+        priority_queue_move(
+            queue, priority_queue_elem(queue, hole), parent_elem);
+        hole = parent;
+    }
+
+    priority_queue_move(queue, priority_queue_elem(queue, hole), queue->temp);
+}
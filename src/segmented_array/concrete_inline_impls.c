@@ -0,0 +1,12 @@
+/**
+ * \file segmented_array/concrete_inline_impls.c
+ *
+ * \brief Provide concrete implementations for inline functions for debug-time
+ * linkage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#define VPR_SEGMENTED_ARRAY_CONCRETE_IMPLEMENTATION
+
+#include <vpr/segmented_array.h>
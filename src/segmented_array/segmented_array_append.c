@@ -0,0 +1,83 @@
+/**
+ * \file segmented_array_append.c
+ *
+ * Implementation of segmented_array_append.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+#include <vpr/segmented_array.h>
+
+/**
+ * \brief Append an element to the end of the segmented array.
+ *
+ * The element is copied into place with the copy method of the options, or
+ * with memcpy() if the elements are trivially copyable.  If the last segment
+ * is full, a new segment is allocated first; no existing element is moved.
+ *
+ * \param array             The array.
+ * \param element           The element to append to this array.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for a new segment, or for a larger directory.
+ */
+int segmented_array_append(segmented_array_t* array, const void* element)
+{
+    MODEL_ASSERT(MODEL_PROP_VALID_SEGMENTED_ARRAY(array));
+    MODEL_ASSERT(NULL != element);
+
+    dynamic_array_options_t* options = array->options;
+    size_t size = options->element_size;
+    size_t segment = array->elements >> array->segment_shift;
+    size_t offset = array->elements & (((size_t)1 << array->segment_shift) - 1);
+
+    if (segment == array->segments)
+    {
+        /* the directory holds only pointers, so it is moved as POD. */
+        if (array->segments == array->directory_size)
+        {
+            uint8_t** directory =
+                (uint8_t**)reallocate(
+                    options->alloc_opts, array->directory,
+                    array->directory_size * sizeof(uint8_t*),
+                    2 * array->directory_size * sizeof(uint8_t*));
+            if (NULL == directory)
+            {
+                return VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED;
+            }
+
+            array->directory = directory;
+            array->directory_size *= 2;
+        }
+
+        uint8_t* elements =
+            (uint8_t*)allocate(
+                options->alloc_opts, size << array->segment_shift);
+        if (NULL == elements)
+        {
+            return VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED;
+        }
+
+        array->directory[array->segments++] = elements;
+    }
+
+    uint8_t* slot = array->directory[segment] + offset * size;
+    if (options->trivially_copyable)
+    {
+        memcpy(slot, element, size);
+    }
+    else
+    {
+        options->dynamic_array_element_copy(
+            options->context, slot, element, size);
+    }
+
+    ++array->elements;
+
+    return VPR_STATUS_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/**
+ * \file segmented_array_init.c
+ *
+ * Implementation of segmented_array_init.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+#include <vpr/segmented_array.h>
+
+/**
+ * \brief The number of segment pointers in a new directory.
+ */
+#define SEGMENTED_ARRAY_INITIAL_DIRECTORY_SIZE 8
+
+/* forward decls for internal methods */
+static void segmented_array_dispose(void* parray);
+
+/**
+ * \brief Initialize a segmented array.
+ *
+ * The array starts out empty.  The number of elements per segment must be a
+ * power of two; if it is 0, then each segment holds as many elements as fit
+ * in \ref SEGMENTED_ARRAY_DEFAULT_SEGMENT_SIZE bytes, rounded down to a power
+ * of two, and at least one.
+ *
+ * When the function completes successfully, the caller owns this
+ * ::segmented_array_t instance and must dispose of it by calling dispose()
+ * when it is no longer needed.
+ *
+ * \param options           The dynamic array options to use for this array.
+ * \param array             The segmented array to initialize.
+ * \param segment_elements  The number of elements per segment, or 0.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VPR_STATUS_SUCCESS if successful.
+ *      - \ref VPR_ERROR_SEGMENTED_ARRAY_INVALID_SEGMENT_SIZE if the number of
+ *             elements per segment is not a power of two.
+ *      - \ref VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED if memory could not
+ *             be allocated for the directory.
+ */
+int segmented_array_init(
+    dynamic_array_options_t* options, segmented_array_t* array,
+    size_t segment_elements)
+{
+    MODEL_ASSERT(prop_dynamic_array_options_valid(options));
+    MODEL_ASSERT(NULL != array);
+
+    /* by default, fill a segment of the default size. */
+    if (0 == segment_elements)
+    {
+        segment_elements = 1;
+        while (
+            segment_elements * 2 * options->element_size
+                <= SEGMENTED_ARRAY_DEFAULT_SEGMENT_SIZE)
+        {
+            segment_elements *= 2;
+        }
+    }
+
+    if (0 != (segment_elements & (segment_elements - 1)))
+    {
+        return VPR_ERROR_SEGMENTED_ARRAY_INVALID_SEGMENT_SIZE;
+    }
+
+    unsigned int shift = 0;
+    while (((size_t)1 << shift) < segment_elements)
+    {
+        ++shift;
+    }
+
+    array->directory =
+        (uint8_t**)allocate(
+            options->alloc_opts,
+            SEGMENTED_ARRAY_INITIAL_DIRECTORY_SIZE * sizeof(uint8_t*));
+    if (NULL == array->directory)
+    {
+        return VPR_ERROR_SEGMENTED_ARRAY_ALLOCATION_FAILED;
+    }
+
+    array->hdr.dispose = &segmented_array_dispose;
+    array->options = options;
+    array->segment_shift = shift;
+    array->elements = 0;
+    array->segments = 0;
+    array->directory_size = SEGMENTED_ARRAY_INITIAL_DIRECTORY_SIZE;
+
+    return VPR_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a segmented array.
+ *
+ * \param parray        An opaque pointer to the segmented array.
+ */
+static void segmented_array_dispose(void* parray)
+{
+    MODEL_ASSERT(NULL != parray);
+
+    segmented_array_t* array = (segmented_array_t*)parray;
+    dynamic_array_options_t* options = array->options;
+
+    /* dispose each element, unless there is nothing to do. */
+    if (!options->trivially_copyable)
+    {
+        size_t mask = ((size_t)1 << array->segment_shift) - 1;
+        for (size_t i = 0; i < array->elements; ++i)
+        {
+            options->dynamic_array_element_dispose(
+                options->context,
+                array->directory[i >> array->segment_shift]
+                    + (i & mask) * options->element_size);
+        }
+    }
+
+    for (size_t s = 0; s < array->segments; ++s)
+    {
+        release(options->alloc_opts, array->directory[s]);
+    }
+
+    release(options->alloc_opts, array->directory);
+}
@@ -0,0 +1,345 @@
+/**
+ * \file test_binary_fuse_filter.cpp
+ *
+ * Unit tests for binary_fuse_filter.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/binary_fuse_filter.h>
+#include <vpr/compare.h>
+
+class binary_fuse_filter_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        keys_options_init_status =
+            dynamic_array_options_init(
+                &keys_options, &alloc_opts, sizeof(uint64_t),
+                &compare_uint64);
+
+        uint64_t zero = 0;
+        keys_init_status =
+            dynamic_array_init(&keys_options, &keys, 10000, 0, &zero);
+        if (VPR_STATUS_SUCCESS == keys_init_status)
+        {
+            for (uint64_t i = 0; i < 10000; ++i)
+            {
+                uint64_t key = key_hash(i);
+                keys_append_status = dynamic_array_append(&keys, &key);
+            }
+        }
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == keys_init_status)
+        {
+            dispose(dynamic_array_disposable_handle(&keys));
+        }
+        if (VPR_STATUS_SUCCESS == keys_options_init_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&keys_options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * A stand-in for a caller's key hash function.
+     */
+    static uint64_t key_hash(uint64_t i)
+    {
+        return (i + 1) * UINT64_C(0x9e3779b97f4a7c15);
+    }
+
+    /**
+     * Count the false positives among 100000 keys which are not in the set.
+     */
+    static int false_positives(binary_fuse_filter_t* filter)
+    {
+        int count = 0;
+        for (uint64_t i = 10000; i < 110000; ++i)
+        {
+            count += binary_fuse_filter_contains_hash(filter, key_hash(i));
+        }
+
+        return count;
+    }
+
+    int keys_options_init_status;
+    int keys_init_status;
+    int keys_append_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t keys_options;
+    dynamic_array_t keys;
+};
+
+TEST_SUITE(binary_fuse_filter_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    binary_fuse_filter_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the fingerprint size follows the target error rate.
+ */
+BEGIN_TEST_F(options_init_test)
+    binary_fuse_filter_options_t options;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_options_init(
+                    &options, &fixture.alloc_opts, 0.01));
+    TEST_EXPECT(1U == options.fingerprint_size);
+    TEST_EXPECT(&sdbm == options.hash_function);
+    dispose(binary_fuse_filter_options_disposable_handle(&options));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_options_init_ex(
+                    &options, &fixture.alloc_opts, 0.001, NULL));
+    TEST_EXPECT(2U == options.fingerprint_size);
+    TEST_EXPECT(NULL == options.hash_function);
+    dispose(binary_fuse_filter_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * Test that a filter built from key hashes contains every key, with the
+ * expected false positive rate.
+ */
+BEGIN_TEST_F(build_from_hashes_test)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.keys_init_status);
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.keys_append_status);
+
+    for (float rate : { 0.01f, 0.0001f })
+    {
+        binary_fuse_filter_options_t options;
+        binary_fuse_filter_t filter;
+
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == binary_fuse_filter_options_init_ex(
+                        &options, &fixture.alloc_opts, rate, NULL));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == binary_fuse_filter_init(&options, &filter, &fixture.keys));
+
+        TEST_EXPECT(10000U == filter.num_entries);
+
+        /* the space overhead falls towards 1.125 fingerprints per entry as the
+         * number of entries grows, and is 1.25 for 10000 entries. */
+        TEST_EXPECT(filter.array_length < 13000U);
+
+        bool all_found = true;
+        for (uint64_t i = 0; i < 10000; ++i)
+        {
+            uint64_t key = binary_fuse_filter_test::key_hash(i);
+            all_found = all_found
+                && binary_fuse_filter_contains_hash(&filter, key)
+                && binary_fuse_filter_contains_item(
+                        &filter, &key, sizeof(key));
+        }
+        TEST_EXPECT(all_found);
+
+        /* 2^-8 is 0.39%, and 2^-16 is 0.0015%. */
+        int fp = binary_fuse_filter_test::false_positives(&filter);
+        if (1 == options.fingerprint_size)
+        {
+            TEST_EXPECT(fp > 200 && fp < 600);
+        }
+        else
+        {
+            TEST_EXPECT(fp < 10);
+        }
+
+        dispose(binary_fuse_filter_disposable_handle(&filter));
+        dispose(binary_fuse_filter_options_disposable_handle(&options));
+    }
+END_TEST_F()
+
+/**
+ * Test that keys are hashed with the hash function in the options, and that
+ * duplicate keys are allowed.
+ */
+BEGIN_TEST_F(build_from_keys_test)
+    dynamic_array_options_t names_options;
+    dynamic_array_t names;
+    char name[16] = { 0 };
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &names_options, &fixture.alloc_opts, sizeof(name),
+                    &compare_uint8));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&names_options, &names, 2000, 0, name));
+    for (int i = 0; i < 2000; ++i)
+    {
+        memset(name, 0, sizeof(name));
+        snprintf(name, sizeof(name), "item %d", i % 1000);
+        TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&names, name));
+    }
+
+    binary_fuse_filter_options_t options;
+    binary_fuse_filter_t filter;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_options_init(
+                    &options, &fixture.alloc_opts, 0.01));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_init(&options, &filter, &names));
+
+    TEST_EXPECT(1000U == filter.num_entries);
+
+    bool all_found = true;
+    int fp = 0;
+    for (int i = 0; i < 2000; ++i)
+    {
+        memset(name, 0, sizeof(name));
+        snprintf(name, sizeof(name), "item %d", i);
+        bool found =
+            binary_fuse_filter_contains_item(&filter, name, sizeof(name));
+        if (i < 1000)
+        {
+            all_found = all_found && found;
+        }
+        else
+        {
+            fp += found;
+        }
+    }
+    TEST_EXPECT(all_found);
+    TEST_EXPECT(fp < 20);
+
+    dispose(binary_fuse_filter_disposable_handle(&filter));
+    dispose(binary_fuse_filter_options_disposable_handle(&options));
+    dispose(dynamic_array_disposable_handle(&names));
+    dispose(dynamic_array_options_disposable_handle(&names_options));
+END_TEST_F()
+
+/**
+ * Test that filters with no entries or a single entry can be built.
+ */
+BEGIN_TEST_F(tiny_test)
+    binary_fuse_filter_options_t options;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_options_init_ex(
+                    &options, &fixture.alloc_opts, 0.0001, NULL));
+
+    dynamic_array_t small;
+    uint64_t key = binary_fuse_filter_test::key_hash(0);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&fixture.keys_options, &small, 2, 0, &key));
+
+    for (int i = 0; i < 2; ++i)
+    {
+        binary_fuse_filter_t filter;
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == binary_fuse_filter_init(&options, &filter, &small));
+        TEST_EXPECT((size_t)i == filter.num_entries);
+        TEST_EXPECT(
+            (1 == i) == binary_fuse_filter_contains_hash(&filter, key));
+        dispose(binary_fuse_filter_disposable_handle(&filter));
+
+        TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&small, &key));
+    }
+
+    dispose(dynamic_array_disposable_handle(&small));
+    dispose(binary_fuse_filter_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * Test that a serialized filter can be loaded from a buffer and from a mapped
+ * file, and answers exactly as the original.
+ */
+BEGIN_TEST_F(serialize_test)
+    binary_fuse_filter_options_t options;
+    binary_fuse_filter_t filter;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_options_init_ex(
+                    &options, &fixture.alloc_opts, 0.001, NULL));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_init(&options, &filter, &fixture.keys));
+
+    size_t size = binary_fuse_filter_serialized_size(&filter);
+    TEST_EXPECT(
+        BINARY_FUSE_FILTER_SERIALIZED_HEADER_SIZE + 2 * filter.array_length
+            <= size);
+    TEST_EXPECT(0U == size % 8);
+
+    std::vector<uint64_t> buffer(size / 8);
+    TEST_EXPECT(
+        VPR_ERROR_BINARY_FUSE_FILTER_SERIALIZE_BUFFER_TOO_SMALL
+            == binary_fuse_filter_serialize(&filter, buffer.data(), size - 1));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_serialize(&filter, buffer.data(), size));
+
+    binary_fuse_filter_options_t loaded_options;
+    binary_fuse_filter_t loaded;
+    TEST_EXPECT(
+        VPR_ERROR_BINARY_FUSE_FILTER_INVALID_FORMAT
+            == binary_fuse_filter_init_from_buffer(
+                    &loaded_options, &loaded, &fixture.alloc_opts,
+                    buffer.data(), size - 8));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_init_from_buffer(
+                    &loaded_options, &loaded, &fixture.alloc_opts,
+                    buffer.data(), size));
+    TEST_EXPECT(NULL == loaded_options.hash_function);
+    TEST_EXPECT(filter.num_entries == loaded.num_entries);
+
+    char path[] = "/tmp/test_binary_fuse_filter_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    close(fd);
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == binary_fuse_filter_save(&filter, path));
+
+    binary_fuse_filter_mapped_t mapped;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == binary_fuse_filter_mapped_init(
+                    &mapped, &fixture.alloc_opts, path));
+    TEST_EXPECT(size == mapped.map_size);
+
+    bool same = true;
+    for (uint64_t i = 0; i < 20000; ++i)
+    {
+        uint64_t key = binary_fuse_filter_test::key_hash(i);
+        bool expected = binary_fuse_filter_contains_hash(&filter, key);
+        same = same
+            && expected == binary_fuse_filter_contains_hash(&loaded, key)
+            && expected
+                == binary_fuse_filter_contains_hash(&mapped.filter, key);
+    }
+    TEST_EXPECT(same);
+
+    dispose(binary_fuse_filter_mapped_disposable_handle(&mapped));
+    unlink(path);
+    dispose(binary_fuse_filter_disposable_handle(&loaded));
+    dispose(binary_fuse_filter_options_disposable_handle(&loaded_options));
+    dispose(binary_fuse_filter_disposable_handle(&filter));
+    dispose(binary_fuse_filter_options_disposable_handle(&options));
+END_TEST_F()
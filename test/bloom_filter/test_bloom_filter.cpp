@@ -232,6 +232,59 @@ BEGIN_TEST_F(false_positive_error_rate_volume_test)
     dispose(bloom_filter_disposable_handle(&bloom));
 END_TEST_F()
 
+/**
+ * Test that a batch query gives the same answers as individual queries.
+ */
+BEGIN_TEST_F(contains_many_test)
+    fixture.localSetUp(10000, 0.05, 65536);
+
+    bloom_filter bloom;
+
+    TEST_ASSERT(bloom_filter_init(&fixture.options, &bloom) == 0);
+
+    // add every other item
+    const size_t count = 1000;
+    uint8_t bufs[count][17];
+    const void* items[count];
+    size_t lens[count];
+    for (size_t i = 0; i < count; i++)
+    {
+        generate_random_bytes(bufs[i], 17);
+        items[i] = bufs[i];
+        lens[i] = 17;
+
+        if (i % 2 == 0)
+        {
+            TEST_ASSERT(bloom_filter_add_item(&bloom, bufs[i], 17) == 0);
+        }
+    }
+
+    // query the whole batch, and a batch that is not a multiple of the
+    // internal block size
+    _Bool results[count];
+    bloom_filter_contains_many(&bloom, items, lens, count, results);
+    for (size_t i = 0; i < count; i++)
+    {
+        TEST_EXPECT(
+            results[i] == bloom_filter_contains_item(&bloom, bufs[i], 17));
+        if (i % 2 == 0)
+        {
+            TEST_EXPECT(results[i]);
+        }
+    }
+
+    memset(results, 0, sizeof(results));
+    bloom_filter_contains_many(&bloom, items + 1, lens + 1, 37, results);
+    for (size_t i = 0; i < 37; i++)
+    {
+        TEST_EXPECT(
+            results[i] == bloom_filter_contains_item(&bloom, bufs[i + 1], 17));
+    }
+
+    //dispose of our filter
+    dispose(bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
 
 /**
  * Utility function to generate a random sequence of bytes
@@ -0,0 +1,147 @@
+/**
+ * \file test_bloom_filter_concurrent.cpp
+ *
+ * Unit tests for concurrent bloom filter access.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/bloom_filter.h>
+
+class bloom_filter_concurrent_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        bloom_filter_options_init_status =
+            bloom_filter_options_init(
+                &options, &alloc_opts, 20000, 0.01, 32768);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == bloom_filter_options_init_status)
+        {
+            dispose(bloom_filter_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    int bloom_filter_options_init_status;
+    allocator_options_t alloc_opts;
+    bloom_filter_options_t options;
+};
+
+TEST_SUITE(bloom_filter_concurrent_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    bloom_filter_concurrent_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that a concurrently added item can be queried with both the concurrent
+ * and the ordinary query functions.
+ */
+BEGIN_TEST_F(simple_add_item_test)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.bloom_filter_options_init_status);
+
+    bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &bloom));
+
+    const char* data = "add me to the bloom filter!";
+    size_t sz_data = strlen(data);
+
+    TEST_EXPECT(!bloom_filter_contains_item_concurrent(&bloom, data, sz_data));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == bloom_filter_add_item_concurrent(&bloom, data, sz_data));
+
+    TEST_EXPECT(bloom_filter_contains_item_concurrent(&bloom, data, sz_data));
+    TEST_EXPECT(bloom_filter_contains_item(&bloom, data, sz_data));
+
+    dispose(bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
+/**
+ * Test that adds from several threads to one filter lose no bits, and produce
+ * exactly the bitmap that sequential adds would.
+ */
+BEGIN_TEST_F(multithreaded_add_test)
+    const int num_threads = 4;
+    const int items_per_thread = 5000;
+
+    bloom_filter_t shared;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &shared));
+    bloom_filter_t expected;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &expected));
+
+    /* each thread adds its own items, and queries them back. */
+    std::vector<std::thread> threads;
+    std::vector<int> misses(num_threads, 0);
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&shared, &misses, t, items_per_thread]() {
+            char buf[32];
+            for (int i = 0; i < items_per_thread; ++i)
+            {
+                snprintf(buf, sizeof(buf), "thread %d item %d", t, i);
+                if (VPR_STATUS_SUCCESS
+                        != bloom_filter_add_item_concurrent(
+                                &shared, buf, strlen(buf))
+                 || !bloom_filter_contains_item_concurrent(
+                                &shared, buf, strlen(buf)))
+                {
+                    ++misses[t];
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int t = 0; t < num_threads; ++t)
+    {
+        TEST_EXPECT(0 == misses[t]);
+    }
+
+    /* build the same filter sequentially. */
+    char buf[32];
+    for (int t = 0; t < num_threads; ++t)
+    {
+        for (int i = 0; i < items_per_thread; ++i)
+        {
+            snprintf(buf, sizeof(buf), "thread %d item %d", t, i);
+            TEST_ASSERT(
+                VPR_STATUS_SUCCESS
+                    == bloom_filter_add_item(&expected, buf, strlen(buf)));
+        }
+    }
+
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    shared.bitmap, expected.bitmap,
+                    fixture.options.size_in_bytes));
+
+    dispose(bloom_filter_disposable_handle(&expected));
+    dispose(bloom_filter_disposable_handle(&shared));
+END_TEST_F()
@@ -0,0 +1,195 @@
+/**
+ * \file test_bloom_filter_merge.cpp
+ *
+ * Unit tests for bloom filter union, intersection and cardinality estimation.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/bloom_filter.h>
+
+class bloom_filter_merge_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        bloom_filter_options_init_status =
+            bloom_filter_options_init(
+                &options, &alloc_opts, 10000, 0.01, 16384);
+        small_options_init_status =
+            bloom_filter_options_init(
+                &small_options, &alloc_opts, 100, 0.01, 16384);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == bloom_filter_options_init_status)
+        {
+            dispose(bloom_filter_options_disposable_handle(&options));
+        }
+        if (VPR_STATUS_SUCCESS == small_options_init_status)
+        {
+            dispose(bloom_filter_options_disposable_handle(&small_options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Add the items "item lo" through "item hi - 1" to a filter.
+     */
+    static int add_range(bloom_filter_t* bloom, int lo, int hi)
+    {
+        char buf[32];
+        for (int i = lo; i < hi; ++i)
+        {
+            snprintf(buf, sizeof(buf), "item %d", i);
+            int retval = bloom_filter_add_item(bloom, buf, strlen(buf));
+            if (VPR_STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        return VPR_STATUS_SUCCESS;
+    }
+
+    /**
+     * Count the items "item lo" through "item hi - 1" found in a filter.
+     */
+    static int count_range(bloom_filter_t* bloom, int lo, int hi)
+    {
+        char buf[32];
+        int count = 0;
+        for (int i = lo; i < hi; ++i)
+        {
+            snprintf(buf, sizeof(buf), "item %d", i);
+            if (bloom_filter_contains_item(bloom, buf, strlen(buf)))
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+    int bloom_filter_options_init_status;
+    int small_options_init_status;
+    allocator_options_t alloc_opts;
+    bloom_filter_options_t options;
+    bloom_filter_options_t small_options;
+};
+
+TEST_SUITE(bloom_filter_merge_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    bloom_filter_merge_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that filters of different sizes cannot be combined.
+ */
+BEGIN_TEST_F(incompatible_test)
+    bloom_filter_t lhs, rhs;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &lhs));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.small_options, &rhs));
+
+    TEST_EXPECT(!bloom_filter_is_compatible(&lhs, &rhs));
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_INCOMPATIBLE_FILTERS == bloom_filter_union(&lhs, &rhs));
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_INCOMPATIBLE_FILTERS
+            == bloom_filter_intersect(&lhs, &rhs));
+
+    dispose(bloom_filter_disposable_handle(&lhs));
+    dispose(bloom_filter_disposable_handle(&rhs));
+END_TEST_F()
+
+/**
+ * Test that the union of two filters holds the items of both, and matches a
+ * filter built from all of the items.
+ */
+BEGIN_TEST_F(union_test)
+    bloom_filter_t lhs, rhs, all;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &lhs));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &rhs));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &all));
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.add_range(&lhs, 0, 3000));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.add_range(&rhs, 2000, 5000));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.add_range(&all, 0, 5000));
+
+    TEST_EXPECT(bloom_filter_is_compatible(&lhs, &rhs));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == bloom_filter_union(&lhs, &rhs));
+
+    TEST_EXPECT(5000 == fixture.count_range(&lhs, 0, 5000));
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    lhs.bitmap, all.bitmap, fixture.options.size_in_bytes));
+
+    dispose(bloom_filter_disposable_handle(&lhs));
+    dispose(bloom_filter_disposable_handle(&rhs));
+    dispose(bloom_filter_disposable_handle(&all));
+END_TEST_F()
+
+/**
+ * Test that the intersection of two filters holds the items common to both,
+ * and few of the others.
+ */
+BEGIN_TEST_F(intersect_test)
+    bloom_filter_t lhs, rhs;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &lhs));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &rhs));
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.add_range(&lhs, 0, 3000));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.add_range(&rhs, 2000, 5000));
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == bloom_filter_intersect(&lhs, &rhs));
+
+    TEST_EXPECT(1000 == fixture.count_range(&lhs, 2000, 3000));
+    TEST_EXPECT(fixture.count_range(&lhs, 0, 2000) < 100);
+    TEST_EXPECT(fixture.count_range(&lhs, 3000, 5000) < 100);
+
+    dispose(bloom_filter_disposable_handle(&lhs));
+    dispose(bloom_filter_disposable_handle(&rhs));
+END_TEST_F()
+
+/**
+ * Test that the cardinality estimate is close to the number of items added.
+ */
+BEGIN_TEST_F(estimate_cardinality_test)
+    bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &bloom));
+
+    TEST_EXPECT(0U == bloom_filter_estimate_cardinality(&bloom));
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.add_range(&bloom, 0, 5000));
+
+    size_t estimate = bloom_filter_estimate_cardinality(&bloom);
+    TEST_EXPECT(estimate > 4900 && estimate < 5100);
+
+    /* a full filter gives a finite estimate. */
+    memset(bloom.bitmap, 0xff, fixture.options.size_in_bytes);
+    estimate = bloom_filter_estimate_cardinality(&bloom);
+    TEST_EXPECT(estimate > 5000);
+
+    dispose(bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
@@ -0,0 +1,248 @@
+/**
+ * \file test_bloom_filter_serialization.cpp
+ *
+ * Unit tests for bloom filter serialization and memory mapping.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/bloom_filter/bloom_filter_serialization.h>
+
+class bloom_filter_serialization_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        bloom_filter_options_init_status =
+            bloom_filter_options_init(
+                &options, &alloc_opts, 1000, 0.01, 16384);
+        bloom_filter_init_status = bloom_filter_init(&options, &bloom);
+
+        char buf[32];
+        for (int i = 0; i < 500; ++i)
+        {
+            snprintf(buf, sizeof(buf), "item %d", i);
+            if (VPR_STATUS_SUCCESS
+                    != bloom_filter_add_item(&bloom, buf, strlen(buf)))
+            {
+                bloom_filter_init_status = -1;
+            }
+        }
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == bloom_filter_init_status)
+        {
+            dispose(bloom_filter_disposable_handle(&bloom));
+        }
+        if (VPR_STATUS_SUCCESS == bloom_filter_options_init_status)
+        {
+            dispose(bloom_filter_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Return true if the filter reports exactly the same items as the fixture
+     * filter.
+     */
+    bool same_items(bloom_filter_t* other)
+    {
+        char buf[32];
+        for (int i = 0; i < 2000; ++i)
+        {
+            snprintf(buf, sizeof(buf), "item %d", i);
+            if (bloom_filter_contains_item(&bloom, buf, strlen(buf))
+                    != bloom_filter_contains_item(other, buf, strlen(buf)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int bloom_filter_options_init_status;
+    int bloom_filter_init_status;
+    allocator_options_t alloc_opts;
+    bloom_filter_options_t options;
+    bloom_filter_t bloom;
+};
+
+TEST_SUITE(bloom_filter_serialization_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    bloom_filter_serialization_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that a serialized filter can be read back from a buffer.
+ */
+BEGIN_TEST_F(buffer_round_trip_test)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.bloom_filter_init_status);
+
+    size_t size = bloom_filter_serialized_size(&fixture.bloom);
+    TEST_EXPECT(
+        BLOOM_FILTER_SERIALIZED_HEADER_SIZE
+            + (fixture.options.size_in_bytes + 7) / 8 * 8 == size);
+
+    /* a vector of words keeps the buffer aligned. */
+    std::vector<uint64_t> buffer((size + 7) / 8);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == bloom_filter_serialize(&fixture.bloom, buffer.data(), size));
+
+    /* the header fields are little-endian. */
+    const uint8_t* bytes = (const uint8_t*)buffer.data();
+    TEST_EXPECT(0 == memcmp(bytes, "VPRBLOOM", 8));
+    TEST_EXPECT(BLOOM_FILTER_SERIALIZED_VERSION == bytes[8]);
+    TEST_EXPECT((fixture.options.size_in_bytes & 0xff) == bytes[16]);
+    TEST_EXPECT(BLOOM_FILTER_HASH_ID_SDBM == bytes[36]);
+    TEST_EXPECT(BLOOM_FILTER_HASH_ID_JENKINS == bytes[40]);
+
+    bloom_filter_options_t options;
+    bloom_filter_t copy;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == bloom_filter_init_from_buffer(
+                    &options, &copy, &fixture.alloc_opts, buffer.data(),
+                    size));
+
+    TEST_EXPECT(fixture.options.size_in_bytes == options.size_in_bytes);
+    TEST_EXPECT(
+        fixture.options.num_hash_functions == options.num_hash_functions);
+    TEST_EXPECT(&sdbm == options.hash_function_1);
+    TEST_EXPECT(&jenkins == options.hash_function_2);
+    TEST_EXPECT(
+        (const uint8_t*)copy.bitmap
+            == bytes + BLOOM_FILTER_SERIALIZED_HEADER_SIZE);
+    TEST_EXPECT(fixture.same_items(&copy));
+
+    dispose(bloom_filter_disposable_handle(&copy));
+    dispose(bloom_filter_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * Test that malformed buffers are rejected.
+ */
+BEGIN_TEST_F(invalid_buffer_test)
+    size_t size = bloom_filter_serialized_size(&fixture.bloom);
+    std::vector<uint64_t> buffer((size + 7) / 8);
+    bloom_filter_options_t options;
+    bloom_filter_t copy;
+
+    /* too small for the filter. */
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_SERIALIZE_BUFFER_TOO_SMALL
+            == bloom_filter_serialize(
+                    &fixture.bloom, buffer.data(), size - 1));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == bloom_filter_serialize(&fixture.bloom, buffer.data(), size));
+
+    /* truncated. */
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_INVALID_FORMAT
+            == bloom_filter_init_from_buffer(
+                    &options, &copy, &fixture.alloc_opts, buffer.data(),
+                    size - 8));
+
+    /* bad magic. */
+    uint8_t* bytes = (uint8_t*)buffer.data();
+    bytes[0] = 'X';
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_INVALID_FORMAT
+            == bloom_filter_init_from_buffer(
+                    &options, &copy, &fixture.alloc_opts, buffer.data(),
+                    size));
+    bytes[0] = 'V';
+
+    /* unknown hash function. */
+    bytes[36] = 99;
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_UNKNOWN_HASH_FUNCTION
+            == bloom_filter_init_from_buffer(
+                    &options, &copy, &fixture.alloc_opts, buffer.data(),
+                    size));
+END_TEST_F()
+
+/**
+ * Test that a bitmap with more bits than bloom_filter_hash() can address is
+ * rejected, even when the buffer holds all of it.
+ */
+BEGIN_TEST_F(oversized_bitmap_test)
+    size_t size = bloom_filter_serialized_size(&fixture.bloom);
+    std::vector<uint64_t> header((size + 7) / 8);
+    bloom_filter_options_t options;
+    bloom_filter_t copy;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == bloom_filter_serialize(&fixture.bloom, header.data(), size));
+
+    /* 2^29 bytes is 2^32 bits, one more than an unsigned int can index. */
+    const uint64_t oversized = (uint64_t)1 << 29;
+    size_t buffer_size = BLOOM_FILTER_SERIALIZED_HEADER_SIZE + oversized;
+    uint8_t* buffer = (uint8_t*)calloc(1, buffer_size);
+    TEST_ASSERT(NULL != buffer);
+
+    memcpy(buffer, header.data(), BLOOM_FILTER_SERIALIZED_HEADER_SIZE);
+    for (int i = 0; i < 8; ++i)
+    {
+        buffer[16 + i] = (uint8_t)(oversized >> (8 * i));
+    }
+
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_INVALID_FORMAT
+            == bloom_filter_init_from_buffer(
+                    &options, &copy, &fixture.alloc_opts, buffer,
+                    buffer_size));
+
+    free(buffer);
+END_TEST_F()
+
+/**
+ * Test that a saved filter can be memory mapped and queried.
+ */
+BEGIN_TEST_F(save_and_map_test)
+    char path[] = "/tmp/test_bloom_filter_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    close(fd);
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == bloom_filter_save(&fixture.bloom, path));
+
+    bloom_filter_mapped_t mapped;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == bloom_filter_mapped_init(&mapped, &fixture.alloc_opts, path));
+
+    TEST_EXPECT(
+        bloom_filter_serialized_size(&fixture.bloom) == mapped.map_size);
+    TEST_EXPECT(fixture.same_items(&mapped.filter));
+    TEST_EXPECT(
+        bloom_filter_contains_item_concurrent(&mapped.filter, "item 7", 6));
+
+    dispose(bloom_filter_mapped_disposable_handle(&mapped));
+    unlink(path);
+
+    /* a missing file cannot be mapped. */
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_FILE_IO
+            == bloom_filter_mapped_init(&mapped, &fixture.alloc_opts, path));
+END_TEST_F()
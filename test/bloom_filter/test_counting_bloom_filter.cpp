@@ -0,0 +1,224 @@
+/**
+ * \file test_counting_bloom_filter.cpp
+ *
+ * Unit tests for counting_bloom_filter.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/bloom_filter/counting_bloom_filter.h>
+
+class counting_bloom_filter_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        bloom_filter_options_init_status =
+            bloom_filter_options_init(
+                &options, &alloc_opts, 1000, 0.01, 16384);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == bloom_filter_options_init_status)
+        {
+            dispose(bloom_filter_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    int bloom_filter_options_init_status;
+    allocator_options_t alloc_opts;
+    bloom_filter_options_t options;
+};
+
+TEST_SUITE(counting_bloom_filter_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    counting_bloom_filter_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the counting bloom filter is initialized empty.
+ */
+BEGIN_TEST_F(init_test)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.bloom_filter_options_init_status);
+
+    counting_bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_init(&fixture.options, &bloom));
+
+    /* there are sixteen counters per word, one per bit of the bitmap. */
+    TEST_EXPECT(
+        bloom.num_words == (fixture.options.size_in_bytes * 8 + 15) / 16);
+    for (size_t i = 0; i < bloom.num_words; ++i)
+    {
+        TEST_EXPECT(0 == bloom.counters[i]);
+    }
+
+    dispose(counting_bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
+/**
+ * Test that items can be added, queried, and removed.
+ */
+BEGIN_TEST_F(add_remove_test)
+    counting_bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_init(&fixture.options, &bloom));
+
+    const char* data = "add me to the counting bloom filter!";
+    size_t sz_data = strlen(data);
+
+    TEST_EXPECT(!counting_bloom_filter_contains_item(&bloom, data, sz_data));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_add_item(&bloom, data, sz_data));
+    TEST_EXPECT(counting_bloom_filter_contains_item(&bloom, data, sz_data));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_remove_item(&bloom, data, sz_data));
+    TEST_EXPECT(!counting_bloom_filter_contains_item(&bloom, data, sz_data));
+
+    /* every counter is back to zero. */
+    for (size_t i = 0; i < bloom.num_words; ++i)
+    {
+        TEST_EXPECT(0 == bloom.counters[i]);
+    }
+
+    /* removing an item that isn't in the filter fails. */
+    TEST_EXPECT(
+        VPR_ERROR_BLOOM_REMOVE_ITEM_NOT_FOUND
+            == counting_bloom_filter_remove_item(&bloom, data, sz_data));
+
+    dispose(counting_bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
+/**
+ * Removing one item does not remove other items.
+ */
+BEGIN_TEST_F(remove_keeps_others_test)
+    counting_bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_init(&fixture.options, &bloom));
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == counting_bloom_filter_add_item(&bloom, &i, sizeof(i)));
+    }
+
+    /* remove the even items. */
+    for (uint32_t i = 0; i < 1000; i += 2)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == counting_bloom_filter_remove_item(&bloom, &i, sizeof(i)));
+    }
+
+    /* there are no false negatives for the odd items. */
+    for (uint32_t i = 1; i < 1000; i += 2)
+    {
+        TEST_EXPECT(counting_bloom_filter_contains_item(&bloom, &i, sizeof(i)));
+    }
+
+    dispose(counting_bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
+/**
+ * Saturated counters are never decremented.
+ */
+BEGIN_TEST_F(saturation_test)
+    counting_bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_init(&fixture.options, &bloom));
+
+    const char* data = "saturate me";
+    size_t sz_data = strlen(data);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == counting_bloom_filter_add_item(&bloom, data, sz_data));
+    }
+
+    for (int i = 0; i < 20; ++i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == counting_bloom_filter_remove_item(&bloom, data, sz_data));
+    }
+
+    /* the counters are stuck at their maximum value. */
+    TEST_EXPECT(counting_bloom_filter_contains_item(&bloom, data, sz_data));
+
+    dispose(counting_bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
+/**
+ * The compacted bloom filter matches a bloom filter built from the same items.
+ */
+BEGIN_TEST_F(to_bloom_filter_test)
+    counting_bloom_filter_t counting;
+    bloom_filter_t expected;
+    bloom_filter_t compacted;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_init(&fixture.options, &counting));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == bloom_filter_init(&fixture.options, &expected));
+
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == counting_bloom_filter_add_item(&counting, &i, sizeof(i)));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == bloom_filter_add_item(&expected, &i, sizeof(i)));
+    }
+
+    /* add and remove some items which should leave no trace. */
+    for (uint32_t i = 10000; i < 10100; ++i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == counting_bloom_filter_add_item(&counting, &i, sizeof(i)));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == counting_bloom_filter_remove_item(
+                        &counting, &i, sizeof(i)));
+    }
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == counting_bloom_filter_to_bloom_filter(&counting, &compacted));
+
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    expected.bitmap, compacted.bitmap,
+                    fixture.options.size_in_bytes));
+
+    dispose(bloom_filter_disposable_handle(&compacted));
+    dispose(bloom_filter_disposable_handle(&expected));
+    dispose(counting_bloom_filter_disposable_handle(&counting));
+END_TEST_F()
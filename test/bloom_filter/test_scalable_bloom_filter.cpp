@@ -0,0 +1,147 @@
+/**
+ * \file test_scalable_bloom_filter.cpp
+ *
+ * Unit tests for scalable_bloom_filter.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/bloom_filter/scalable_bloom_filter.h>
+
+class scalable_bloom_filter_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        scalable_bloom_filter_options_init_status =
+            scalable_bloom_filter_options_init(
+                &options, &alloc_opts, 100, 0.01);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == scalable_bloom_filter_options_init_status)
+        {
+            dispose(scalable_bloom_filter_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    int scalable_bloom_filter_options_init_status;
+    allocator_options_t alloc_opts;
+    scalable_bloom_filter_options_t options;
+};
+
+TEST_SUITE(scalable_bloom_filter_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    scalable_bloom_filter_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the scalable bloom filter starts with a single empty stage.
+ */
+BEGIN_TEST_F(init_test)
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == fixture.scalable_bloom_filter_options_init_status);
+    TEST_EXPECT(SCALABLE_BLOOM_FILTER_DEFAULT_GROWTH_FACTOR
+            == fixture.options.growth_factor);
+
+    scalable_bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == scalable_bloom_filter_init(&fixture.options, &bloom));
+
+    TEST_EXPECT(1U == bloom.num_stages);
+    TEST_EXPECT(100U == bloom.stages[0]->capacity);
+    TEST_EXPECT(0U == bloom.stages[0]->count);
+    TEST_EXPECT(!scalable_bloom_filter_contains_item(&bloom, "foo", 3));
+
+    dispose(scalable_bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
+/**
+ * Test that adding a duplicate item does not consume capacity.
+ */
+BEGIN_TEST_F(duplicate_test)
+    scalable_bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == scalable_bloom_filter_init(&fixture.options, &bloom));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == scalable_bloom_filter_add_item(&bloom, "foo", 3));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == scalable_bloom_filter_add_item(&bloom, "foo", 3));
+
+    TEST_EXPECT(scalable_bloom_filter_contains_item(&bloom, "foo", 3));
+    TEST_EXPECT(1U == bloom.stages[0]->count);
+
+    dispose(scalable_bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
+
+/**
+ * Test that the filter grows past its initial capacity without false
+ * negatives, and that its false positive rate stays near the target.
+ */
+BEGIN_TEST_F(growth_test)
+    const int num_items = 5000;
+    const int num_probes = 20000;
+    char buf[32];
+
+    scalable_bloom_filter_t bloom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == scalable_bloom_filter_init(&fixture.options, &bloom));
+
+    for (int i = 0; i < num_items; ++i)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == scalable_bloom_filter_add_item(&bloom, buf, strlen(buf)));
+    }
+
+    /* 100 + 200 + 400 + 800 + 1600 < 5000 <= 100 + ... + 3200 */
+    TEST_EXPECT(6U == bloom.num_stages);
+    for (size_t i = 1; i < bloom.num_stages; ++i)
+    {
+        TEST_EXPECT(
+            2 * bloom.stages[i - 1]->capacity == bloom.stages[i]->capacity);
+    }
+
+    /* there are no false negatives. */
+    for (int i = 0; i < num_items; ++i)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_EXPECT(
+            scalable_bloom_filter_contains_item(&bloom, buf, strlen(buf)));
+    }
+
+    /* the false positive rate remains bounded by the target. */
+    int false_positives = 0;
+    for (int i = 0; i < num_probes; ++i)
+    {
+        snprintf(buf, sizeof(buf), "other %d", i);
+        if (scalable_bloom_filter_contains_item(&bloom, buf, strlen(buf)))
+        {
+            ++false_positives;
+        }
+    }
+    TEST_EXPECT(false_positives < num_probes * 0.015);
+
+    dispose(scalable_bloom_filter_disposable_handle(&bloom));
+END_TEST_F()
@@ -0,0 +1,175 @@
+/**
+ * \file test_columnar_array.cpp
+ *
+ * Unit tests for columnar_array.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/columnar_array.h>
+#include <vpr/compare.h>
+
+class columnar_array_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+    }
+
+    void tearDown()
+    {
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Append a row of an int key, a one-byte tag, and a twelve-byte label.
+     */
+    bool append(
+        columnar_array_t* array, int key, uint8_t tag, const char* label)
+    {
+        char text[12] = { 0 };
+        snprintf(text, sizeof(text), "%s", label);
+        const void* values[] = { &key, &tag, text };
+
+        return
+            VPR_STATUS_SUCCESS == columnar_array_append_row(array, values);
+    }
+
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(columnar_array_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    columnar_array_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * There must be at least one column, and no column may have empty fields.
+ */
+BEGIN_TEST_F(init)
+    columnar_array_t array;
+    const size_t sizes[] = { sizeof(int), 0 };
+
+    TEST_EXPECT(
+        VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT
+            == columnar_array_init(&array, &fixture.alloc_opts, sizes, 0, 4));
+    TEST_EXPECT(
+        VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT
+            == columnar_array_init(&array, &fixture.alloc_opts, sizes, 2, 4));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == columnar_array_init(&array, &fixture.alloc_opts, sizes, 1, 0));
+    TEST_EXPECT(0U == columnar_array_rows(&array));
+    TEST_EXPECT(NULL == columnar_array_at(&array, 0, 0));
+
+    dispose(columnar_array_disposable_handle(&array));
+END_TEST_F()
+
+/**
+ * Appended rows are stored one column at a time, and every column stays
+ * aligned as the array grows.
+ */
+BEGIN_TEST_F(append_row)
+    columnar_array_t array;
+    const size_t sizes[] = { sizeof(int), 1, 12 };
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == columnar_array_init(&array, &fixture.alloc_opts, sizes, 3, 1));
+
+    for (int i = 0; i < 100; ++i)
+    {
+        TEST_ASSERT(fixture.append(&array, i * 3, (uint8_t)i, "row"));
+    }
+
+    TEST_ASSERT(100U == columnar_array_rows(&array));
+    const int* keys = (const int*)columnar_array_column(&array, 0);
+    const uint8_t* tags = (const uint8_t*)columnar_array_column(&array, 1);
+    for (int i = 0; i < 100; ++i)
+    {
+        TEST_EXPECT(i * 3 == keys[i]);
+        TEST_EXPECT((uint8_t)i == tags[i]);
+        TEST_EXPECT(
+            0 == strcmp("row", (const char*)columnar_array_at(&array, 2, i)));
+    }
+
+    for (size_t c = 0; c < 3; ++c)
+    {
+        TEST_EXPECT(
+            0
+                == (uintptr_t)columnar_array_column(&array, c)
+                    % COLUMNAR_ARRAY_ALIGNMENT);
+    }
+
+    TEST_EXPECT(NULL == columnar_array_at(&array, 0, 100));
+
+    dispose(columnar_array_disposable_handle(&array));
+END_TEST_F()
+
+/**
+ * Sorting by one column permutes every column, and keeps rows with equal
+ * keys in order.
+ */
+BEGIN_TEST_F(sort_by_column)
+    columnar_array_t array;
+    const size_t sizes[] = { sizeof(int), 1, 12 };
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == columnar_array_init(&array, &fixture.alloc_opts, sizes, 3, 0));
+
+    /* enough rows for several merge passes, with many equal keys. */
+    for (int i = 0; i < 300; ++i)
+    {
+        char label[12];
+        snprintf(label, sizeof(label), "%d", i);
+        TEST_ASSERT(
+            fixture.append(&array, (i * 37) % 50, (uint8_t)(i % 7), label));
+    }
+
+    TEST_EXPECT(
+        VPR_ERROR_COLUMNAR_ARRAY_INVALID_ARGUMENT
+            == columnar_array_sort_by_column(&array, 3, &compare_int));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == columnar_array_sort_by_column(&array, 0, &compare_int));
+
+    const int* keys = (const int*)columnar_array_column(&array, 0);
+    const uint8_t* tags = (const uint8_t*)columnar_array_column(&array, 1);
+    int previous_row = -1;
+    for (size_t i = 0; i < 300; ++i)
+    {
+        /* the label holds the original row, from which the other fields
+         * follow. */
+        int row = atoi((const char*)columnar_array_at(&array, 2, i));
+        TEST_EXPECT((row * 37) % 50 == keys[i]);
+        TEST_EXPECT((uint8_t)(row % 7) == tags[i]);
+
+        if (i > 0)
+        {
+            TEST_EXPECT(keys[i - 1] <= keys[i]);
+            if (keys[i - 1] == keys[i])
+            {
+                TEST_EXPECT(previous_row < row);
+            }
+        }
+
+        previous_row = row;
+    }
+
+    dispose(columnar_array_disposable_handle(&array));
+END_TEST_F()
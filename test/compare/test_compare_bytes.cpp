@@ -0,0 +1,48 @@
+/**
+ * \file test_compare_bytes.cpp
+ *
+ * Unit tests for compare_bytes.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <vpr/compare.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+TEST_SUITE(compare_bytes);
+
+/**
+ * Test that comparing two identical byte strings results in 0.
+ */
+TEST(equality)
+{
+    const uint8_t X[5] = { 1, 2, 3, 4, 5 };
+    const uint8_t Y[5] = { 1, 2, 3, 4, 5 };
+
+    TEST_EXPECT(0 == compare_bytes(X, Y, sizeof(X)));
+}
+
+/**
+ * Test that X > Y results in a return value that is greater than zero.
+ */
+TEST(greater_than)
+{
+    const uint8_t X[5] = { 1, 2, 3, 5, 0 };
+    const uint8_t Y[5] = { 1, 2, 3, 4, 9 };
+
+    TEST_EXPECT(0 < memcmp(X, Y, sizeof(X)));
+    TEST_EXPECT(0 < compare_bytes(X, Y, sizeof(X)));
+}
+
+/**
+ * Test that X < Y results in a return value that is less than zero.
+ */
+TEST(less_than)
+{
+    const uint8_t X[5] = { 0, 9, 9, 9, 9 };
+    const uint8_t Y[5] = { 1, 0, 0, 0, 0 };
+
+    TEST_EXPECT(0 > memcmp(X, Y, sizeof(X)));
+    TEST_EXPECT(0 > compare_bytes(X, Y, sizeof(X)));
+}
@@ -0,0 +1,224 @@
+/**
+ * \file test_cuckoo_filter.cpp
+ *
+ * Unit tests for cuckoo_filter.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/cuckoo_filter.h>
+
+class cuckoo_filter_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        cuckoo_filter_options_init_status =
+            cuckoo_filter_options_init(&options, &alloc_opts, 10000, 0.01);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == cuckoo_filter_options_init_status)
+        {
+            dispose(cuckoo_filter_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    int cuckoo_filter_options_init_status;
+    allocator_options_t alloc_opts;
+    cuckoo_filter_options_t options;
+};
+
+TEST_SUITE(cuckoo_filter_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    cuckoo_filter_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the options are sized from the expected entries and error rate.
+ */
+BEGIN_TEST_F(options_init_test)
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == fixture.cuckoo_filter_options_init_status);
+
+    /* 10000 / (4 * 0.95) = 2632 buckets, rounded up to a power of two. */
+    TEST_EXPECT(4096U == fixture.options.num_buckets);
+
+    /* log2(8 / 0.01) = 9.6 bits, rounded up to two bytes. */
+    TEST_EXPECT(2U == fixture.options.fingerprint_size);
+
+    cuckoo_filter_options_t coarse;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == cuckoo_filter_options_init(
+                    &coarse, &fixture.alloc_opts, 100, 0.05));
+    TEST_EXPECT(1U == coarse.fingerprint_size);
+    TEST_EXPECT(32U == coarse.num_buckets);
+    dispose(cuckoo_filter_options_disposable_handle(&coarse));
+END_TEST_F()
+
+/**
+ * Test that items can be added, queried and removed.
+ */
+BEGIN_TEST_F(add_remove_test)
+    cuckoo_filter_t filter;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_init(&fixture.options, &filter));
+
+    TEST_EXPECT(0.0f == cuckoo_filter_load_factor(&filter));
+    TEST_EXPECT(!cuckoo_filter_contains_item(&filter, "foo", 3));
+    TEST_EXPECT(
+        VPR_ERROR_CUCKOO_FILTER_ITEM_NOT_FOUND
+            == cuckoo_filter_remove_item(&filter, "foo", 3));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_add_item(&filter, "foo", 3));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_add_item(&filter, "bar", 3));
+    TEST_EXPECT(cuckoo_filter_contains_item(&filter, "foo", 3));
+    TEST_EXPECT(cuckoo_filter_contains_item(&filter, "bar", 3));
+    TEST_EXPECT(2U == filter.count);
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_remove_item(&filter, "foo", 3));
+    TEST_EXPECT(!cuckoo_filter_contains_item(&filter, "foo", 3));
+    TEST_EXPECT(cuckoo_filter_contains_item(&filter, "bar", 3));
+
+    /* a duplicate must be removed as many times as it was added. */
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_add_item(&filter, "bar", 3));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_remove_item(&filter, "bar", 3));
+    TEST_EXPECT(cuckoo_filter_contains_item(&filter, "bar", 3));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_remove_item(&filter, "bar", 3));
+    TEST_EXPECT(!cuckoo_filter_contains_item(&filter, "bar", 3));
+    TEST_EXPECT(0U == filter.count);
+
+    dispose(cuckoo_filter_disposable_handle(&filter));
+END_TEST_F()
+
+/**
+ * Test that a filter holding its expected number of entries has no false
+ * negatives, keeps to its error rate, and still has no false negatives after
+ * half of the entries are removed.
+ */
+BEGIN_TEST_F(expected_entries_test)
+    const int num_items = 10000;
+    const int num_probes = 100000;
+    char buf[32];
+
+    cuckoo_filter_t filter;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_init(&fixture.options, &filter));
+
+    for (int i = 0; i < num_items; ++i)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == cuckoo_filter_add_item(&filter, buf, strlen(buf)));
+    }
+
+    TEST_EXPECT(
+        (float)num_items / (4096 * CUCKOO_FILTER_BUCKET_SIZE)
+            == cuckoo_filter_load_factor(&filter));
+
+    for (int i = 0; i < num_items; ++i)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_EXPECT(cuckoo_filter_contains_item(&filter, buf, strlen(buf)));
+    }
+
+    int false_positives = 0;
+    for (int i = 0; i < num_probes; ++i)
+    {
+        snprintf(buf, sizeof(buf), "other %d", i);
+        if (cuckoo_filter_contains_item(&filter, buf, strlen(buf)))
+        {
+            ++false_positives;
+        }
+    }
+    TEST_EXPECT(false_positives < num_probes * 0.01);
+
+    for (int i = 0; i < num_items; i += 2)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == cuckoo_filter_remove_item(&filter, buf, strlen(buf)));
+    }
+
+    for (int i = 1; i < num_items; i += 2)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_EXPECT(cuckoo_filter_contains_item(&filter, buf, strlen(buf)));
+    }
+
+    dispose(cuckoo_filter_disposable_handle(&filter));
+END_TEST_F()
+
+/**
+ * Test that a filter which fills up rejects further items without losing any
+ * of the items it holds, and accepts items again once some are removed.
+ */
+BEGIN_TEST_F(full_test)
+    cuckoo_filter_options_t options;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == cuckoo_filter_options_init(
+                    &options, &fixture.alloc_opts, 100, 0.01));
+
+    cuckoo_filter_t filter;
+    TEST_ASSERT(VPR_STATUS_SUCCESS == cuckoo_filter_init(&options, &filter));
+
+    char buf[32];
+    int added = 0;
+    int retval = VPR_STATUS_SUCCESS;
+    while (VPR_STATUS_SUCCESS == retval && added < 1000)
+    {
+        snprintf(buf, sizeof(buf), "item %d", added);
+        retval = cuckoo_filter_add_item(&filter, buf, strlen(buf));
+        if (VPR_STATUS_SUCCESS == retval)
+        {
+            ++added;
+        }
+    }
+
+    TEST_ASSERT(VPR_ERROR_CUCKOO_FILTER_FULL == retval);
+    TEST_EXPECT(cuckoo_filter_load_factor(&filter) > 0.9f);
+
+    for (int i = 0; i < added; ++i)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_EXPECT(cuckoo_filter_contains_item(&filter, buf, strlen(buf)));
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        snprintf(buf, sizeof(buf), "item %d", i);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == cuckoo_filter_remove_item(&filter, buf, strlen(buf)));
+    }
+
+    TEST_EXPECT(
+        VPR_STATUS_SUCCESS == cuckoo_filter_add_item(&filter, "new", 3));
+    TEST_EXPECT(cuckoo_filter_contains_item(&filter, "new", 3));
+
+    dispose(cuckoo_filter_disposable_handle(&filter));
+    dispose(cuckoo_filter_options_disposable_handle(&options));
+END_TEST_F()
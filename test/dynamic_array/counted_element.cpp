@@ -0,0 +1,86 @@
+/**
+ * \file counted_element.cpp
+ *
+ * Element methods which count live elements, for testing that dynamic arrays
+ * and the containers built on them honor their copy and dispose methods.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <vpr/compare.h>
+
+#include "counted_element.h"
+
+/**
+ * Copy method which copies an element by its bytes and counts it as live.
+ */
+void counting_copy(
+    void* context, void* destination, const void* source, size_t size)
+{
+    element_counts* counts = (element_counts*)context;
+    ++counts->live;
+    ++counts->copies;
+    memcpy(destination, source, size);
+}
+
+/**
+ * Dispose method which counts an element as no longer live.
+ */
+void counting_dispose(void* context, void*)
+{
+    element_counts* counts = (element_counts*)context;
+    --counts->live;
+    ++counts->disposes;
+}
+
+/**
+ * Initialize a tracked element which is not in an array.
+ */
+void tracked_init(tracked* element, int value, int position)
+{
+    element->self = element;
+    element->value = value;
+    element->position = position;
+}
+
+/**
+ * Copy method which fixes up the self pointer and counts live elements.
+ */
+void tracked_copy(
+    void* context, void* destination, const void* source, size_t)
+{
+    element_counts* counts = (element_counts*)context;
+    const tracked* src = (const tracked*)source;
+
+    tracked_init((tracked*)destination, src->value, src->position);
+    ++counts->live;
+    ++counts->copies;
+}
+
+/**
+ * Dispose method which counts live elements.  In poisoning mode, the self
+ * pointer of the element is cleared, so that comparing it afterwards faults.
+ */
+void tracked_dispose(void* context, void* element)
+{
+    element_counts* counts = (element_counts*)context;
+    if (counts->poison)
+    {
+        tracked* dead = (tracked*)element;
+        dead->self = NULL;
+        dead->value = -1;
+    }
+
+    counting_dispose(context, element);
+}
+
+/**
+ * Compare tracked elements by value, which is read through the self pointer.
+ */
+int compare_tracked(const void* x, const void* y, size_t)
+{
+    return compare_int(
+        &((const tracked*)x)->self->value, &((const tracked*)y)->self->value,
+        sizeof(int));
+}
@@ -0,0 +1,77 @@
+/**
+ * \file counted_element.h
+ *
+ * Element methods which count live elements, for testing that dynamic arrays
+ * and the containers built on them honor their copy and dispose methods.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#ifndef TEST_DYNAMIC_ARRAY_COUNTED_ELEMENT_HEADER_GUARD
+#define TEST_DYNAMIC_ARRAY_COUNTED_ELEMENT_HEADER_GUARD
+
+#include <stddef.h>
+
+/**
+ * The context of the counting and tracked element methods.
+ */
+struct element_counts
+{
+    /** The number of elements copied and not yet disposed. */
+    int live = 0;
+
+    /** The number of calls to the copy method. */
+    int copies = 0;
+
+    /** The number of calls to the dispose method. */
+    int disposes = 0;
+
+    /** If set, tracked elements are poisoned when they are disposed. */
+    bool poison = false;
+};
+
+/**
+ * Copy method which copies an element by its bytes and counts it as live.
+ */
+void counting_copy(
+    void* context, void* destination, const void* source, size_t size);
+
+/**
+ * Dispose method which counts an element as no longer live.
+ */
+void counting_dispose(void* context, void* element);
+
+/**
+ * An element which points to itself, so that moving it by its bytes instead
+ * of with the copy method is detected.
+ */
+struct tracked
+{
+    const tracked* self;
+    int value;
+    int position;
+};
+
+/**
+ * Initialize a tracked element which is not in an array.
+ */
+void tracked_init(tracked* element, int value, int position = 0);
+
+/**
+ * Copy method which fixes up the self pointer and counts live elements.
+ */
+void tracked_copy(
+    void* context, void* destination, const void* source, size_t size);
+
+/**
+ * Dispose method which counts live elements.  In poisoning mode, the self
+ * pointer of the element is cleared, so that comparing it afterwards faults.
+ */
+void tracked_dispose(void* context, void* element);
+
+/**
+ * Compare tracked elements by value, which is read through the self pointer.
+ */
+int compare_tracked(const void* x, const void* y, size_t size);
+
+#endif  //TEST_DYNAMIC_ARRAY_COUNTED_ELEMENT_HEADER_GUARD
@@ -130,3 +130,91 @@ BEGIN_TEST_F(full_array)
     //dispose the array
     dispose(dynamic_array_disposable_handle(&array));
 END_TEST_F()
+
+/**
+ * The growth factor must be 0 or greater than 1.
+ */
+BEGIN_TEST_F(set_growth_factor)
+    TEST_EXPECT(0.0f == fixture.options.growth_factor);
+
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_GROW_INVALID_ARGUMENT
+            == dynamic_array_options_set_growth_factor(&fixture.options, 1.0f));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_GROW_INVALID_ARGUMENT
+            == dynamic_array_options_set_growth_factor(
+                    &fixture.options, -2.0f));
+    TEST_EXPECT(0.0f == fixture.options.growth_factor);
+
+    TEST_EXPECT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_set_growth_factor(&fixture.options, 1.5f));
+    TEST_EXPECT(1.5f == fixture.options.growth_factor);
+
+    TEST_EXPECT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_set_growth_factor(&fixture.options, 0.0f));
+    TEST_EXPECT(0.0f == fixture.options.growth_factor);
+END_TEST_F()
+
+/**
+ * With a growth factor set, appending to a full array grows it geometrically.
+ */
+BEGIN_TEST_F(auto_grow)
+    dynamic_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_set_growth_factor(&fixture.options, 2.0f));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&fixture.options, &array, 1, 0, NULL));
+
+    //appending never fails, and the reserve doubles each time it is exceeded
+    bool appended = true;
+    for (int i = 0; i < 100000; ++i)
+    {
+        appended = appended
+            && VPR_STATUS_SUCCESS == dynamic_array_append(&array, &i);
+    }
+    TEST_ASSERT(appended);
+    TEST_EXPECT((size_t)100000 == array.elements);
+    TEST_EXPECT((size_t)131072 == array.reserved_elements);
+
+    //every element was preserved across each growth
+    int* intArray = (int*)array.array;
+    bool preserved = true;
+    for (int i = 0; i < 100000; ++i)
+    {
+        preserved = preserved && i == intArray[i];
+    }
+    TEST_EXPECT(preserved);
+
+    dispose(dynamic_array_disposable_handle(&array));
+END_TEST_F()
+
+/**
+ * A growth factor too small to add a whole element still grows by one.
+ */
+BEGIN_TEST_F(auto_grow_small_factor)
+    int SEVENTEEN = 17;
+    dynamic_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_set_growth_factor(
+                    &fixture.options, 1.25f));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&fixture.options, &array, 2, 2, &SEVENTEEN));
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&array, &SEVENTEEN));
+    TEST_EXPECT((size_t)3 == array.reserved_elements);
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&array, &SEVENTEEN));
+    TEST_EXPECT((size_t)4 == array.reserved_elements);
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&array, &SEVENTEEN));
+    TEST_EXPECT((size_t)5 == array.reserved_elements);
+    TEST_EXPECT((size_t)5 == array.elements);
+
+    dispose(dynamic_array_disposable_handle(&array));
+END_TEST_F()
@@ -286,3 +286,29 @@ BEGIN_TEST_F(near_middle_element3)
     /* dispose the array. */
     dispose(dynamic_array_disposable_handle(&array));
 END_TEST_F()
+
+/**
+ * Searching for a key smaller or larger than every element fails to find an
+ * element, and searching an array of equal elements finds the first one.
+ */
+BEGIN_TEST_F(outside_elements)
+    int ZERO = 0;
+    int THREE = 3;
+    int SIX = 6;
+    dynamic_array_t array;
+
+    /* create an array of five THREE elements. */
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&fixture.options, &array, 5, 5, &THREE));
+
+    /* keys outside the elements are not found. */
+    TEST_EXPECT(NULL == dynamic_array_binary_search(&array, &ZERO));
+    TEST_EXPECT(NULL == dynamic_array_binary_search(&array, &SIX));
+
+    /* the first of the equal elements is found. */
+    TEST_EXPECT(array.array == dynamic_array_binary_search(&array, &THREE));
+
+    /* dispose the array. */
+    dispose(dynamic_array_disposable_handle(&array));
+END_TEST_F()
@@ -0,0 +1,191 @@
+/**
+ * \file test_dynamic_array_bound.cpp
+ *
+ * Unit tests for dynamic_array_lower_bound, dynamic_array_upper_bound,
+ * dynamic_array_equal_range, and dynamic_array_lower_bound_batch.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+/**
+ * Compare ints through a method which is not one of the built-in ones.
+ */
+static int compare_int_generic(const void* x, const void* y, size_t size)
+{
+    return compare_int(x, y, size);
+}
+
+class dynamic_array_bound_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+    }
+
+    void tearDown()
+    {
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Check every bound query of an array of the given ints against a linear
+     * scan, for every key from below the first element to above the last.
+     */
+    bool bounds_match(compare_method_t compare, const std::vector<int>& values)
+    {
+        dynamic_array_options_t options;
+        dynamic_array_t array;
+        bool match = true;
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_options_init(
+                        &options, &alloc_opts, sizeof(int), compare))
+        {
+            return false;
+        }
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(
+                        &options, &array, values.size() + 1, 0, NULL))
+        {
+            dispose(dynamic_array_options_disposable_handle(&options));
+            return false;
+        }
+
+        for (int value : values)
+        {
+            match = match
+                && VPR_STATUS_SUCCESS == dynamic_array_append(&array, &value);
+        }
+
+        int lowest = values.empty() ? 0 : values.front() - 2;
+        int highest = values.empty() ? 0 : values.back() + 2;
+        std::vector<int> keys;
+        for (int key = lowest; key <= highest; ++key)
+        {
+            size_t lower = 0;
+            while (lower < values.size() && values[lower] < key)
+            {
+                ++lower;
+            }
+
+            size_t upper = lower;
+            while (upper < values.size() && values[upper] == key)
+            {
+                ++upper;
+            }
+
+            size_t begin, end;
+            dynamic_array_equal_range(&array, &key, &begin, &end);
+
+            match = match
+                && lower == dynamic_array_lower_bound(&array, &key)
+                && upper == dynamic_array_upper_bound(&array, &key)
+                && lower == begin && upper == end;
+
+            keys.push_back(key);
+        }
+
+        /* the batch finds the same lower bounds. */
+        std::vector<size_t> indices(keys.size());
+        dynamic_array_lower_bound_batch(
+            &array, keys.data(), keys.size(), indices.data());
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            match = match
+                && indices[i] == dynamic_array_lower_bound(&array, &keys[i]);
+        }
+
+        dispose(dynamic_array_disposable_handle(&array));
+        dispose(dynamic_array_options_disposable_handle(&options));
+
+        return match;
+    }
+
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(dynamic_array_bound_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_bound_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test bounds over empty, single element, and duplicated arrays, both with a
+ * built-in comparison method and with a custom one.
+ */
+BEGIN_TEST_F(bounds)
+    std::vector<std::vector<int>> cases = {
+        {},
+        { 5 },
+        { -3, -3, 0, 7, 7, 7, 12 },
+        { 4, 4, 4, 4, 4, 4, 4, 4, 4 } };
+
+    /* a longer array with gaps and runs. */
+    std::vector<int> runs;
+    for (int i = -200; i < 200; ++i)
+    {
+        for (int j = 0; j < (i & 3); ++j)
+        {
+            runs.push_back(3 * i);
+        }
+    }
+    cases.push_back(runs);
+
+    for (const std::vector<int>& values : cases)
+    {
+        TEST_EXPECT(fixture.bounds_match(&compare_int, values));
+        TEST_EXPECT(fixture.bounds_match(&compare_int_generic, values));
+    }
+END_TEST_F()
+
+/**
+ * Test that a batch of keys which are far apart, and which lie beyond the end
+ * of the array, finds the right bounds.
+ */
+BEGIN_TEST_F(sparse_batch)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &options, &fixture.alloc_opts, sizeof(int), &compare_int));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, 10000, 0, NULL));
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&array, &i));
+    }
+
+    int keys[] = { -5, 0, 1, 1, 999, 1000, 9998, 9999, 10000, 20000 };
+    size_t expected[] = { 0, 0, 1, 1, 999, 1000, 9998, 9999, 10000, 10000 };
+    size_t indices[sizeof(keys) / sizeof(keys[0])];
+
+    dynamic_array_lower_bound_batch(
+        &array, keys, sizeof(keys) / sizeof(keys[0]), indices);
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i)
+    {
+        TEST_EXPECT(expected[i] == indices[i]);
+    }
+
+    dispose(dynamic_array_disposable_handle(&array));
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
@@ -0,0 +1,223 @@
+/**
+ * \file test_dynamic_array_erase.cpp
+ *
+ * Unit tests for dynamic_array_erase_range, dynamic_array_swap_remove, and
+ * dynamic_array_truncate.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+#include "counted_element.h"
+
+class dynamic_array_erase_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        int_status =
+            dynamic_array_options_init(
+                &int_options, &alloc_opts, sizeof(int), &compare_int);
+        tracked_status =
+            dynamic_array_options_init_ex(
+                &tracked_options, &alloc_opts, sizeof(tracked), &counts,
+                &tracked_copy, &tracked_dispose, &compare_tracked);
+
+        /* let the arrays grow as elements are added. */
+        growth_status =
+            VPR_STATUS_SUCCESS == int_status
+         && VPR_STATUS_SUCCESS == tracked_status
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(&int_options, 2)
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(
+                        &tracked_options, 2);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == int_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&int_options));
+        }
+        if (VPR_STATUS_SUCCESS == tracked_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&tracked_options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Create an int array and a tracked array holding the values 0 to count.
+     */
+    bool create(dynamic_array_t* ints, dynamic_array_t* tracks, int count)
+    {
+        if (!growth_status)
+        {
+            return false;
+        }
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(&int_options, ints, count, 0, NULL))
+        {
+            return false;
+        }
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(&tracked_options, tracks, count, 0, NULL))
+        {
+            dispose(dynamic_array_disposable_handle(ints));
+            return false;
+        }
+
+        bool ok = true;
+        for (int i = 0; i < count; ++i)
+        {
+            tracked elem;
+            tracked_init(&elem, i);
+            ok = ok
+                && VPR_STATUS_SUCCESS == dynamic_array_append(ints, &i)
+                && VPR_STATUS_SUCCESS == dynamic_array_append(tracks, &elem);
+        }
+
+        return ok;
+    }
+
+    /**
+     * Check that both arrays hold the expected values, and that every tracked
+     * element was moved with the copy method and is live exactly once.
+     */
+    bool holds(
+        const dynamic_array_t* ints, const dynamic_array_t* tracks,
+        const std::vector<int>& expected)
+    {
+        const int* int_values = (const int*)ints->array;
+        const tracked* tracked_values = (const tracked*)tracks->array;
+        bool ok =
+            expected.size() == ints->elements
+         && expected.size() == tracks->elements
+         && (int)expected.size() == counts.live;
+
+        for (size_t i = 0; ok && i < expected.size(); ++i)
+        {
+            ok =
+                expected[i] == int_values[i]
+             && expected[i] == tracked_values[i].value
+             && &tracked_values[i] == tracked_values[i].self;
+        }
+
+        return ok;
+    }
+
+    element_counts counts;
+    bool growth_status;
+    int int_status;
+    int tracked_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t int_options;
+    dynamic_array_options_t tracked_options;
+};
+
+TEST_SUITE(dynamic_array_erase_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_erase_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Erasing a range disposes its elements and moves the following elements down
+ * in order.
+ */
+BEGIN_TEST_F(erase_range)
+    dynamic_array_t ints, tracks;
+    TEST_ASSERT(fixture.create(&ints, &tracks, 10));
+
+    /* erase from the middle, the front, the end, and nothing at all. */
+    const size_t ranges[][2] = { { 3, 6 }, { 0, 2 }, { 3, 5 }, { 1, 1 } };
+    std::vector<int> expected = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    for (const size_t* range : ranges)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_erase_range(&ints, range[0], range[1]));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_erase_range(&tracks, range[0], range[1]));
+        expected.erase(
+            expected.begin() + range[0], expected.begin() + range[1]);
+        TEST_EXPECT(fixture.holds(&ints, &tracks, expected));
+    }
+
+    /* ranges outside the array are rejected. */
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX
+            == dynamic_array_erase_range(&ints, 2, 1));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX
+            == dynamic_array_erase_range(&tracks, 0, expected.size() + 1));
+
+    dispose(dynamic_array_disposable_handle(&ints));
+    dispose(dynamic_array_disposable_handle(&tracks));
+    TEST_EXPECT(0 == fixture.counts.live);
+END_TEST_F()
+
+/**
+ * Swap removing an element moves the last element into its place.
+ */
+BEGIN_TEST_F(swap_remove)
+    dynamic_array_t ints, tracks;
+    TEST_ASSERT(fixture.create(&ints, &tracks, 5));
+
+    /* remove from the middle, then remove the last element. */
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_swap_remove(&ints, 1));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_swap_remove(&tracks, 1));
+    TEST_EXPECT(fixture.holds(&ints, &tracks, { 0, 4, 2, 3 }));
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_swap_remove(&ints, 3));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_swap_remove(&tracks, 3));
+    TEST_EXPECT(fixture.holds(&ints, &tracks, { 0, 4, 2 }));
+
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_INVALID_INDEX
+            == dynamic_array_swap_remove(&ints, 3));
+
+    dispose(dynamic_array_disposable_handle(&ints));
+    dispose(dynamic_array_disposable_handle(&tracks));
+    TEST_EXPECT(0 == fixture.counts.live);
+END_TEST_F()
+
+/**
+ * Truncating an array disposes the elements past the new end, and leaves a
+ * shorter array unchanged.
+ */
+BEGIN_TEST_F(truncate)
+    dynamic_array_t ints, tracks;
+    TEST_ASSERT(fixture.create(&ints, &tracks, 5));
+    size_t reserved = ints.reserved_elements;
+
+    dynamic_array_truncate(&ints, 2);
+    dynamic_array_truncate(&tracks, 2);
+    TEST_EXPECT(fixture.holds(&ints, &tracks, { 0, 1 }));
+    TEST_EXPECT(reserved == ints.reserved_elements);
+
+    dynamic_array_truncate(&ints, 3);
+    dynamic_array_truncate(&tracks, 3);
+    TEST_EXPECT(fixture.holds(&ints, &tracks, { 0, 1 }));
+
+    dispose(dynamic_array_disposable_handle(&ints));
+    dispose(dynamic_array_disposable_handle(&tracks));
+    TEST_EXPECT(0 == fixture.counts.live);
+END_TEST_F()
@@ -0,0 +1,194 @@
+/**
+ * \file test_dynamic_array_find_all.cpp
+ *
+ * Unit tests for dynamic_array_find_all and dynamic_array_count, and for the
+ * bytewise scan behind dynamic_array_linear_search.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <algorithm>
+#include <string.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+/**
+ * Compare uint32_t values through a method which is not one of the built-in
+ * ones.
+ */
+static int compare_uint32_generic(const void* x, const void* y, size_t size)
+{
+    return compare_uint32(x, y, size);
+}
+
+class dynamic_array_find_all_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+    }
+
+    void tearDown()
+    {
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Check the searches of an array of elements of the given size against a
+     * byte by byte comparison.  Most elements differ from the key in a single
+     * byte, and the matches fall at the start and end of the array and on
+     * either side of the boundaries between blocks of elements.
+     */
+    bool searches_match(size_t size, compare_method_t compare)
+    {
+        const size_t count = 203;
+        const size_t matches[] = { 0, 15, 16, 63, 64, 100, 128, 202 };
+        dynamic_array_options_t options;
+        dynamic_array_t array;
+        bool match = true;
+
+        std::vector<uint8_t> key(size);
+        for (size_t b = 0; b < size; ++b)
+        {
+            key[b] = (uint8_t)(0xA5 + 17 * b);
+        }
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_options_init(
+                        &options, &alloc_opts, size, compare))
+        {
+            return false;
+        }
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(&options, &array, count, 0, NULL))
+        {
+            dispose(dynamic_array_options_disposable_handle(&options));
+            return false;
+        }
+
+        std::vector<uint8_t> elem(size);
+        for (size_t i = 0; i < count; ++i)
+        {
+            elem = key;
+            if (
+                std::end(matches)
+                    == std::find(std::begin(matches), std::end(matches), i))
+            {
+                elem[i % size] ^= (uint8_t)(1 + i % 255);
+            }
+
+            match = match
+                && VPR_STATUS_SUCCESS
+                    == dynamic_array_append(&array, elem.data());
+        }
+
+        /* find the matches byte by byte. */
+        std::vector<size_t> expected;
+        const uint8_t* bytes = (const uint8_t*)array.array;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (0 == memcmp(bytes + i * size, key.data(), size))
+            {
+                expected.push_back(i);
+            }
+        }
+
+        std::vector<size_t> indices(count);
+        size_t found =
+            dynamic_array_find_all(
+                &array, NULL, key.data(), indices.data(), indices.size());
+        indices.resize(found < count ? found : count);
+
+        /* a short capacity still counts every match. */
+        size_t first = count;
+        size_t partial =
+            dynamic_array_find_all(&array, NULL, key.data(), &first, 1);
+
+        match = match
+            && expected == indices
+            && expected.size() == partial
+            && expected[0] == first
+            && expected.size()
+                == dynamic_array_count(&array, NULL, key.data())
+            && bytes + expected[0] * size
+                == dynamic_array_linear_search(&array, NULL, key.data());
+
+        dispose(dynamic_array_disposable_handle(&array));
+        dispose(dynamic_array_options_disposable_handle(&options));
+
+        return match;
+    }
+
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(dynamic_array_find_all_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_find_all_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test searches with built-in integer comparison methods, with compare_bytes,
+ * and with a custom comparison method.
+ */
+BEGIN_TEST_F(element_sizes)
+    TEST_EXPECT(fixture.searches_match(sizeof(uint8_t), &compare_uint8));
+    TEST_EXPECT(fixture.searches_match(sizeof(int16_t), &compare_int16));
+    TEST_EXPECT(fixture.searches_match(sizeof(uint32_t), &compare_uint32));
+    TEST_EXPECT(fixture.searches_match(sizeof(int64_t), &compare_int64));
+    TEST_EXPECT(fixture.searches_match(16, &compare_bytes));
+    TEST_EXPECT(fixture.searches_match(3, &compare_bytes));
+    TEST_EXPECT(fixture.searches_match(40, &compare_bytes));
+    TEST_EXPECT(
+        fixture.searches_match(sizeof(uint32_t), &compare_uint32_generic));
+END_TEST_F()
+
+/**
+ * Test that floating point searches use the comparison method rather than
+ * comparing bytes, so that 0.0 matches -0.0.
+ */
+BEGIN_TEST_F(float_equality)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    double NEGATIVE_ZERO = -0.0;
+    double ONE = 1.0;
+    double ZERO = 0.0;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &options, &fixture.alloc_opts, sizeof(double),
+                    &compare_double));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, 100, 99, &ONE));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == dynamic_array_append(&array, &NEGATIVE_ZERO));
+
+    size_t index = 0;
+    TEST_EXPECT(1 == dynamic_array_find_all(&array, NULL, &ZERO, &index, 1));
+    TEST_EXPECT(99 == index);
+    TEST_EXPECT(99 == dynamic_array_count(&array, NULL, &ONE));
+    TEST_EXPECT(
+        (double*)array.array + 99
+            == dynamic_array_linear_search(&array, NULL, &ZERO));
+
+    /* compare_bytes distinguishes the two zeros. */
+    TEST_EXPECT(0 == dynamic_array_count(&array, &compare_bytes, &ZERO));
+
+    dispose(dynamic_array_disposable_handle(&array));
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
@@ -7,10 +7,13 @@
  */
 
 #include <minunit/minunit.h>
+#include <string.h>
 #include <vpr/allocator/malloc_allocator.h>
 #include <vpr/compare.h>
 #include <vpr/dynamic_array.h>
 
+#include "counted_element.h"
+
 class dynamic_array_grow_test {
 public:
     void setUp()
@@ -152,3 +155,70 @@ BEGIN_TEST_F(grow_copy)
     //dispose the array
     dispose(dynamic_array_disposable_handle(&array));
 END_TEST_F()
+
+/**
+ * POD options are trivially copyable, and custom options are not.
+ */
+BEGIN_TEST_F(trivially_copyable_flag)
+    TEST_EXPECT(fixture.options.trivially_copyable);
+
+    element_counts counts;
+    dynamic_array_options_t custom;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &custom, &fixture.alloc_opts, sizeof(int), &counts,
+                    &counting_copy, &counting_dispose, &compare_int));
+    TEST_EXPECT(!custom.trivially_copyable);
+
+    dispose(dynamic_array_options_disposable_handle(&custom));
+END_TEST_F()
+
+/**
+ * Growing an array of trivially copyable elements preserves them without
+ * calling the copy or dispose methods.
+ */
+BEGIN_TEST_F(grow_trivially_copyable)
+    element_counts counts;
+    dynamic_array_options_t custom;
+    dynamic_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &custom, &fixture.alloc_opts, sizeof(int), &counts,
+                    &counting_copy, &counting_dispose, &compare_int));
+
+    //with the flag clear, each element is copied and then disposed
+    for (int i = 0; i < 2; ++i)
+    {
+        counts = element_counts();
+        custom.trivially_copyable = (1 == i);
+
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_init(&custom, &array, 1000, 0, NULL));
+        for (int j = 0; j < 1000; ++j)
+        {
+            TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&array, &j));
+        }
+
+        counts = element_counts();
+        TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_grow(&array, 100000));
+        TEST_EXPECT(
+            (0 == i ? 2000 : 0) == counts.copies + counts.disposes);
+        TEST_EXPECT((size_t)100000 == array.reserved_elements);
+
+        bool preserved = true;
+        int* intArr = (int*)array.array;
+        for (int j = 0; j < 1000; ++j)
+        {
+            preserved = preserved && j == intArr[j];
+        }
+        TEST_EXPECT(preserved);
+
+        dispose(dynamic_array_disposable_handle(&array));
+    }
+
+    dispose(dynamic_array_options_disposable_handle(&custom));
+END_TEST_F()
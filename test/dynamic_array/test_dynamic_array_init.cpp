@@ -71,3 +71,26 @@ BEGIN_TEST_F(basic_test)
     //dispose of our array
     dispose(dynamic_array_disposable_handle(&array));
 END_TEST_F()
+
+/**
+ * Test that many instances of a trivially copyable element are filled in.
+ */
+BEGIN_TEST_F(many_instances)
+    int SEVENTEEN = 17;
+    dynamic_array_t array;
+
+    TEST_ASSERT(
+        0 == dynamic_array_init(
+                &fixture.options, &array, 1000, 999, &SEVENTEEN));
+    TEST_EXPECT((size_t)999 == array.elements);
+
+    bool all_set = true;
+    const int* intarr = (const int*)array.array;
+    for (int i = 0; i < 999; ++i)
+    {
+        all_set = all_set && SEVENTEEN == intarr[i];
+    }
+    TEST_EXPECT(all_set);
+
+    dispose(dynamic_array_disposable_handle(&array));
+END_TEST_F()
@@ -0,0 +1,184 @@
+/**
+ * \file test_dynamic_array_init_inline.cpp
+ *
+ * Unit tests for dynamic_array_init_inline.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+#include "counted_element.h"
+
+class dynamic_array_init_inline_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        int_status =
+            dynamic_array_options_init(
+                &int_options, &alloc_opts, sizeof(int), &compare_int);
+        tracked_status =
+            dynamic_array_options_init_ex(
+                &tracked_options, &alloc_opts, sizeof(tracked), &counts,
+                &tracked_copy, &tracked_dispose, &compare_tracked);
+
+        /* let the arrays grow past their inline storage. */
+        growth_status =
+            VPR_STATUS_SUCCESS == int_status
+         && VPR_STATUS_SUCCESS == tracked_status
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(&int_options, 2)
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(
+                        &tracked_options, 2);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == int_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&int_options));
+        }
+        if (VPR_STATUS_SUCCESS == tracked_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&tracked_options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Check that a tracked array holds the values 0 to count, and that every
+     * element was moved with the copy method and is live exactly once.
+     */
+    bool holds(const dynamic_array_t* tracks, int count)
+    {
+        const tracked* values = (const tracked*)tracks->array;
+        bool ok = (size_t)count == tracks->elements && count == counts.live;
+
+        for (int i = 0; ok && i < count; ++i)
+        {
+            ok = i == values[i].value && &values[i] == values[i].self;
+        }
+
+        return ok;
+    }
+
+    element_counts counts;
+    bool growth_status;
+    int int_status;
+    int tracked_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t int_options;
+    dynamic_array_options_t tracked_options;
+};
+
+TEST_SUITE(dynamic_array_init_inline_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_init_inline_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Storage which cannot hold a single element is rejected.
+ */
+BEGIN_TEST_F(storage_too_small)
+    dynamic_array_t array;
+    uint16_t storage;
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.int_status);
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_INLINE_STORAGE_TOO_SMALL
+            == dynamic_array_init_inline(
+                    &fixture.int_options, &array, &storage, sizeof(storage)));
+END_TEST_F()
+
+/**
+ * Elements stay in the inline storage until it is full, then move to an
+ * allocated buffer, and move back when the array is shrunk.
+ */
+BEGIN_TEST_F(spill_and_shrink)
+    DYNAMIC_ARRAY_WITH_INLINE_STORAGE(int, 8) ints;
+
+    TEST_ASSERT(fixture.growth_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init_inline(
+                    &fixture.int_options, &ints.array, ints.storage,
+                    sizeof(ints.storage)));
+    TEST_EXPECT(0U == ints.array.elements);
+    TEST_EXPECT(8U == ints.array.reserved_elements);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == dynamic_array_append(&ints.array, &i));
+    }
+    TEST_EXPECT((void*)ints.storage == ints.array.array);
+
+    for (int i = 8; i < 20; ++i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == dynamic_array_append(&ints.array, &i));
+    }
+    TEST_EXPECT((void*)ints.storage != ints.array.array);
+    TEST_EXPECT(20U == ints.array.elements);
+    for (int i = 0; i < 20; ++i)
+    {
+        TEST_EXPECT(i == ((int*)ints.array.array)[i]);
+    }
+
+    dynamic_array_truncate(&ints.array, 5);
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_shrink_to_fit(&ints.array));
+    TEST_EXPECT((void*)ints.storage == ints.array.array);
+    TEST_EXPECT(8U == ints.array.reserved_elements);
+    for (int i = 0; i < 5; ++i)
+    {
+        TEST_EXPECT(i == ints.storage[i]);
+    }
+
+    dispose(dynamic_array_disposable_handle(&ints.array));
+END_TEST_F()
+
+/**
+ * Elements with a copy method are moved with it into and out of the inline
+ * storage, and are disposed with the array.
+ */
+BEGIN_TEST_F(copy_and_dispose)
+    DYNAMIC_ARRAY_WITH_INLINE_STORAGE(tracked, 4) tracks;
+
+    TEST_ASSERT(fixture.growth_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init_inline(
+                    &fixture.tracked_options, &tracks.array, tracks.storage,
+                    sizeof(tracks.storage)));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        tracked elem;
+        tracked_init(&elem, i);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == dynamic_array_append(&tracks.array, &elem));
+    }
+    TEST_EXPECT((void*)tracks.storage != tracks.array.array);
+    TEST_EXPECT(fixture.holds(&tracks.array, 10));
+
+    dynamic_array_truncate(&tracks.array, 3);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == dynamic_array_shrink_to_fit(&tracks.array));
+    TEST_EXPECT((void*)tracks.storage == tracks.array.array);
+    TEST_EXPECT(fixture.holds(&tracks.array, 3));
+
+    dispose(dynamic_array_disposable_handle(&tracks.array));
+    TEST_EXPECT(0 == fixture.counts.live);
+END_TEST_F()
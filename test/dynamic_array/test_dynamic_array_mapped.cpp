@@ -0,0 +1,216 @@
+/**
+ * \file test_dynamic_array_mapped.cpp
+ *
+ * Unit tests for dynamic_array_mapped_init and dynamic_array_mapped_sync.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array/dynamic_array_mapped.h>
+
+/**
+ * Copy method which copies the bytes of an element.
+ */
+static void byte_copy(
+    void*, void* destination, const void* source, size_t size)
+{
+    memcpy(destination, source, size);
+}
+
+/**
+ * Dispose method which does nothing.
+ */
+static void no_dispose(void*, void*)
+{
+}
+
+class dynamic_array_mapped_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        options_status =
+            dynamic_array_options_init(
+                &options, &alloc_opts, sizeof(int), &compare_int);
+        growth_status =
+            VPR_STATUS_SUCCESS == options_status
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(&options, 2);
+
+        strcpy(path, "/tmp/test_dynamic_array_mapped_XXXXXX");
+        int fd = mkstemp(path);
+        path_status = fd >= 0;
+        if (path_status)
+        {
+            close(fd);
+        }
+    }
+
+    void tearDown()
+    {
+        if (path_status)
+        {
+            unlink(path);
+        }
+        if (VPR_STATUS_SUCCESS == options_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Check that an array holds the values count - 1 down to 0.
+     */
+    static bool descending(const dynamic_array_t* array, int count)
+    {
+        const int* values = (const int*)array->array;
+        bool ok = (size_t)count == array->elements;
+
+        for (int i = 0; ok && i < count; ++i)
+        {
+            ok = count - 1 - i == values[i];
+        }
+
+        return ok;
+    }
+
+    bool path_status;
+    bool growth_status;
+    int options_status;
+    char path[64];
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t options;
+};
+
+TEST_SUITE(dynamic_array_mapped_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_mapped_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Elements appended to a mapped array grow its file, are still there when the
+ * file is reopened, and can be appended to again.
+ */
+BEGIN_TEST_F(append_and_reopen)
+    dynamic_array_mapped_t mapped;
+
+    TEST_ASSERT(fixture.path_status);
+    TEST_ASSERT(fixture.growth_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_mapped_init(
+                    &mapped, &fixture.options, fixture.path, 4));
+    TEST_EXPECT(0U == mapped.array.elements);
+
+    /* appending 5000 elements remaps the file several times. */
+    for (int i = 4999; i >= 0; --i)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == dynamic_array_append(&mapped.array, &i));
+    }
+    TEST_EXPECT(fixture.descending(&mapped.array, 5000));
+    TEST_EXPECT(VPR_STATUS_SUCCESS == dynamic_array_mapped_sync(&mapped));
+
+    dispose(dynamic_array_mapped_disposable_handle(&mapped));
+
+    /* the file is trimmed to its elements. */
+    FILE* file = fopen(fixture.path, "rb");
+    TEST_ASSERT(NULL != file);
+    fseek(file, 0, SEEK_END);
+    TEST_EXPECT(
+        DYNAMIC_ARRAY_MAPPED_HEADER_SIZE + 5000 * sizeof(int)
+            == (size_t)ftell(file));
+    fclose(file);
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_mapped_init(
+                    &mapped, &fixture.options, fixture.path, 0));
+    TEST_EXPECT(fixture.descending(&mapped.array, 5000));
+
+    /* sorting uses the caller's allocator for its scratch buffer. */
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_sort(&mapped.array));
+    int value = 5000;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == dynamic_array_append(&mapped.array, &value));
+    dispose(dynamic_array_mapped_disposable_handle(&mapped));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_mapped_init(
+                    &mapped, &fixture.options, fixture.path, 0));
+    TEST_ASSERT(5001U == mapped.array.elements);
+    const int* values = (const int*)mapped.array.array;
+    for (int i = 0; i <= 5000; ++i)
+    {
+        TEST_EXPECT(i == values[i]);
+    }
+
+    dispose(dynamic_array_mapped_disposable_handle(&mapped));
+END_TEST_F()
+
+/**
+ * Only trivially copyable elements may be mapped, and a file must hold an
+ * array of elements of the expected size.
+ */
+BEGIN_TEST_F(invalid)
+    dynamic_array_mapped_t mapped;
+    dynamic_array_options_t copying_options, wide_options;
+
+    TEST_ASSERT(fixture.path_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &copying_options, &fixture.alloc_opts, sizeof(int), NULL,
+                    &byte_copy, &no_dispose, &compare_int));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_MAPPED_NOT_TRIVIALLY_COPYABLE
+            == dynamic_array_mapped_init(
+                    &mapped, &copying_options, fixture.path, 0));
+
+    /* a file which is not an array. */
+    FILE* file = fopen(fixture.path, "wb");
+    TEST_ASSERT(NULL != file);
+    fputs("not a dynamic array", file);
+    fclose(file);
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_MAPPED_INVALID_FORMAT
+            == dynamic_array_mapped_init(
+                    &mapped, &fixture.options, fixture.path, 0));
+
+    /* an array of a different element size. */
+    unlink(fixture.path);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_mapped_init(
+                    &mapped, &fixture.options, fixture.path, 16));
+    dispose(dynamic_array_mapped_disposable_handle(&mapped));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &wide_options, &fixture.alloc_opts, sizeof(int64_t),
+                    &compare_int64));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_MAPPED_INVALID_FORMAT
+            == dynamic_array_mapped_init(
+                    &mapped, &wide_options, fixture.path, 0));
+
+    dispose(dynamic_array_options_disposable_handle(&wide_options));
+    dispose(dynamic_array_options_disposable_handle(&copying_options));
+END_TEST_F()
@@ -0,0 +1,288 @@
+/**
+ * \file test_dynamic_array_nth_element.cpp
+ *
+ * Unit tests for dynamic_array_nth_element and dynamic_array_partial_sort.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <minunit/minunit.h>
+#include <random>
+#include <string.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+#include "counted_element.h"
+
+using namespace std;
+
+/**
+ * Compare two integers in descending order.
+ */
+static int compare_int_descending(
+    const void* left, const void* right, size_t size)
+{
+    return compare_int(right, left, size);
+}
+
+class dynamic_array_nth_element_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        ascending_status =
+            dynamic_array_options_init(
+                &ascending, &alloc_opts, sizeof(int), &compare_int);
+        descending_status =
+            dynamic_array_options_init(
+                &descending, &alloc_opts, sizeof(int),
+                &compare_int_descending);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == ascending_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&ascending));
+        }
+        if (VPR_STATUS_SUCCESS == descending_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&descending));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Build input patterns which are known to trouble quickselects.
+     */
+    static vector<vector<int>> patterns(size_t count)
+    {
+        vector<vector<int>> result;
+        mt19937 rng(12345);
+
+        vector<int> random(count), few(count), sorted(count), pipe(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            random[i] = (int)rng();
+            few[i] = (int)(rng() % 4);
+            sorted[i] = (int)i;
+            pipe[i] = (int)(i < count / 2 ? i : count - i);
+        }
+
+        result.push_back(random);
+        result.push_back(few);
+        result.push_back(sorted);
+        result.push_back(vector<int>(sorted.rbegin(), sorted.rend()));
+        result.push_back(pipe);
+        result.push_back(vector<int>(count, 7));
+
+        return result;
+    }
+
+    /**
+     * Fill a dynamic array with the given values.
+     */
+    bool fill(
+        dynamic_array_options_t* options, dynamic_array_t* array,
+        vector<int>& values)
+    {
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(
+                        options, array, values.size(), 0, NULL))
+        {
+            return false;
+        }
+
+        for (int& value : values)
+        {
+            if (VPR_STATUS_SUCCESS != dynamic_array_append(array, &value))
+            {
+                dispose(dynamic_array_disposable_handle(array));
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int ascending_status;
+    int descending_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t ascending;
+    dynamic_array_options_t descending;
+};
+
+TEST_SUITE(dynamic_array_nth_element_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_nth_element_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * The element at the index is the one a sort would put there, with no greater
+ * element before it and no lesser element after it.
+ */
+BEGIN_TEST_F(nth_element)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.ascending_status);
+
+    for (size_t count : { 1, 5, 24, 25, 200, 5000 })
+    {
+        for (vector<int>& values : fixture.patterns(count))
+        {
+            vector<int> sorted = values;
+            sort(sorted.begin(), sorted.end());
+
+            for (size_t index : { (size_t)0, count / 3, count - 1, count })
+            {
+                dynamic_array_t array;
+                TEST_ASSERT(fixture.fill(&fixture.ascending, &array, values));
+
+                TEST_ASSERT(
+                    VPR_STATUS_SUCCESS
+                        == dynamic_array_nth_element(&array, index));
+
+                /* an index past the end leaves the array unchanged. */
+                int* arr = (int*)array.array;
+                if (index >= count)
+                {
+                    TEST_EXPECT(equal(values.begin(), values.end(), arr));
+                }
+                else
+                {
+                    int nth = arr[index];
+                    TEST_EXPECT(sorted[index] == nth);
+                    TEST_EXPECT(
+                        all_of(arr, arr + index, [=](int x) {
+                            return x <= nth; }));
+                    TEST_EXPECT(
+                        all_of(arr + index, arr + count, [=](int x) {
+                            return x >= nth; }));
+                }
+
+                dispose(dynamic_array_disposable_handle(&array));
+            }
+        }
+    }
+END_TEST_F()
+
+/**
+ * The first elements are the least elements in sorted order, and the rest of
+ * the elements are kept.
+ */
+BEGIN_TEST_F(partial_sort)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.ascending_status);
+
+    for (vector<int>& values : fixture.patterns(5000))
+    {
+        vector<int> sorted = values;
+        sort(sorted.begin(), sorted.end());
+
+        for (size_t count : { 0, 1, 100, 4999, 5000, 6000 })
+        {
+            dynamic_array_t array;
+            TEST_ASSERT(fixture.fill(&fixture.ascending, &array, values));
+
+            TEST_ASSERT(
+                VPR_STATUS_SUCCESS
+                    == dynamic_array_partial_sort(&array, count));
+
+            int* arr = (int*)array.array;
+            size_t sorted_count = min(count, values.size());
+            TEST_EXPECT(equal(arr, arr + sorted_count, sorted.begin()));
+
+            vector<int> rest(arr, arr + values.size());
+            sort(rest.begin(), rest.end());
+            TEST_EXPECT(rest == sorted);
+
+            dispose(dynamic_array_disposable_handle(&array));
+        }
+    }
+END_TEST_F()
+
+/**
+ * A comparison method which reverses the order selects the greatest elements.
+ */
+BEGIN_TEST_F(partial_sort_greatest)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.descending_status);
+
+    vector<int> values = fixture.patterns(10000)[0];
+    vector<int> sorted = values;
+    sort(sorted.begin(), sorted.end(), greater<int>());
+
+    dynamic_array_t array;
+    TEST_ASSERT(fixture.fill(&fixture.descending, &array, values));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == dynamic_array_partial_sort(&array, 100));
+
+    int* arr = (int*)array.array;
+    TEST_EXPECT(equal(arr, arr + 100, sorted.begin()));
+
+    dispose(dynamic_array_disposable_handle(&array));
+END_TEST_F()
+
+/**
+ * Elements which are not trivially copyable are moved with the copy and
+ * dispose methods.
+ */
+BEGIN_TEST_F(copy_methods)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    element_counts counts;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &options, &fixture.alloc_opts, sizeof(tracked), &counts,
+                    &tracked_copy, &tracked_dispose, &compare_tracked));
+
+    vector<int> values = fixture.patterns(5000)[0];
+    vector<int> sorted = values;
+    sort(sorted.begin(), sorted.end());
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, values.size(), 0, NULL));
+    for (int value : values)
+    {
+        tracked element;
+        tracked_init(&element, value);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == dynamic_array_append(&array, &element));
+    }
+
+    tracked* arr = (tracked*)array.array;
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_nth_element(&array, 2500));
+    TEST_EXPECT(sorted[2500] == arr[2500].value);
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_partial_sort(&array, 100));
+    bool prefix_sorted = true;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        prefix_sorted = prefix_sorted && sorted[i] == arr[i].value;
+    }
+    TEST_EXPECT(prefix_sorted);
+
+    bool fixed_up = true;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        fixed_up = fixed_up && arr[i].self == &arr[i];
+    }
+    TEST_EXPECT(fixed_up);
+    TEST_EXPECT((int)values.size() == counts.live);
+
+    dispose(dynamic_array_disposable_handle(&array));
+    TEST_EXPECT(0 == counts.live);
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
@@ -0,0 +1,357 @@
+/**
+ * \file test_dynamic_array_radix_sort.cpp
+ *
+ * Unit tests for dynamic_array_radix_sort and
+ * dynamic_array_radix_sort_normalized.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <algorithm>
+#include <minunit/minunit.h>
+#include <random>
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/dynamic_array.h>
+
+#include "counted_element.h"
+
+using namespace std;
+
+/**
+ * A record with keys of each kind.
+ */
+struct record
+{
+    uint8_t uuid[16];
+    int64_t balance;
+    uint32_t id;
+    int16_t branch;
+    float score;
+};
+
+class dynamic_array_radix_sort_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        options_init_status =
+            dynamic_array_options_init(
+                &options, &alloc_opts, sizeof(record), NULL);
+        if (VPR_STATUS_SUCCESS == options_init_status)
+        {
+            init_status =
+                dynamic_array_init(&options, &array, 50000, 0, NULL);
+        }
+
+        /* few distinct values per key, so that stability matters. */
+        mt19937 rng(2026);
+        records.resize(50000);
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            record& r = records[i];
+            memset(&r, 0, sizeof(r));
+            for (auto& b : r.uuid)
+            {
+                b = (uint8_t)(rng() % 4);
+            }
+            r.balance = (int64_t)(rng() % 200) - 100;
+            r.balance *= INT64_C(10000000000);
+            r.id = (uint32_t)i;
+            r.branch = (int16_t)((int)(rng() % 20) - 10);
+            r.score = (float)((int)(rng() % 40) - 20) / 4.0f;
+        }
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == init_status)
+        {
+            dispose(dynamic_array_disposable_handle(&array));
+        }
+        if (VPR_STATUS_SUCCESS == options_init_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Reset the array to the unsorted records.
+     */
+    void reset()
+    {
+        memcpy(array.array, records.data(), records.size() * sizeof(record));
+        array.elements = records.size();
+    }
+
+    /**
+     * Check that the array matches the records after a stable sort with the
+     * given less-than method.
+     */
+    template <typename Less>
+    bool matches(Less less)
+    {
+        vector<record> expected = records;
+        stable_sort(expected.begin(), expected.end(), less);
+
+        return
+            0 == memcmp(
+                    expected.data(), array.array,
+                    expected.size() * sizeof(record));
+    }
+
+    int options_init_status;
+    int init_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    vector<record> records;
+};
+
+TEST_SUITE(dynamic_array_radix_sort_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_radix_sort_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test a stable sort by a key of each kind.
+ */
+BEGIN_TEST_F(key_kinds)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.init_status);
+
+    fixture.reset();
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_radix_sort(
+                    &fixture.array, offsetof(record, uuid), 16,
+                    DYNAMIC_ARRAY_RADIX_KEY_BYTES));
+    TEST_EXPECT(
+        fixture.matches([](const record& x, const record& y) {
+            return memcmp(x.uuid, y.uuid, 16) < 0; }));
+
+    fixture.reset();
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_radix_sort(
+                    &fixture.array, offsetof(record, balance), 8,
+                    DYNAMIC_ARRAY_RADIX_KEY_SIGNED));
+    TEST_EXPECT(
+        fixture.matches([](const record& x, const record& y) {
+            return x.balance < y.balance; }));
+
+    fixture.reset();
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_radix_sort(
+                    &fixture.array, offsetof(record, branch), 2,
+                    DYNAMIC_ARRAY_RADIX_KEY_SIGNED));
+    TEST_EXPECT(
+        fixture.matches([](const record& x, const record& y) {
+            return x.branch < y.branch; }));
+
+    fixture.reset();
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_radix_sort(
+                    &fixture.array, offsetof(record, score), 4,
+                    DYNAMIC_ARRAY_RADIX_KEY_FLOAT));
+    TEST_EXPECT(
+        fixture.matches([](const record& x, const record& y) {
+            return x.score < y.score; }));
+END_TEST_F()
+
+/**
+ * Test that sorting by a secondary key and then by a primary key sorts by
+ * both.
+ */
+BEGIN_TEST_F(chained_keys)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.init_status);
+
+    fixture.reset();
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_radix_sort(
+                    &fixture.array, offsetof(record, id), 4,
+                    DYNAMIC_ARRAY_RADIX_KEY_UNSIGNED));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_radix_sort(
+                    &fixture.array, offsetof(record, branch), 2,
+                    DYNAMIC_ARRAY_RADIX_KEY_SIGNED));
+
+    TEST_EXPECT(
+        fixture.matches([](const record& x, const record& y) {
+            return x.branch < y.branch; }));
+END_TEST_F()
+
+/**
+ * Normalize a record to its branch, in descending order, then its uuid.
+ */
+static void normalize_record(void*, const void* element, uint8_t* key)
+{
+    const record* r = (const record*)element;
+    uint16_t branch = (uint16_t)(0x7FFF - r->branch);
+
+    key[0] = (uint8_t)(branch >> 8);
+    key[1] = (uint8_t)branch;
+    memcpy(key + 2, r->uuid, 16);
+}
+
+/**
+ * Test a sort by a normalized key.
+ */
+BEGIN_TEST_F(normalized)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.init_status);
+
+    fixture.reset();
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_radix_sort_normalized(
+                    &fixture.array, 18, &normalize_record, NULL));
+    TEST_EXPECT(
+        fixture.matches([](const record& x, const record& y) {
+            if (x.branch != y.branch)
+            {
+                return x.branch > y.branch;
+            }
+            return memcmp(x.uuid, y.uuid, 16) < 0; }));
+
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY
+            == dynamic_array_radix_sort_normalized(
+                    &fixture.array, 0, &normalize_record, NULL));
+END_TEST_F()
+
+/**
+ * Test that keys which do not fit or do not suit their kind are rejected.
+ */
+BEGIN_TEST_F(invalid_keys)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.init_status);
+
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY
+            == dynamic_array_radix_sort(
+                    &fixture.array, sizeof(record) - 4, 8,
+                    DYNAMIC_ARRAY_RADIX_KEY_UNSIGNED));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY
+            == dynamic_array_radix_sort(
+                    &fixture.array, 0, 3, DYNAMIC_ARRAY_RADIX_KEY_SIGNED));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY
+            == dynamic_array_radix_sort(
+                    &fixture.array, 0, 2, DYNAMIC_ARRAY_RADIX_KEY_FLOAT));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY
+            == dynamic_array_radix_sort(&fixture.array, 0, 4, 17));
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_RADIX_SORT_INVALID_KEY
+            == dynamic_array_radix_sort(
+                    &fixture.array, 0, 0, DYNAMIC_ARRAY_RADIX_KEY_BYTES));
+END_TEST_F()
+
+/**
+ * Normalize a tracked element to its value, in descending order.
+ */
+static void normalize_tracked(void*, const void* element, uint8_t* key)
+{
+    uint32_t value = (uint32_t)((const tracked*)element)->value ^ 0x80000000;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        key[i] = (uint8_t)~(value >> (24 - 8 * i));
+    }
+}
+
+/**
+ * Test that elements which are not trivially copyable are moved with the copy
+ * and dispose methods by both radix sorts, through the scratch buffer and
+ * back.
+ */
+BEGIN_TEST_F(copy_methods)
+    const int count = 1000;
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    mt19937 rng(4812);
+    element_counts counts;
+    counts.poison = true;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &options, &fixture.alloc_opts, sizeof(tracked), &counts,
+                    &tracked_copy, &tracked_dispose, &compare_tracked));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, count, 0, NULL));
+
+    for (bool normalized : { false, true })
+    {
+        dynamic_array_truncate(&array, 0);
+        for (int i = 0; i < count; ++i)
+        {
+            tracked value;
+            tracked_init(&value, (int)(rng() % 50) - 25, i);
+            TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+        }
+
+        counts.copies = 0;
+        counts.disposes = 0;
+        if (normalized)
+        {
+            TEST_ASSERT(
+                VPR_STATUS_SUCCESS
+                    == dynamic_array_radix_sort_normalized(
+                            &array, 4, &normalize_tracked, NULL));
+        }
+        else
+        {
+            TEST_ASSERT(
+                VPR_STATUS_SUCCESS
+                    == dynamic_array_radix_sort(
+                            &array, offsetof(tracked, value), sizeof(int),
+                            DYNAMIC_ARRAY_RADIX_KEY_SIGNED));
+        }
+
+        bool sorted = true;
+        bool stable = true;
+        bool fixed_up = true;
+        tracked* values = (tracked*)array.array;
+        for (int i = 0; i < count; ++i)
+        {
+            fixed_up = fixed_up && values[i].self == &values[i];
+            if (i > 0)
+            {
+                int x = values[i - 1].value;
+                int y = values[i].value;
+                if (normalized)
+                {
+                    swap(x, y);
+                }
+                sorted = sorted && x <= y;
+                stable = stable
+                    && (x < y || values[i - 1].position < values[i].position);
+            }
+        }
+        TEST_EXPECT(sorted);
+        TEST_EXPECT(stable);
+        TEST_EXPECT(fixed_up);
+        TEST_EXPECT(2 * count == counts.copies);
+        TEST_EXPECT(2 * count == counts.disposes);
+        TEST_EXPECT(count == counts.live);
+    }
+
+    dispose(dynamic_array_disposable_handle(&array));
+    TEST_EXPECT(0 == counts.live);
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
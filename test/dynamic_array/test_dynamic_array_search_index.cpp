@@ -0,0 +1,170 @@
+/**
+ * \file test_dynamic_array_search_index.cpp
+ *
+ * Unit tests for dynamic_array_search_index_init and
+ * dynamic_array_search_index_find.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+class dynamic_array_search_index_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+    }
+
+    void tearDown()
+    {
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(dynamic_array_search_index_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_search_index_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * A value with a key and a payload.
+ */
+struct keyed_value
+{
+    int64_t key;
+    char payload[20];
+};
+
+/**
+ * Compare keyed values by key only.
+ */
+static int compare_keyed_value(const void* x, const void* y, size_t)
+{
+    return compare_int64(
+        &((const keyed_value*)x)->key, &((const keyed_value*)y)->key,
+        sizeof(int64_t));
+}
+
+/**
+ * Test that an index over signed integers finds the same elements as a binary
+ * search, and finds no missing keys.
+ */
+BEGIN_TEST_F(integer_keys)
+    for (int count : { 0, 1, 2, 7, 8, 1000, 4095 })
+    {
+        dynamic_array_options_t options;
+        dynamic_array_t array;
+        dynamic_array_search_index_t index;
+
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_options_init(
+                        &options, &fixture.alloc_opts, sizeof(int),
+                        &compare_int));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_init(&options, &array, count + 1, 0, NULL));
+
+        /* even keys from -count up. */
+        for (int i = 0; i < count; ++i)
+        {
+            int value = 2 * i - count;
+            TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+        }
+
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_search_index_init(&index, &array));
+
+        bool all_found = true;
+        bool none_found = true;
+        for (int i = 0; i < count; ++i)
+        {
+            int present = 2 * i - count;
+            int missing = present + 1;
+            all_found = all_found
+                && dynamic_array_binary_search(&array, &present)
+                    == dynamic_array_search_index_find(&index, &present);
+            none_found = none_found
+                && NULL == dynamic_array_search_index_find(&index, &missing);
+        }
+        TEST_EXPECT(all_found);
+        TEST_EXPECT(none_found);
+
+        /* keys below and above every element. */
+        int below = -count - 2;
+        int above = count + 2;
+        TEST_EXPECT(NULL == dynamic_array_search_index_find(&index, &below));
+        TEST_EXPECT(NULL == dynamic_array_search_index_find(&index, &above));
+
+        dispose(dynamic_array_search_index_disposable_handle(&index));
+        dispose(dynamic_array_disposable_handle(&array));
+        dispose(dynamic_array_options_disposable_handle(&options));
+    }
+END_TEST_F()
+
+/**
+ * Test that an index over elements compared by a custom method returns
+ * pointers into the array, and finds the first of several equal elements.
+ */
+BEGIN_TEST_F(custom_compare)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    dynamic_array_search_index_t index;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &options, &fixture.alloc_opts, sizeof(keyed_value),
+                    &compare_keyed_value));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, 3000, 0, NULL));
+
+    /* each key appears three times. */
+    for (int i = 0; i < 3000; ++i)
+    {
+        keyed_value value;
+        memset(&value, 0, sizeof(value));
+        value.key = (int64_t)(i / 3) * 1000000007;
+        value.payload[0] = (char)(i % 3);
+        TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+    }
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == dynamic_array_search_index_init(&index, &array));
+
+    bool all_first = true;
+    keyed_value* values = (keyed_value*)array.array;
+    for (int i = 0; i < 1000; ++i)
+    {
+        keyed_value key;
+        key.key = (int64_t)i * 1000000007;
+        all_first = all_first
+            && values + 3 * i
+                == dynamic_array_search_index_find(&index, &key);
+
+        key.key += 1;
+        all_first = all_first
+            && NULL == dynamic_array_search_index_find(&index, &key);
+    }
+    TEST_EXPECT(all_first);
+
+    dispose(dynamic_array_search_index_disposable_handle(&index));
+    dispose(dynamic_array_disposable_handle(&array));
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
@@ -0,0 +1,331 @@
+/**
+ * \file test_dynamic_array_set_operations.cpp
+ *
+ * Unit tests for the sorted set operations on dynamic arrays.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <minunit/minunit.h>
+#include <random>
+#include <string.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+#include "counted_element.h"
+
+using namespace std;
+
+/**
+ * A record which is ordered by its key alone.
+ */
+struct record
+{
+    int key;
+    int tag;
+};
+
+/**
+ * Compare two records by their keys.
+ */
+static int compare_record(const void* left, const void* right, size_t)
+{
+    return
+        compare_int(
+            &((const record*)left)->key, &((const record*)right)->key,
+            sizeof(int));
+}
+
+class dynamic_array_set_operations_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        int_status =
+            dynamic_array_options_init(
+                &int_options, &alloc_opts, sizeof(int), &compare_int);
+        counted_status =
+            dynamic_array_options_init_ex(
+                &counted_options, &alloc_opts, sizeof(int), &counts,
+                &counting_copy, &counting_dispose, &compare_int);
+        record_status =
+            dynamic_array_options_init(
+                &record_options, &alloc_opts, sizeof(record),
+                &compare_record);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == int_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&int_options));
+        }
+        if (VPR_STATUS_SUCCESS == counted_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&counted_options));
+        }
+        if (VPR_STATUS_SUCCESS == record_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&record_options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Build a sorted vector of values drawn from the given range.
+     */
+    static vector<int> sorted_values(size_t count, int range, unsigned seed)
+    {
+        mt19937 rng(seed);
+        vector<int> values(count);
+        for (int& value : values)
+        {
+            value = (int)(rng() % (unsigned)range);
+        }
+        sort(values.begin(), values.end());
+
+        return values;
+    }
+
+    /**
+     * Fill a dynamic array with the given values.
+     */
+    template <typename T>
+    static bool fill(
+        dynamic_array_options_t* options, dynamic_array_t* array,
+        vector<T>& values)
+    {
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(
+                        options, array, values.size() + 1, 0, NULL))
+        {
+            return false;
+        }
+
+        for (T& value : values)
+        {
+            if (VPR_STATUS_SUCCESS != dynamic_array_append(array, &value))
+            {
+                dispose(dynamic_array_disposable_handle(array));
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Get the elements of a dynamic array of integers.
+     */
+    static vector<int> contents(const dynamic_array_t* array)
+    {
+        const int* arr = (const int*)array->array;
+
+        return vector<int>(arr, arr + array->elements);
+    }
+
+    element_counts counts;
+    int int_status;
+    int counted_status;
+    int record_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t int_options;
+    dynamic_array_options_t counted_options;
+    dynamic_array_options_t record_options;
+};
+
+TEST_SUITE(dynamic_array_set_operations_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_set_operations_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Duplicates are removed in place, and disposed.
+ */
+BEGIN_TEST_F(unique)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.counted_status);
+
+    for (int range : { 1, 3, 50, 100000 })
+    {
+        vector<int> values = fixture.sorted_values(1000, range, 7);
+        dynamic_array_t array;
+        TEST_ASSERT(fixture.fill(&fixture.counted_options, &array, values));
+        TEST_EXPECT(1000 == fixture.counts.live);
+
+        dynamic_array_unique(&array);
+
+        vector<int> expected = values;
+        expected.erase(
+            unique(expected.begin(), expected.end()), expected.end());
+        TEST_EXPECT(expected == fixture.contents(&array));
+        TEST_EXPECT((int)expected.size() == fixture.counts.live);
+
+        dispose(dynamic_array_disposable_handle(&array));
+        TEST_EXPECT(0 == fixture.counts.live);
+    }
+END_TEST_F()
+
+/**
+ * Union, intersection, and difference match the standard algorithms, for
+ * inputs of similar and of very different sizes.
+ */
+BEGIN_TEST_F(set_operations)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.int_status);
+
+    struct { size_t left; size_t right; int range; } cases[] = {
+        { 0, 0, 10 }, { 0, 100, 10 }, { 100, 0, 10 }, { 200, 200, 50 },
+        { 10, 100000, 1000000 }, { 100000, 10, 1000000 }, { 1000, 1000, 3 }
+    };
+
+    for (auto& c : cases)
+    {
+        vector<int> left = fixture.sorted_values(c.left, c.range, 1);
+        vector<int> right = fixture.sorted_values(c.right, c.range, 2);
+        dynamic_array_t x, y;
+        TEST_ASSERT(fixture.fill(&fixture.int_options, &x, left));
+        TEST_ASSERT(fixture.fill(&fixture.int_options, &y, right));
+
+        vector<int> expected;
+        set_union(
+            left.begin(), left.end(), right.begin(), right.end(),
+            back_inserter(expected));
+        dynamic_array_t output;
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_init(
+                        &fixture.int_options, &output, 1, 0, NULL));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == dynamic_array_set_union(&output, &x, &y));
+        TEST_EXPECT(expected == fixture.contents(&output));
+        dispose(dynamic_array_disposable_handle(&output));
+
+        expected.clear();
+        set_intersection(
+            left.begin(), left.end(), right.begin(), right.end(),
+            back_inserter(expected));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_init(
+                        &fixture.int_options, &output, 1, 0, NULL));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_set_intersection(&output, &x, &y));
+        TEST_EXPECT(expected == fixture.contents(&output));
+        dispose(dynamic_array_disposable_handle(&output));
+
+        expected.clear();
+        set_difference(
+            left.begin(), left.end(), right.begin(), right.end(),
+            back_inserter(expected));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_init(
+                        &fixture.int_options, &output, 1, 0, NULL));
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_set_difference(&output, &x, &y));
+        TEST_EXPECT(expected == fixture.contents(&output));
+        dispose(dynamic_array_disposable_handle(&output));
+
+        dispose(dynamic_array_disposable_handle(&x));
+        dispose(dynamic_array_disposable_handle(&y));
+    }
+END_TEST_F()
+
+/**
+ * Results are appended to the output with its copy method.
+ */
+BEGIN_TEST_F(set_operations_copy)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.counted_status);
+
+    vector<int> left = { 1, 2, 2, 3, 5, 8 };
+    vector<int> right = { 2, 3, 4, 8, 8 };
+    dynamic_array_t x, y, output;
+    TEST_ASSERT(fixture.fill(&fixture.counted_options, &x, left));
+    TEST_ASSERT(fixture.fill(&fixture.counted_options, &y, right));
+
+    vector<int> initial = { 0 };
+    TEST_ASSERT(fixture.fill(&fixture.counted_options, &output, initial));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_set_intersection(&output, &x, &y));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == dynamic_array_set_difference(&output, &x, &y));
+
+    vector<int> expected = { 0, 2, 3, 8, 1, 2, 5 };
+    TEST_EXPECT(expected == fixture.contents(&output));
+    TEST_EXPECT(18 == fixture.counts.live);
+
+    dispose(dynamic_array_disposable_handle(&output));
+    dispose(dynamic_array_disposable_handle(&x));
+    dispose(dynamic_array_disposable_handle(&y));
+    TEST_EXPECT(0 == fixture.counts.live);
+END_TEST_F()
+
+/**
+ * A k-way merge is sorted and stable.
+ */
+BEGIN_TEST_F(merge)
+    TEST_ASSERT(VPR_STATUS_SUCCESS == fixture.record_status);
+
+    const size_t count = 5;
+    dynamic_array_t inputs[count];
+    const dynamic_array_t* input_ptrs[count];
+    vector<record> expected;
+    for (size_t i = 0; i < count; ++i)
+    {
+        /* the inputs have different sizes, and one is empty. */
+        vector<int> keys = fixture.sorted_values(i * 300, 1 + (int)i * 40, i);
+        vector<record> records;
+        for (size_t j = 0; j < keys.size(); ++j)
+        {
+            records.push_back({ keys[j], (int)(i * 10000 + j) });
+        }
+        expected.insert(expected.end(), records.begin(), records.end());
+
+        TEST_ASSERT(
+            fixture.fill(&fixture.record_options, &inputs[i], records));
+        input_ptrs[i] = &inputs[i];
+    }
+
+    stable_sort(
+        expected.begin(), expected.end(),
+        [](const record& l, const record& r) { return l.key < r.key; });
+
+    dynamic_array_t output;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(
+                    &fixture.record_options, &output, 1, 0, NULL));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == dynamic_array_merge(&output, input_ptrs, count));
+
+    const record* arr = (const record*)output.array;
+    TEST_ASSERT(expected.size() == output.elements);
+    bool same = true;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        same =
+            same && expected[i].key == arr[i].key
+         && expected[i].tag == arr[i].tag;
+    }
+    TEST_EXPECT(same);
+
+    dispose(dynamic_array_disposable_handle(&output));
+    for (size_t i = 0; i < count; ++i)
+    {
+        dispose(dynamic_array_disposable_handle(&inputs[i]));
+    }
+END_TEST_F()
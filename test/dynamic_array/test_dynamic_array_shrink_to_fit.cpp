@@ -0,0 +1,173 @@
+/**
+ * \file test_dynamic_array_shrink_to_fit.cpp
+ *
+ * Unit tests for dynamic_array_shrink_to_fit.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/dynamic_array.h>
+
+#include "counted_element.h"
+
+class dynamic_array_shrink_to_fit_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        int_status =
+            dynamic_array_options_init(
+                &int_options, &alloc_opts, sizeof(int), &compare_int);
+        tracked_status =
+            dynamic_array_options_init_ex(
+                &tracked_options, &alloc_opts, sizeof(tracked), &counts,
+                &tracked_copy, &tracked_dispose, &compare_tracked);
+
+        /* let the arrays grow as elements are added. */
+        growth_status =
+            VPR_STATUS_SUCCESS == int_status
+         && VPR_STATUS_SUCCESS == tracked_status
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(&int_options, 2)
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(
+                        &tracked_options, 2);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == int_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&int_options));
+        }
+        if (VPR_STATUS_SUCCESS == tracked_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&tracked_options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Create an int array and a tracked array holding the values 0 to count.
+     */
+    bool create(dynamic_array_t* ints, dynamic_array_t* tracks, int count)
+    {
+        if (!growth_status)
+        {
+            return false;
+        }
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(&int_options, ints, count, 0, NULL))
+        {
+            return false;
+        }
+
+        if (
+            VPR_STATUS_SUCCESS
+                != dynamic_array_init(&tracked_options, tracks, count, 0, NULL))
+        {
+            dispose(dynamic_array_disposable_handle(ints));
+            return false;
+        }
+
+        bool ok = true;
+        for (int i = 0; i < count; ++i)
+        {
+            tracked elem;
+            tracked_init(&elem, i);
+            ok = ok
+                && VPR_STATUS_SUCCESS == dynamic_array_append(ints, &i)
+                && VPR_STATUS_SUCCESS == dynamic_array_append(tracks, &elem);
+        }
+
+        return ok;
+    }
+
+    /**
+     * Check that both arrays hold the expected values, and that every tracked
+     * element was moved with the copy method and is live exactly once.
+     */
+    bool holds(
+        const dynamic_array_t* ints, const dynamic_array_t* tracks,
+        const std::vector<int>& expected)
+    {
+        const int* int_values = (const int*)ints->array;
+        const tracked* tracked_values = (const tracked*)tracks->array;
+        bool ok =
+            expected.size() == ints->elements
+         && expected.size() == tracks->elements
+         && (int)expected.size() == counts.live;
+
+        for (size_t i = 0; ok && i < expected.size(); ++i)
+        {
+            ok =
+                expected[i] == int_values[i]
+             && expected[i] == tracked_values[i].value
+             && &tracked_values[i] == tracked_values[i].self;
+        }
+
+        return ok;
+    }
+
+    element_counts counts;
+    bool growth_status;
+    int int_status;
+    int tracked_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t int_options;
+    dynamic_array_options_t tracked_options;
+};
+
+TEST_SUITE(dynamic_array_shrink_to_fit_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    dynamic_array_shrink_to_fit_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Shrinking an array reduces its reserve size to its number of elements, but
+ * never below one element, and keeps its elements.
+ */
+BEGIN_TEST_F(shrink)
+    dynamic_array_t ints, tracks;
+    TEST_ASSERT(fixture.create(&ints, &tracks, 20));
+
+    dynamic_array_truncate(&ints, 6);
+    dynamic_array_truncate(&tracks, 6);
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_shrink_to_fit(&ints));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_shrink_to_fit(&tracks));
+    TEST_EXPECT(6U == ints.reserved_elements);
+    TEST_EXPECT(6U == tracks.reserved_elements);
+    TEST_EXPECT(fixture.holds(&ints, &tracks, { 0, 1, 2, 3, 4, 5 }));
+
+    /* the array still grows after shrinking. */
+    int value = 6;
+    tracked elem;
+    tracked_init(&elem, value);
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&ints, &value));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&tracks, &elem));
+    TEST_EXPECT(fixture.holds(&ints, &tracks, { 0, 1, 2, 3, 4, 5, 6 }));
+
+    dynamic_array_truncate(&ints, 0);
+    dynamic_array_truncate(&tracks, 0);
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_shrink_to_fit(&ints));
+    TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_shrink_to_fit(&tracks));
+    TEST_EXPECT(1U == ints.reserved_elements);
+    TEST_EXPECT(1U == tracks.reserved_elements);
+
+    dispose(dynamic_array_disposable_handle(&ints));
+    dispose(dynamic_array_disposable_handle(&tracks));
+    TEST_EXPECT(0 == fixture.counts.live);
+END_TEST_F()
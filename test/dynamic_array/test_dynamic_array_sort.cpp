@@ -9,10 +9,17 @@
 #include <algorithm>
 #include <iostream>
 #include <minunit/minunit.h>
+#include <random>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include <vpr/allocator/bump_allocator.h>
 #include <vpr/allocator/malloc_allocator.h>
 #include <vpr/compare.h>
 #include <vpr/dynamic_array.h>
 
+#include "counted_element.h"
+
 using namespace std;
 
 class dynamic_array_sort_test {
@@ -31,6 +38,41 @@ public:
         dispose(allocator_options_disposable_handle(&alloc_opts));
     }
 
+    /**
+     * Build input patterns which are known to trouble quicksorts.
+     */
+    static vector<vector<int>> patterns(size_t count)
+    {
+        vector<vector<int>> result;
+        mt19937 rng(12345);
+
+        vector<int> random(count), few(count), sorted(count), pipe(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            random[i] = (int)rng();
+            few[i] = (int)(rng() % 4);
+            sorted[i] = (int)i;
+            pipe[i] = (int)(i < count / 2 ? i : count - i);
+        }
+
+        vector<int> reversed(sorted.rbegin(), sorted.rend());
+        vector<int> nearly = sorted;
+        for (size_t i = 0; i < count / 100; ++i)
+        {
+            swap(nearly[rng() % count], nearly[rng() % count]);
+        }
+
+        result.push_back(random);
+        result.push_back(few);
+        result.push_back(sorted);
+        result.push_back(reversed);
+        result.push_back(nearly);
+        result.push_back(pipe);
+        result.push_back(vector<int>(count, 7));
+
+        return result;
+    }
+
     int dynamic_array_options_init_status;
     allocator_options_t alloc_opts;
     dynamic_array_options_t options;
@@ -557,3 +599,507 @@ BEGIN_TEST_F(sort10)
 
     } while (next_permutation(permutations, permutations + 10));
 END_TEST_F()
+
+/**
+ * Compare ints through a method which is not built in, so that the generic
+ * sort is used.
+ */
+static int compare_int_generic(const void* x, const void* y, size_t size)
+{
+    return compare_int(x, y, size);
+}
+
+/**
+ * Test both sort modes against std::sort on patterns which trouble
+ * quicksorts, with both the typed and the generic sort.
+ */
+BEGIN_TEST_F(sort_patterns)
+    dynamic_array_options_t generic;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &generic, &fixture.alloc_opts, sizeof(int),
+                    &compare_int_generic));
+
+    for (auto options : { &fixture.options, &generic })
+    for (int mode : { DYNAMIC_ARRAY_SORT_UNSTABLE, DYNAMIC_ARRAY_SORT_STABLE })
+    for (size_t count : { 0, 2, 30, 1000, 100000 })
+    for (auto& pattern : dynamic_array_sort_test::patterns(count))
+    {
+        dynamic_array_t array;
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == dynamic_array_init(options, &array, count + 1, 0, NULL));
+        for (int value : pattern)
+        {
+            TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+        }
+
+        TEST_ASSERT(0 == dynamic_array_sort_ex(&array, mode));
+
+        std::sort(pattern.begin(), pattern.end());
+        int* intArr = (int*)array.array;
+        TEST_EXPECT(equal(pattern.begin(), pattern.end(), intArr));
+
+        dispose(dynamic_array_disposable_handle(&array));
+    }
+
+    dispose(dynamic_array_options_disposable_handle(&generic));
+END_TEST_F()
+
+/**
+ * Sort random values of type T with a built-in comparison method, and check
+ * the result against std::sort.
+ */
+template <typename T>
+static bool typed_sort_matches(
+    allocator_options_t* alloc_opts, compare_method_t compare, int mode)
+{
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    mt19937_64 rng(4242);
+    bool matches = false;
+
+    vector<T> values(20000);
+    for (auto& value : values)
+    {
+        /* fill every byte, then scale floating point values into range. */
+        uint64_t bits = rng();
+        memcpy(&value, &bits, sizeof(T));
+        if (is_floating_point<T>::value)
+        {
+            value = (T)((int64_t)bits % 2000000) / (T)1000;
+        }
+    }
+
+    if (VPR_STATUS_SUCCESS
+            != dynamic_array_options_init(
+                    &options, alloc_opts, sizeof(T), compare))
+    {
+        return false;
+    }
+
+    if (VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, values.size(), 0, NULL))
+    {
+        for (auto& value : values)
+        {
+            if (VPR_STATUS_SUCCESS != dynamic_array_append(&array, &value))
+            {
+                break;
+            }
+        }
+
+        std::sort(values.begin(), values.end());
+        matches =
+            array.elements == values.size()
+         && VPR_STATUS_SUCCESS == dynamic_array_sort_ex(&array, mode)
+         && equal(values.begin(), values.end(), (T*)array.array);
+
+        dispose(dynamic_array_disposable_handle(&array));
+    }
+
+    dispose(dynamic_array_options_disposable_handle(&options));
+
+    return matches;
+}
+
+/**
+ * Test the typed sort of each width and signedness.
+ */
+BEGIN_TEST_F(sort_typed)
+    allocator_options_t* a = &fixture.alloc_opts;
+
+    for (int mode : { DYNAMIC_ARRAY_SORT_UNSTABLE, DYNAMIC_ARRAY_SORT_STABLE })
+    {
+        TEST_EXPECT(typed_sort_matches<int8_t>(a, &compare_int8, mode));
+        TEST_EXPECT(typed_sort_matches<uint8_t>(a, &compare_uint8, mode));
+        TEST_EXPECT(typed_sort_matches<int16_t>(a, &compare_int16, mode));
+        TEST_EXPECT(typed_sort_matches<uint16_t>(a, &compare_uint16, mode));
+        TEST_EXPECT(typed_sort_matches<int32_t>(a, &compare_int32, mode));
+        TEST_EXPECT(typed_sort_matches<uint32_t>(a, &compare_uint32, mode));
+        TEST_EXPECT(typed_sort_matches<int64_t>(a, &compare_int64, mode));
+        TEST_EXPECT(typed_sort_matches<uint64_t>(a, &compare_uint64, mode));
+        TEST_EXPECT(typed_sort_matches<char>(a, &compare_char, mode));
+        TEST_EXPECT(typed_sort_matches<long>(a, &compare_long, mode));
+        TEST_EXPECT(typed_sort_matches<float>(a, &compare_float, mode));
+        TEST_EXPECT(typed_sort_matches<double>(a, &compare_double, mode));
+    }
+END_TEST_F()
+
+/**
+ * Test that the typed sort is not used for elements which are not trivially
+ * copyable, even with a built-in comparison method.
+ */
+BEGIN_TEST_F(sort_typed_copy_methods)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    mt19937 rng(8642);
+    element_counts counts;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &options, &fixture.alloc_opts, sizeof(int), &counts,
+                    &counting_copy, &counting_dispose, &compare_int));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, 1000, 0, NULL));
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        int value = (int)rng();
+        TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+    }
+
+    counts.copies = 0;
+    TEST_ASSERT(0 == dynamic_array_sort(&array));
+
+    int* intArr = (int*)array.array;
+    TEST_EXPECT(is_sorted(intArr, intArr + 1000));
+    TEST_EXPECT(counts.copies > 0);
+
+    dispose(dynamic_array_disposable_handle(&array));
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * A key and the position at which it was appended.
+ */
+struct keyed_value
+{
+    int key;
+    int position;
+    char padding[72];
+};
+
+/**
+ * Compare keyed values by key only.
+ */
+static int compare_keyed_value(const void* x, const void* y, size_t)
+{
+    return compare_int(
+        &((const keyed_value*)x)->key, &((const keyed_value*)y)->key,
+        sizeof(int));
+}
+
+/**
+ * Test that a stable sort preserves the order of equal keys, including for
+ * elements too large to move through the stack buffer.
+ */
+BEGIN_TEST_F(stable_sort)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    mt19937 rng(54321);
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &options, &fixture.alloc_opts, sizeof(keyed_value),
+                    &compare_keyed_value));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, 5000, 0, NULL));
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        keyed_value value;
+        memset(&value, 0, sizeof(value));
+        value.key = (int)(rng() % 50);
+        value.position = i;
+        TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+    }
+
+    TEST_ASSERT(
+        0 == dynamic_array_sort_ex(&array, DYNAMIC_ARRAY_SORT_STABLE));
+
+    bool stable = true;
+    keyed_value* values = (keyed_value*)array.array;
+    for (int i = 1; i < 5000; ++i)
+    {
+        stable = stable
+            && (values[i - 1].key < values[i].key
+                || (values[i - 1].key == values[i].key
+                    && values[i - 1].position < values[i].position));
+    }
+    TEST_EXPECT(stable);
+
+    /* an unstable sort still orders the keys. */
+    TEST_ASSERT(0 == dynamic_array_sort(&array));
+    bool sorted = true;
+    for (int i = 1; i < 5000; ++i)
+    {
+        sorted = sorted && values[i - 1].key <= values[i].key;
+    }
+    TEST_EXPECT(sorted);
+
+    dispose(dynamic_array_disposable_handle(&array));
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * Test that elements which are not trivially copyable are moved with the copy
+ * and dispose methods in both sort modes.
+ */
+BEGIN_TEST_F(sort_copy_methods)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    mt19937 rng(2468);
+    element_counts counts;
+    counts.poison = true;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &options, &fixture.alloc_opts, sizeof(tracked), &counts,
+                    &tracked_copy, &tracked_dispose, &compare_tracked));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, 1000, 0, NULL));
+
+    for (int count : { 10, 1000 })
+    {
+        for (int mode :
+                { DYNAMIC_ARRAY_SORT_UNSTABLE, DYNAMIC_ARRAY_SORT_STABLE })
+        {
+            dynamic_array_truncate(&array, 0);
+            for (int i = 0; i < count; ++i)
+            {
+                tracked value;
+                tracked_init(&value, (int)(rng() % 50), i);
+                TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+            }
+            TEST_ASSERT(count == counts.live);
+
+            TEST_ASSERT(0 == dynamic_array_sort_ex(&array, mode));
+
+            bool sorted = true;
+            bool stable = true;
+            bool fixed_up = true;
+            tracked* values = (tracked*)array.array;
+            for (int i = 0; i < count; ++i)
+            {
+                fixed_up = fixed_up && values[i].self == &values[i];
+                if (i > 0)
+                {
+                    sorted = sorted && values[i - 1].value <= values[i].value;
+                    stable = stable
+                        && (values[i - 1].value < values[i].value
+                            || values[i - 1].position < values[i].position);
+                }
+            }
+            TEST_EXPECT(sorted);
+            TEST_EXPECT(fixed_up);
+            TEST_EXPECT(DYNAMIC_ARRAY_SORT_UNSTABLE == mode || stable);
+            TEST_EXPECT(count == counts.live);
+        }
+    }
+
+    dispose(dynamic_array_disposable_handle(&array));
+    TEST_EXPECT(0 == counts.live);
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * Test that sorting works with an allocator which cannot release memory, and
+ * that an invalid sort mode is rejected.
+ */
+BEGIN_TEST_F(bump_allocator)
+    vector<uint8_t> buffer(1024 * 1024);
+    allocator_options_t bump_opts;
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    mt19937 rng(999);
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == bump_allocator_options_init(
+                    &bump_opts, buffer.data(), buffer.size()));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &options, &bump_opts, sizeof(int), &compare_int));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, 100000, 0, NULL));
+
+    for (int mode : { DYNAMIC_ARRAY_SORT_UNSTABLE, DYNAMIC_ARRAY_SORT_STABLE })
+    {
+        array.elements = 0;
+        for (int i = 0; i < 100000; ++i)
+        {
+            int value = (int)(rng() % 1000);
+            TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+        }
+
+        TEST_ASSERT(0 == dynamic_array_sort_ex(&array, mode));
+
+        int* intArr = (int*)array.array;
+        TEST_EXPECT(is_sorted(intArr, intArr + 100000));
+    }
+
+    TEST_EXPECT(
+        VPR_ERROR_DYNAMIC_ARRAY_SORT_GENERAL
+            == dynamic_array_sort_ex(&array, 17));
+
+    dispose(dynamic_array_disposable_handle(&array));
+    dispose(dynamic_array_options_disposable_handle(&options));
+    dispose(allocator_options_disposable_handle(&bump_opts));
+END_TEST_F()
+
+/**
+ * Run each task on its own thread.
+ */
+static void thread_run(
+    void*, dynamic_array_sort_task_t task, void* task_context, size_t count)
+{
+    vector<thread> threads;
+    for (size_t i = 0; i < count; ++i)
+    {
+        threads.emplace_back(task, task_context, i);
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+/**
+ * Run each task serially, in reverse order.
+ */
+static void reverse_run(
+    void*, dynamic_array_sort_task_t task, void* task_context, size_t count)
+{
+    for (size_t i = count; i > 0; --i)
+    {
+        task(task_context, i - 1);
+    }
+}
+
+/**
+ * Test that a parallel sort matches a serial sort, whatever the number of
+ * tasks and however they are scheduled.
+ */
+BEGIN_TEST_F(sort_parallel)
+    const size_t count = 200000;
+    dynamic_array_options_t options;
+    dynamic_array_t serial, parallel;
+    mt19937 rng(777);
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init(
+                    &options, &fixture.alloc_opts, sizeof(keyed_value),
+                    &compare_keyed_value));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &serial, count, 0, NULL));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &parallel, count, 0, NULL));
+
+    vector<keyed_value> values(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        memset(&values[i], 0, sizeof(keyed_value));
+        values[i].key = (int)(rng() % 1000);
+        values[i].position = (int)i;
+        TEST_ASSERT(0 == dynamic_array_append(&serial, &values[i]));
+    }
+
+    TEST_ASSERT(
+        0 == dynamic_array_sort_ex(&serial, DYNAMIC_ARRAY_SORT_STABLE));
+
+    for (auto run : { &thread_run, &reverse_run })
+    for (size_t concurrency : { 0, 1, 2, 3, 8, 13 })
+    for (int mode : { DYNAMIC_ARRAY_SORT_UNSTABLE, DYNAMIC_ARRAY_SORT_STABLE })
+    {
+        dynamic_array_sort_executor_t executor = { concurrency, run, NULL };
+
+        memcpy(parallel.array, values.data(), count * sizeof(keyed_value));
+        parallel.elements = count;
+        TEST_ASSERT(
+            0 == dynamic_array_sort_parallel(&parallel, mode, &executor));
+
+        keyed_value* expected = (keyed_value*)serial.array;
+        keyed_value* actual = (keyed_value*)parallel.array;
+        bool matches = true;
+        for (size_t i = 0; i < count; ++i)
+        {
+            matches = matches
+                && expected[i].key == actual[i].key
+                && (DYNAMIC_ARRAY_SORT_UNSTABLE == mode
+                    || expected[i].position == actual[i].position);
+        }
+        TEST_EXPECT(matches);
+    }
+
+    dispose(dynamic_array_disposable_handle(&parallel));
+    dispose(dynamic_array_disposable_handle(&serial));
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * Test that a parallel sort moves elements which are not trivially copyable
+ * with the copy and dispose methods, and never compares an element after it
+ * was disposed.
+ */
+BEGIN_TEST_F(sort_parallel_copy_methods)
+    const int count = 20000;
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    mt19937 rng(1357);
+    element_counts counts;
+    counts.poison = true;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &options, &fixture.alloc_opts, sizeof(tracked), &counts,
+                    &tracked_copy, &tracked_dispose, &compare_tracked));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&options, &array, count, 0, NULL));
+
+    /* tasks run serially, since the copy method counts without locking. */
+    dynamic_array_sort_executor_t executor = { 4, &reverse_run, NULL };
+
+    for (int mode : { DYNAMIC_ARRAY_SORT_UNSTABLE, DYNAMIC_ARRAY_SORT_STABLE })
+    {
+        dynamic_array_truncate(&array, 0);
+        for (int i = 0; i < count; ++i)
+        {
+            tracked value;
+            tracked_init(&value, (int)(rng() % 1000), i);
+            TEST_ASSERT(0 == dynamic_array_append(&array, &value));
+        }
+
+        TEST_ASSERT(
+            0 == dynamic_array_sort_parallel(&array, mode, &executor));
+
+        bool sorted = true;
+        bool stable = true;
+        bool fixed_up = true;
+        tracked* values = (tracked*)array.array;
+        for (int i = 0; i < count; ++i)
+        {
+            fixed_up = fixed_up && values[i].self == &values[i];
+            if (i > 0)
+            {
+                sorted = sorted && values[i - 1].value <= values[i].value;
+                stable = stable
+                    && (values[i - 1].value < values[i].value
+                        || values[i - 1].position < values[i].position);
+            }
+        }
+        TEST_EXPECT(sorted);
+        TEST_EXPECT(fixed_up);
+        TEST_EXPECT(DYNAMIC_ARRAY_SORT_UNSTABLE == mode || stable);
+        TEST_EXPECT(count == counts.live);
+    }
+
+    dispose(dynamic_array_disposable_handle(&array));
+    TEST_EXPECT(0 == counts.live);
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
@@ -0,0 +1,346 @@
+/**
+ * \file test_priority_queue.cpp
+ *
+ * Unit tests for priority_queue.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <algorithm>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/priority_queue.h>
+
+#include "../dynamic_array/counted_element.h"
+
+class priority_queue_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        int_status =
+            dynamic_array_options_init(
+                &int_options, &alloc_opts, sizeof(int), &compare_int);
+        counted_status =
+            dynamic_array_options_init_ex(
+                &counted_options, &alloc_opts, sizeof(int), &counts,
+                &counting_copy, &counting_dispose, &compare_int);
+
+        /* let the queues grow as elements are pushed. */
+        growth_status =
+            VPR_STATUS_SUCCESS == int_status
+         && VPR_STATUS_SUCCESS == counted_status
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(&int_options, 2)
+         && VPR_STATUS_SUCCESS
+                == dynamic_array_options_set_growth_factor(
+                        &counted_options, 2);
+
+        /* a fixed sequence of values with many duplicates. */
+        uint32_t state = 12345;
+        for (int i = 0; i < 1000; ++i)
+        {
+            state = state * 1103515245 + 12345;
+            values.push_back((int)((state >> 8) % 500));
+        }
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == int_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&int_options));
+        }
+        if (VPR_STATUS_SUCCESS == counted_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&counted_options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    /**
+     * Pop every element of a queue, and check that they come out in order.
+     */
+    bool pops_sorted(priority_queue_t* queue)
+    {
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        bool ok = expected.size() == priority_queue_size(queue);
+        for (size_t i = 0; ok && i < expected.size(); ++i)
+        {
+            int value;
+            ok =
+                expected[i] == *(int*)priority_queue_top(queue)
+             && VPR_STATUS_SUCCESS == priority_queue_pop(queue, &value)
+             && expected[i] == value;
+        }
+
+        return ok && NULL == priority_queue_top(queue);
+    }
+
+    element_counts counts;
+    bool growth_status;
+    int int_status;
+    int counted_status;
+    std::vector<int> values;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t int_options;
+    dynamic_array_options_t counted_options;
+};
+
+TEST_SUITE(priority_queue_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    priority_queue_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Elements pushed onto a queue of any arity pop in order.
+ */
+BEGIN_TEST_F(push_and_pop)
+    priority_queue_t queue;
+
+    TEST_ASSERT(fixture.growth_status);
+    TEST_EXPECT(
+        VPR_ERROR_PRIORITY_QUEUE_INVALID_ARITY
+            == priority_queue_init(&fixture.int_options, &queue, 1, 4));
+
+    const size_t arities[] = { 0, 2, 3, 4, 8 };
+    for (size_t arity : arities)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == priority_queue_init(
+                        &fixture.int_options, &queue, arity, 4));
+        TEST_EXPECT(
+            VPR_ERROR_PRIORITY_QUEUE_EMPTY
+                == priority_queue_pop(&queue, NULL));
+
+        for (int value : fixture.values)
+        {
+            TEST_ASSERT(
+                VPR_STATUS_SUCCESS == priority_queue_push(&queue, &value));
+        }
+
+        TEST_EXPECT(fixture.pops_sorted(&queue));
+
+        dispose(priority_queue_disposable_handle(&queue));
+    }
+END_TEST_F()
+
+/**
+ * A queue made from an existing array pops its elements in order.
+ */
+BEGIN_TEST_F(from_array)
+    dynamic_array_t array;
+    priority_queue_t queue;
+
+    TEST_ASSERT(fixture.growth_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(&fixture.int_options, &array, 4, 0, NULL));
+    for (int value : fixture.values)
+    {
+        TEST_ASSERT(VPR_STATUS_SUCCESS == dynamic_array_append(&array, &value));
+    }
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == priority_queue_init_from_array(&queue, &array, 3));
+    TEST_EXPECT(fixture.pops_sorted(&queue));
+
+    dispose(priority_queue_disposable_handle(&queue));
+END_TEST_F()
+
+/**
+ * Replacing the least element of a queue of size k keeps the greatest k
+ * elements of a stream.
+ */
+BEGIN_TEST_F(top_k)
+    priority_queue_t queue;
+
+    TEST_ASSERT(fixture.growth_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == priority_queue_init(&fixture.int_options, &queue, 0, 10));
+    for (int value : fixture.values)
+    {
+        if (priority_queue_size(&queue) < 10)
+        {
+            TEST_ASSERT(
+                VPR_STATUS_SUCCESS == priority_queue_push(&queue, &value));
+        }
+        else if (value > *(int*)priority_queue_top(&queue))
+        {
+            TEST_ASSERT(
+                VPR_STATUS_SUCCESS
+                    == priority_queue_replace_top(&queue, &value));
+        }
+    }
+
+    std::vector<int> expected = fixture.values;
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = expected.size() - 10; i < expected.size(); ++i)
+    {
+        int value;
+        TEST_ASSERT(VPR_STATUS_SUCCESS == priority_queue_pop(&queue, &value));
+        TEST_EXPECT(expected[i] == value);
+    }
+
+    dispose(priority_queue_disposable_handle(&queue));
+END_TEST_F()
+
+/**
+ * Elements are copied into the queue, and disposed when popped without an
+ * output, when replaced, and when the queue is disposed.
+ */
+BEGIN_TEST_F(copy_and_dispose)
+    priority_queue_t queue;
+
+    TEST_ASSERT(fixture.growth_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == priority_queue_init(&fixture.counted_options, &queue, 0, 4));
+    for (int i = 0; i < 100; ++i)
+    {
+        TEST_ASSERT(VPR_STATUS_SUCCESS == priority_queue_push(&queue, &i));
+    }
+    TEST_EXPECT(100 == fixture.counts.live);
+
+    /* an element popped into an output is owned by the caller. */
+    int value;
+    TEST_ASSERT(VPR_STATUS_SUCCESS == priority_queue_pop(&queue, &value));
+    TEST_EXPECT(0 == value);
+    TEST_EXPECT(100 == fixture.counts.live);
+    counting_dispose(&fixture.counts, &value);
+
+    TEST_ASSERT(VPR_STATUS_SUCCESS == priority_queue_pop(&queue, NULL));
+    TEST_EXPECT(98 == fixture.counts.live);
+
+    value = 1000;
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == priority_queue_replace_top(&queue, &value));
+    TEST_EXPECT(98 == fixture.counts.live);
+    TEST_EXPECT(3 == *(int*)priority_queue_top(&queue));
+
+    dispose(priority_queue_disposable_handle(&queue));
+    TEST_EXPECT(0 == fixture.counts.live);
+END_TEST_F()
+
+/**
+ * Elements which are not trivially copyable are moved within the queue with
+ * the copy and dispose methods.
+ */
+BEGIN_TEST_F(copy_methods)
+    dynamic_array_options_t options;
+    dynamic_array_t array;
+    priority_queue_t queue;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &options, &fixture.alloc_opts, sizeof(tracked),
+                    &fixture.counts, &tracked_copy, &tracked_dispose,
+                    &compare_tracked));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_init(
+                    &options, &array, 2 * fixture.values.size(), 0, NULL));
+    for (int value : fixture.values)
+    {
+        tracked element;
+        tracked_init(&element, value);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == dynamic_array_append(&array, &element));
+    }
+
+    /* heapify the array, then push as many elements again. */
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == priority_queue_init_from_array(&queue, &array, 4));
+    for (int value : fixture.values)
+    {
+        tracked element;
+        tracked_init(&element, value);
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS == priority_queue_push(&queue, &element));
+    }
+    TEST_EXPECT(2 * (int)fixture.values.size() == fixture.counts.live);
+
+    tracked element;
+    tracked_init(&element, 1000);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == priority_queue_replace_top(&queue, &element));
+
+    std::vector<int> expected = fixture.values;
+    expected.insert(
+        expected.end(), fixture.values.begin(), fixture.values.end());
+    std::sort(expected.begin(), expected.end());
+    expected.erase(expected.begin());
+    expected.push_back(1000);
+
+    /* every element stays fixed up, and pops out in order. */
+    bool ok = true;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        tracked* elements = (tracked*)queue.array.array;
+        for (size_t j = 0; j < priority_queue_size(&queue); ++j)
+        {
+            ok = ok && elements[j].self == &elements[j];
+        }
+
+        tracked popped;
+        ok =
+            ok
+         && VPR_STATUS_SUCCESS == priority_queue_pop(&queue, &popped)
+         && popped.self == &popped
+         && expected[i] == popped.value;
+        tracked_dispose(&fixture.counts, &popped);
+    }
+    TEST_EXPECT(ok);
+    TEST_EXPECT(0 == fixture.counts.live);
+
+    dispose(priority_queue_disposable_handle(&queue));
+    dispose(dynamic_array_options_disposable_handle(&options));
+END_TEST_F()
+
+/**
+ * A bounded push keeps the greatest elements of a stream.
+ */
+BEGIN_TEST_F(push_bounded)
+    priority_queue_t queue;
+
+    TEST_ASSERT(fixture.growth_status);
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == priority_queue_init(&fixture.counted_options, &queue, 0, 4));
+    for (int value : fixture.values)
+    {
+        TEST_ASSERT(
+            VPR_STATUS_SUCCESS
+                == priority_queue_push_bounded(&queue, &value, 10));
+    }
+    TEST_EXPECT(10 == priority_queue_size(&queue));
+    TEST_EXPECT(10 == fixture.counts.live);
+
+    std::vector<int> expected = fixture.values;
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = expected.size() - 10; i < expected.size(); ++i)
+    {
+        TEST_EXPECT(expected[i] == *(int*)priority_queue_top(&queue));
+        TEST_ASSERT(VPR_STATUS_SUCCESS == priority_queue_pop(&queue, NULL));
+    }
+    TEST_EXPECT(0 == fixture.counts.live);
+
+    dispose(priority_queue_disposable_handle(&queue));
+END_TEST_F()
@@ -0,0 +1,181 @@
+/**
+ * \file test_segmented_array.cpp
+ *
+ * Unit tests for segmented_array.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vpr/compare.h>
+#include <vpr/segmented_array.h>
+
+#include "../dynamic_array/counted_element.h"
+
+class segmented_array_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+        dynamic_array_options_init_status =
+            dynamic_array_options_init(
+                &options, &alloc_opts, sizeof(int), &compare_int);
+    }
+
+    void tearDown()
+    {
+        if (VPR_STATUS_SUCCESS == dynamic_array_options_init_status)
+        {
+            dispose(dynamic_array_options_disposable_handle(&options));
+        }
+        dispose(allocator_options_disposable_handle(&alloc_opts));
+    }
+
+    int dynamic_array_options_init_status;
+    allocator_options_t alloc_opts;
+    dynamic_array_options_t options;
+};
+
+TEST_SUITE(segmented_array_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    segmented_array_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the segment size must be a power of two, and defaults to filling
+ * SEGMENTED_ARRAY_DEFAULT_SEGMENT_SIZE bytes.
+ */
+BEGIN_TEST_F(init)
+    segmented_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == fixture.dynamic_array_options_init_status);
+    TEST_EXPECT(
+        VPR_ERROR_SEGMENTED_ARRAY_INVALID_SEGMENT_SIZE
+            == segmented_array_init(&fixture.options, &array, 12));
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == segmented_array_init(&fixture.options, &array, 0));
+    TEST_EXPECT(
+        SEGMENTED_ARRAY_DEFAULT_SEGMENT_SIZE / sizeof(int)
+            == segmented_array_segment_elements(&array));
+    TEST_EXPECT(0U == array.elements);
+    TEST_EXPECT(NULL == segmented_array_at(&array, 0));
+
+    dispose(segmented_array_disposable_handle(&array));
+END_TEST_F()
+
+/**
+ * Test that appended elements can be read back by index, and keep their
+ * addresses as the array grows.
+ */
+BEGIN_TEST_F(stable_addresses)
+    segmented_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == segmented_array_init(&fixture.options, &array, 16));
+
+    /* enough elements to grow the directory several times. */
+    std::vector<int*> addresses;
+    bool appended = true;
+    for (int i = 0; i < 5000; ++i)
+    {
+        appended = appended
+            && VPR_STATUS_SUCCESS == segmented_array_append(&array, &i);
+        addresses.push_back((int*)segmented_array_at(&array, i));
+    }
+    TEST_ASSERT(appended);
+    TEST_EXPECT(5000U == array.elements);
+    TEST_EXPECT(313U == array.segments);
+
+    bool stable = true;
+    for (int i = 0; i < 5000; ++i)
+    {
+        stable = stable
+            && addresses[i] == segmented_array_at(&array, i)
+            && i == *addresses[i];
+    }
+    TEST_EXPECT(stable);
+    TEST_EXPECT(NULL == segmented_array_at(&array, 5000));
+
+    dispose(segmented_array_disposable_handle(&array));
+END_TEST_F()
+
+/**
+ * Test that iterating segment by segment visits every element in order.
+ */
+BEGIN_TEST_F(segments)
+    segmented_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == segmented_array_init(&fixture.options, &array, 8));
+
+    for (int i = 0; i < 21; ++i)
+    {
+        TEST_ASSERT(VPR_STATUS_SUCCESS == segmented_array_append(&array, &i));
+    }
+
+    int expected = 0;
+    size_t segments = 0;
+    size_t count;
+    void* elems;
+    while (
+        NULL != (elems = segmented_array_segment(&array, segments, &count)))
+    {
+        TEST_EXPECT(count == (segments < 2 ? 8U : 5U));
+        for (size_t j = 0; j < count; ++j)
+        {
+            TEST_EXPECT(expected++ == ((int*)elems)[j]);
+        }
+
+        ++segments;
+    }
+
+    TEST_EXPECT(3U == segments);
+    TEST_EXPECT(21 == expected);
+    TEST_EXPECT(0U == count);
+
+    dispose(segmented_array_disposable_handle(&array));
+END_TEST_F()
+
+/**
+ * Test that elements which are not trivially copyable are copied in with the
+ * copy method, and disposed with the array.
+ */
+BEGIN_TEST_F(copy_and_dispose)
+    element_counts counts;
+    dynamic_array_options_t custom;
+    segmented_array_t array;
+
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS
+            == dynamic_array_options_init_ex(
+                    &custom, &fixture.alloc_opts, sizeof(int), &counts,
+                    &counting_copy, &counting_dispose, &compare_int));
+    TEST_ASSERT(
+        VPR_STATUS_SUCCESS == segmented_array_init(&custom, &array, 4));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        TEST_ASSERT(VPR_STATUS_SUCCESS == segmented_array_append(&array, &i));
+    }
+    TEST_EXPECT(10 == counts.live);
+
+    dispose(segmented_array_disposable_handle(&array));
+    TEST_EXPECT(0 == counts.live);
+
+    dispose(dynamic_array_options_disposable_handle(&custom));
+END_TEST_F()